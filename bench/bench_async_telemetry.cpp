@@ -0,0 +1,75 @@
+/**
+ * @file bench_async_telemetry.cpp
+ * @brief Control-loop cost of Publish(): inline UDP sender vs AsyncTelemetrySink.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "bench_util.h"
+#include "flight/telemetry/async_telemetry.h"
+#include "flight/telemetry/udp_telemetry.h"
+
+namespace {
+
+constexpr size_t kTicks = 5000;
+constexpr uint16_t kPort = 14567;
+
+void Run(const char* name, flight::telemetry::ITelemetrySink& sink) {
+  std::vector<uint64_t> cost(kTicks);
+  flight::telemetry::TelemetrySnapshot snapshot;
+  snapshot.output.motor_count = 4;
+  for (size_t i = 0; i < kTicks; ++i) {
+    snapshot.timestamp_us = i * 1000;
+    snapshot.command_sequence = static_cast<uint32_t>(i);
+    const uint64_t start = flight::bench::NowNs();
+    sink.Publish(snapshot);
+    cost[i] = flight::bench::NowNs() - start;
+    // 1 kHz loop: leave the consumer time to run.
+    std::this_thread::sleep_for(std::chrono::microseconds(1000));
+  }
+  std::sort(cost.begin(), cost.end());
+
+  char label[80];
+  std::snprintf(label, sizeof(label), "%s p50", name);
+  flight::bench::Report(label, static_cast<double>(cost[kTicks / 2]), "ns");
+  std::snprintf(label, sizeof(label), "%s p99", name);
+  flight::bench::Report(label, static_cast<double>(cost[kTicks * 99 / 100]), "ns");
+  std::snprintf(label, sizeof(label), "%s max", name);
+  flight::bench::Report(label, static_cast<double>(cost.back()), "ns");
+}
+
+}  // namespace
+
+int main() {
+  // A bound but unread socket: the kernel discards overflow silently.
+  const int drain = ::socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(kPort);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  ::bind(drain, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+
+  flight::telemetry::UdpTelemetrySender::Config config;
+  config.port = kPort;
+  config.rate_hz = 0;
+  flight::telemetry::UdpTelemetrySender udp(config);
+  udp.Initialize();
+  Run("inline udp publish", udp);
+
+  flight::telemetry::AsyncTelemetrySink async(udp);
+  async.Start();
+  Run("async publish", async);
+  async.Stop();
+  flight::bench::Report("async dropped", static_cast<double>(async.Dropped()), "snapshots");
+  ::close(drain);
+  return 0;
+}
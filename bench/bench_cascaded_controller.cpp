@@ -0,0 +1,58 @@
+/**
+ * @file bench_cascaded_controller.cpp
+ * @brief Cost of each cascaded loop level and of a full 1 kHz controller tick.
+ */
+
+#include <cmath>
+
+#include "bench_util.h"
+#include "flight/controllers/cascaded_controller.h"
+
+namespace {
+
+using flight::controllers::CascadedController;
+
+constexpr uint32_t kIterations = 1000000;
+
+flight::core::Pose PoseAt(uint32_t n) {
+  const float t = static_cast<float>(n) * 1e-3f;
+  flight::core::Pose pose{};
+  const float half_roll = 0.05f * std::sin(t * 3.0f);
+  pose.orientation = {std::cos(half_roll), std::sin(half_roll), 0.0f, 0.0f};
+  pose.angular_velocity_rps = {0.1f * std::cos(t * 3.0f), 0.0f, 0.2f};
+  pose.velocity_mps = {0.3f, 0.05f, 0.0f};
+  pose.position_m.z = -1.0f + 0.1f * std::sin(t);
+  return pose;
+}
+
+template <typename Step>
+void Time(const char* name, Step step) {
+  const uint64_t start = flight::bench::NowNs();
+  for (uint32_t n = 0; n < kIterations; ++n) {
+    step(n);
+  }
+  flight::bench::Report(name, static_cast<double>(flight::bench::NowNs() - start) / kIterations,
+                        "ns/step");
+}
+
+}  // namespace
+
+int main() {
+  CascadedController controller;
+  controller.Initialize();
+  flight::controllers::ControlSetpoint setpoint{};
+  setpoint.velocity_mps.x = 0.5f;
+  setpoint.body_rates_rps.z = 0.2f;
+  controller.Update(PoseAt(0), setpoint, 0.001f);
+
+  Time("rate level (1 kHz)", [&](uint32_t) { controller.StepRate(1e-3f); });
+  Time("attitude level (250 Hz)", [&](uint32_t) { controller.StepAttitude(4e-3f); });
+  Time("velocity/depth level (50 Hz)", [&](uint32_t) { controller.StepVelocity(20e-3f); });
+
+  float sink = 0.0f;
+  Time("full tick incl. scheduler + allocation", [&](uint32_t n) {
+    sink += controller.Update(PoseAt(n & 1023), setpoint, 1e-3f).motors[n & 3];
+  });
+  flight::bench::DoNotOptimize(sink);
+  return 0;
+}
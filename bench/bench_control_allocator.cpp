@@ -0,0 +1,71 @@
+/**
+ * @file bench_control_allocator.cpp
+ * @brief Allocation cost on 6- and 8-thruster frames, unsaturated and saturated.
+ */
+
+#include "bench_util.h"
+#include "flight/controllers/control_allocator.h"
+
+namespace {
+
+using flight::controllers::ControlAllocator;
+using flight::controllers::Wrench;
+
+constexpr uint32_t kIterations = 500000;
+constexpr float kS = 0.70710678f;
+
+/** @brief Four vectored horizontal thrusters shared by both frames. */
+void AddVectoredHorizontals(ControlAllocator::Config& config) {
+  ControlAllocator::SetThruster(config, 0, {0.15f, 0.10f, 0.0f}, {kS, -kS, 0.0f});
+  ControlAllocator::SetThruster(config, 1, {0.15f, -0.10f, 0.0f}, {kS, kS, 0.0f});
+  ControlAllocator::SetThruster(config, 2, {-0.15f, 0.10f, 0.0f}, {kS, kS, 0.0f});
+  ControlAllocator::SetThruster(config, 3, {-0.15f, -0.10f, 0.0f}, {kS, -kS, 0.0f});
+}
+
+ControlAllocator::Config SixThrusterFrame() {
+  ControlAllocator::Config config{};
+  AddVectoredHorizontals(config);
+  ControlAllocator::SetThruster(config, 4, {0.0f, 0.11f, 0.0f}, {0.0f, 0.0f, 1.0f});
+  ControlAllocator::SetThruster(config, 5, {0.0f, -0.11f, 0.0f}, {0.0f, 0.0f, 1.0f});
+  return config;
+}
+
+ControlAllocator::Config EightThrusterFrame() {
+  ControlAllocator::Config config{};
+  AddVectoredHorizontals(config);
+  ControlAllocator::SetThruster(config, 4, {0.12f, 0.20f, 0.0f}, {0.0f, 0.0f, 1.0f});
+  ControlAllocator::SetThruster(config, 5, {0.12f, -0.20f, 0.0f}, {0.0f, 0.0f, 1.0f});
+  ControlAllocator::SetThruster(config, 6, {-0.12f, 0.20f, 0.0f}, {0.0f, 0.0f, 1.0f});
+  ControlAllocator::SetThruster(config, 7, {-0.12f, -0.20f, 0.0f}, {0.0f, 0.0f, 1.0f});
+  return config;
+}
+
+/** @brief Runs @p kIterations allocations; @p gain pushes requests into saturation. */
+void Run(const char* name, const ControlAllocator::Config& config, float gain) {
+  ControlAllocator allocator(config);
+  float commands[ControlAllocator::kMaxThrusters] = {};
+  float sink = 0.0f;
+  const uint64_t start = flight::bench::NowNs();
+  for (uint32_t n = 0; n < kIterations; ++n) {
+    Wrench wrench{};
+    for (uint8_t a = 0; a < flight::controllers::kWrenchAxes; ++a) {
+      const float phase = static_cast<float>((n * 37 + a * 211) & 1023) / 512.0f - 1.0f;
+      wrench.axis[a] = phase * gain * (a >= flight::controllers::kRoll ? 0.1f : 1.0f);
+    }
+    allocator.Allocate(wrench, commands);
+    sink += commands[n & 3];
+  }
+  const uint64_t elapsed = flight::bench::NowNs() - start;
+  flight::bench::DoNotOptimize(sink);
+  flight::bench::Report(name, static_cast<double>(elapsed) / kIterations, "ns/alloc");
+}
+
+}  // namespace
+
+int main() {
+  Run("6 thrusters, unsaturated", SixThrusterFrame(), 0.3f);
+  Run("6 thrusters, saturated", SixThrusterFrame(), 3.0f);
+  Run("8 thrusters, unsaturated", EightThrusterFrame(), 0.3f);
+  Run("8 thrusters, saturated", EightThrusterFrame(), 3.0f);
+  return 0;
+}
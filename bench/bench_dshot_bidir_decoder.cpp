@@ -0,0 +1,104 @@
+/**
+ * @file bench_dshot_bidir_decoder.cpp
+ * @brief Bidirectional DShot response decoding throughput (frames per second).
+ */
+
+#include "bench_util.h"
+#include "flight/actuators/dshot_bidir_decoder.h"
+
+namespace {
+
+using flight::actuators::DshotBidirDecoder;
+using flight::actuators::kDshotResponseBits;
+namespace detail = flight::actuators::dshot_detail;
+
+constexpr uint32_t kFrames = 1000000;
+constexpr uint8_t kSamplesPerBit = 10;
+constexpr uint8_t kResponseSamples = kSamplesPerBit * 4 / 5;
+constexpr uint16_t kCaptures = 64;
+constexpr uint16_t kWords = 7;
+
+struct CaptureBuffer {
+  uint32_t words[kWords];
+};
+
+CaptureBuffer MakeCapture(uint16_t code, uint16_t lead) {
+  const uint16_t data = code & 0x0FFF;
+  const uint16_t crc = static_cast<uint16_t>(~(data ^ (data >> 4) ^ (data >> 8)) & 0xF);
+  const uint16_t value = static_cast<uint16_t>((data << 4) | crc);
+  uint32_t gcr = 0;
+  for (int shift = 12; shift >= 0; shift -= 4) {
+    gcr = (gcr << 5) | detail::kGcrEncode[(value >> shift) & 0xF];
+  }
+  CaptureBuffer capture{};
+  for (auto& word : capture.words) {
+    word = 0xFFFFFFFFu;
+  }
+  uint16_t index = lead;
+  bool level = false;
+  for (int bit = kDshotResponseBits - 1; bit >= 0; --bit) {
+    if (bit < 20 && ((gcr >> bit) & 0x1)) {
+      level = !level;
+    }
+    for (uint8_t s = 0; s < kResponseSamples; ++s, ++index) {
+      if (!level) {
+        capture.words[index / 32] &= ~(1u << (index % 32));
+      }
+    }
+  }
+  return capture;
+}
+
+/** @brief Per-sample majority vote over fixed bit windows after the start edge. */
+uint16_t MajorityDecode(const uint32_t* words, uint16_t sample_count) {
+  uint16_t start = 0;
+  while (start < sample_count && ((words[start / 32] >> (start % 32)) & 0x1)) {
+    ++start;
+  }
+  uint32_t line = 0;
+  for (uint8_t bit = 0; bit < kDshotResponseBits; ++bit) {
+    uint8_t ones = 0;
+    for (uint8_t s = 0; s < kResponseSamples; ++s) {
+      const uint16_t index = static_cast<uint16_t>(start + bit * kResponseSamples + s);
+      ones += (index < sample_count && ((words[index / 32] >> (index % 32)) & 0x1)) ? 1 : 0;
+    }
+    line = (line << 1) | (ones > kResponseSamples / 2 ? 1u : 0u);
+  }
+  const auto value = DshotBidirDecoder::DecodeLineBits(line);
+  return value ? *value : 0;
+}
+
+double FramesPerSecond(uint64_t elapsed_ns) {
+  return static_cast<double>(kFrames) * 1e9 / static_cast<double>(elapsed_ns);
+}
+
+}  // namespace
+
+int main() {
+  CaptureBuffer captures[kCaptures];
+  for (uint16_t i = 0; i < kCaptures; ++i) {
+    captures[i] = MakeCapture(static_cast<uint16_t>(i * 61 + 300), static_cast<uint16_t>(i % 32));
+  }
+  constexpr uint16_t kSampleCount = kWords * 32;
+  uint32_t sink = 0;
+
+  uint64_t start = flight::bench::NowNs();
+  for (uint32_t n = 0; n < kFrames; ++n) {
+    sink += MajorityDecode(captures[n % kCaptures].words, kSampleCount);
+  }
+  flight::bench::Report("per-sample majority", FramesPerSecond(flight::bench::NowNs() - start),
+                        "frames/s");
+
+  DshotBidirDecoder decoder({kSamplesPerBit, 14});
+  flight::actuators::DshotTelemetryFrame frame{};
+  start = flight::bench::NowNs();
+  for (uint32_t n = 0; n < kFrames; ++n) {
+    decoder.Decode(static_cast<uint8_t>(n & 7), captures[n % kCaptures].words, kSampleCount, frame);
+    sink += frame.raw;
+  }
+  flight::bench::Report("run-length + GCR table", FramesPerSecond(flight::bench::NowNs() - start),
+                        "frames/s");
+
+  flight::bench::DoNotOptimize(sink);
+  return 0;
+}
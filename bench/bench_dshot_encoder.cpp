@@ -0,0 +1,93 @@
+/**
+ * @file bench_dshot_encoder.cpp
+ * @brief DShot frame encoding throughput (frames per second).
+ */
+
+#include "bench_util.h"
+#include "flight/actuators/dshot_encoder.h"
+
+namespace {
+
+using flight::actuators::DshotEncoder;
+
+/** @brief Previous bit-loop encoder kept as the baseline. */
+void BitLoopEncode(uint16_t packet, uint32_t* words) {
+  words[0] = 0;
+  words[1] = 0;
+  uint16_t tick_index = 0;
+  for (int bit = 15; bit >= 0; --bit) {
+    const bool bit_set = (packet >> bit) & 0x1;
+    const uint8_t symbol = bit_set ? 0b110 : 0b100;
+    for (uint8_t s = 0; s < 3; ++s) {
+      const uint8_t symbol_bit = (symbol >> (2 - s)) & 0x1;
+      if (symbol_bit) {
+        words[tick_index / 32] |= (1u << (tick_index % 32));
+      }
+      ++tick_index;
+    }
+  }
+}
+
+constexpr uint32_t kFrames = 2000000;
+constexpr uint8_t kChannels = 8;
+
+double FramesPerSecond(uint64_t elapsed_ns) {
+  return static_cast<double>(kFrames) * 1e9 / static_cast<double>(elapsed_ns);
+}
+
+}  // namespace
+
+int main() {
+  DshotEncoder encoder;
+  flight::actuators::ActuatorCommand commands[kChannels];
+  uint16_t packets[kChannels];
+  uint32_t sink = 0;
+
+  // Each "frame" below is one full update of all kChannels motors.
+  uint64_t start = flight::bench::NowNs();
+  for (uint32_t n = 0; n < kFrames; ++n) {
+    for (uint8_t c = 0; c < kChannels; ++c) {
+      commands[c].value = static_cast<float>((n + c) & 1023) / 512.0f - 1.0f;
+    }
+    encoder.PackAll(commands, kChannels, packets);
+    for (uint8_t c = 0; c < kChannels; ++c) {
+      uint32_t words[2];
+      BitLoopEncode(packets[c], words);
+      sink ^= words[0] ^ words[1];
+    }
+  }
+  flight::bench::DoNotOptimize(sink);
+  flight::bench::Report("bit-loop serial, 8 ch", FramesPerSecond(flight::bench::NowNs() - start),
+                        "frames/s");
+
+  start = flight::bench::NowNs();
+  for (uint32_t n = 0; n < kFrames; ++n) {
+    for (uint8_t c = 0; c < kChannels; ++c) {
+      commands[c].value = static_cast<float>((n + c) & 1023) / 512.0f - 1.0f;
+    }
+    encoder.PackAll(commands, kChannels, packets);
+    for (uint8_t c = 0; c < kChannels; ++c) {
+      uint32_t words[flight::actuators::kDshotSerialWords];
+      DshotEncoder::EncodeSerial(packets[c], words);
+      sink ^= words[0] ^ words[1];
+    }
+  }
+  flight::bench::DoNotOptimize(sink);
+  flight::bench::Report("table serial, 8 ch", FramesPerSecond(flight::bench::NowNs() - start),
+                        "frames/s");
+
+  start = flight::bench::NowNs();
+  for (uint32_t n = 0; n < kFrames; ++n) {
+    for (uint8_t c = 0; c < kChannels; ++c) {
+      commands[c].value = static_cast<float>((n + c) & 1023) / 512.0f - 1.0f;
+    }
+    encoder.PackAll(commands, kChannels, packets);
+    uint32_t words[flight::actuators::kDshotParallelWords];
+    DshotEncoder::EncodeParallel(packets, kChannels, words);
+    sink ^= words[0] ^ words[7];
+  }
+  flight::bench::DoNotOptimize(sink);
+  flight::bench::Report("table parallel (transposed), 8 ch",
+                        FramesPerSecond(flight::bench::NowNs() - start), "frames/s");
+  return 0;
+}
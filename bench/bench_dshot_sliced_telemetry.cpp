@@ -0,0 +1,91 @@
+/**
+ * @file bench_dshot_sliced_telemetry.cpp
+ * @brief All-channel telemetry decode throughput (8-channel tables per second).
+ */
+
+#include "bench_util.h"
+#include "flight/actuators/dshot_sliced_decoder.h"
+
+namespace {
+
+using flight::actuators::DshotBidirDecoder;
+using flight::actuators::DshotSlicedDecoder;
+using flight::actuators::DshotTelemetryFrame;
+using flight::actuators::DshotTelemetryTable;
+using flight::actuators::kDshotResponseBits;
+namespace detail = flight::actuators::dshot_detail;
+
+constexpr uint32_t kTables = 200000;
+constexpr uint8_t kChannels = 8;
+constexpr uint16_t kSamples = DshotSlicedDecoder::kWindowSamples;
+
+void DrawLane(uint8_t* window, uint16_t offset, uint8_t lane, uint16_t code) {
+  const uint16_t data = code & 0x0FFF;
+  const uint16_t crc = static_cast<uint16_t>(~(data ^ (data >> 4) ^ (data >> 8)) & 0xF);
+  const uint16_t value = static_cast<uint16_t>((data << 4) | crc);
+  uint32_t gcr = 0;
+  for (int shift = 12; shift >= 0; shift -= 4) {
+    gcr = (gcr << 5) | detail::kGcrEncode[(value >> shift) & 0xF];
+  }
+  bool level = false;
+  uint16_t index = offset;
+  for (int bit = kDshotResponseBits - 1; bit >= 0; --bit) {
+    if (bit < 20 && ((gcr >> bit) & 0x1)) {
+      level = !level;
+    }
+    for (uint8_t s = 0; s < 8; ++s, ++index) {
+      if (!level) {
+        window[index] = static_cast<uint8_t>(window[index] & ~(1u << lane));
+      }
+    }
+  }
+}
+
+double TablesPerSecond(uint64_t elapsed_ns) {
+  return static_cast<double>(kTables) * 1e9 / static_cast<double>(elapsed_ns);
+}
+
+}  // namespace
+
+int main() {
+  uint8_t window[kSamples];
+  for (auto& sample : window) {
+    sample = 0xFF;
+  }
+  for (uint8_t lane = 0; lane < kChannels; ++lane) {
+    DrawLane(window, static_cast<uint16_t>(lane * 5), lane, static_cast<uint16_t>(300 + lane * 97));
+  }
+  uint32_t sink = 0;
+
+  // Per-channel baseline: gather each lane sample by sample, then decode it.
+  DshotBidirDecoder bidir({10, 14});
+  uint64_t start = flight::bench::NowNs();
+  for (uint32_t n = 0; n < kTables; ++n) {
+    for (uint8_t lane = 0; lane < kChannels; ++lane) {
+      uint32_t words[kSamples / 32] = {};
+      for (uint16_t i = 0; i < kSamples; ++i) {
+        words[i / 32] |= static_cast<uint32_t>((window[i] >> lane) & 0x1) << (i % 32);
+      }
+      DshotTelemetryFrame frame{};
+      bidir.Decode(lane, words, kSamples, frame);
+      sink += frame.raw;
+    }
+  }
+  flight::bench::Report("per-channel gather + decode", TablesPerSecond(flight::bench::NowNs() - start),
+                        "tables/s");
+
+  DshotSlicedDecoder::Config config{};
+  config.channel_count = kChannels;
+  DshotSlicedDecoder sliced(config);
+  start = flight::bench::NowNs();
+  for (uint32_t n = 0; n < kTables; ++n) {
+    DshotTelemetryTable table{};
+    sliced.DecodeWindow(window, table);
+    sink += table.frames[n & 7].raw + table.updated_mask;
+  }
+  flight::bench::Report("bit-sliced transpose + popcount",
+                        TablesPerSecond(flight::bench::NowNs() - start), "tables/s");
+
+  flight::bench::DoNotOptimize(sink);
+  return 0;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file bench_esc_latency.cpp
+ * @brief Command-to-edge latency of the ESC output protocols.
+ *
+ * Each output writes to a simulated PWM slice whose counter is stepped one
+ * tick at a time the way the RP2350 slice counts at 150 MHz / divider.
+ * A command is written at a random counter phase. Latency is the measured
+ * Write() time plus the simulated time until the pin's falling edge ends
+ * the first pulse that carries the new level (the ESC reads the width at
+ * that edge). Only the counter is simulated; the levels, divider and wrap
+ * come from the output driver. DShot rows are a frame-time model.
+ */
+
+#include <cstdio>
+#include <random>
+
+#include "bench_util.h"
+#include "flight/actuators/biheli_pwm_output.h"
+#include "flight/actuators/oneshot_output.h"
+#include "flight/actuators/pwm_slices.h"
+#include "flight/hal/hal.h"
+
+namespace {
+
+using flight::actuators::ActuatorCommand;
+
+constexpr uint32_t kPin = 2;
+
+/** @brief PWM slices with double-buffered levels and a counter stepped one tick at a time. */
+class SteppedPwm final : public flight::hal::IPwm {
+ public:
+  struct Slice {
+    uint8_t divider = 0;
+    uint16_t top = 0;
+    uint16_t pending[2] = {};
+    uint16_t active[2] = {};
+    uint16_t counter = 0;
+    bool enabled = false;
+  };
+
+  uint32_t ClockHz() const override { return 150000000; }
+  bool ConfigureSlice(uint8_t slice, uint8_t divider, uint16_t top) override {
+    slices[slice].divider = divider;
+    slices[slice].top = top;
+    return true;
+  }
+  void EnablePin(uint32_t) override {}
+  void SetLevel(uint8_t slice, uint8_t channel, uint16_t level) override {
+    slices[slice].pending[channel] = level;
+  }
+  void EnableSlices(uint32_t slice_mask) override {
+    for (uint8_t i = 0; i < 12; ++i) {
+      if (slice_mask & (1u << i)) {
+        slices[i].enabled = true;
+      }
+    }
+  }
+  /** @brief Advance every enabled counter one tick; levels latch when it wraps. */
+  void Step() {
+    for (auto& slice : slices) {
+      if (!slice.enabled) {
+        continue;
+      }
+      if (slice.counter >= slice.top) {
+        slice.counter = 0;
+        slice.active[0] = slice.pending[0];
+        slice.active[1] = slice.pending[1];
+      } else {
+        ++slice.counter;
+      }
+    }
+  }
+  /** @brief Pin level: high while the counter is below the active compare level. */
+  bool High(uint8_t slice, uint8_t channel) const {
+    return slices[slice].counter < slices[slice].active[channel];
+  }
+
+  Slice slices[12];
+};
+
+struct Latency {
+  double mean_us = 0.0;
+  double worst_us = 0.0;
+  double write_ns = 0.0;
+};
+
+template <typename Output>
+Latency Measure(Output& output, SteppedPwm& pwm, int commands) {
+  const uint8_t slice = flight::actuators::PwmSliceForGpio(kPin);
+  const uint8_t channel = flight::actuators::PwmChannelForGpio(kPin);
+  const double tick_us = static_cast<double>(pwm.slices[slice].divider) * 1e6 / pwm.ClockHz();
+  const uint32_t period_ticks = pwm.slices[slice].top + 1u;
+
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<uint32_t> phase(0, period_ticks - 1);
+  std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+  Latency latency{};
+  for (int n = 0; n < commands; ++n) {
+    for (uint32_t skip = phase(rng); skip > 0; --skip) {
+      pwm.Step();
+    }
+    ActuatorCommand command{value(rng)};
+    const uint64_t start = flight::bench::NowNs();
+    output.Write(&command, 1);
+    const double write_ns = static_cast<double>(flight::bench::NowNs() - start);
+
+    // Run the counter until the new level is latched and its pulse ends.
+    const uint16_t staged = pwm.slices[slice].pending[channel];
+    uint64_t ticks = 0;
+    bool latched = false;
+    bool was_high = pwm.High(slice, channel);
+    while (true) {
+      const uint16_t before = pwm.slices[slice].counter;
+      pwm.Step();
+      ++ticks;
+      latched = latched || (pwm.slices[slice].counter < before);
+      const bool high = pwm.High(slice, channel);
+      const bool falling = was_high && !high;
+      was_high = high;
+      if (latched && pwm.slices[slice].active[channel] == staged &&
+          (falling || (staged == 0 && pwm.slices[slice].counter == 0))) {
+        break;
+      }
+    }
+    const double total = ticks * tick_us + write_ns * 1e-3;
+    latency.mean_us += total;
+    latency.worst_us = total > latency.worst_us ? total : latency.worst_us;
+    latency.write_ns += write_ns;
+  }
+  latency.mean_us /= commands;
+  latency.write_ns /= commands;
+  return latency;
+}
+
+template <typename Output, typename Config>
+void Run(const char* name, Config config, int commands) {
+  SteppedPwm pwm;
+  config.channel_count = 1;
+  config.pins[0] = kPin;
+  Output output(config, &pwm);
+  if (!output.Initialize()) {
+    std::printf("%-28s init failed\n", name);
+    return;
+  }
+  const Latency latency = Measure(output, pwm, commands);
+  std::printf("%-28s mean %8.1f us  worst %8.1f us  write %6.1f ns\n", name, latency.mean_us,
+              latency.worst_us, latency.write_ns);
+}
+
+}  // namespace
+
+int main() {
+  using flight::actuators::BiheliPwmOutput;
+  using flight::actuators::OneShotOutput;
+  using flight::actuators::OneShotProtocol;
+
+  // Neutral pulses come from each ESC's configuration, not the range midpoint.
+  BiheliPwmOutput::Config pwm50{};
+  Run<BiheliPwmOutput>("PWM 50 Hz", pwm50, 200);
+  BiheliPwmOutput::Config pwm490{};
+  pwm490.update_rate_hz = 490.0f;
+  Run<BiheliPwmOutput>("PWM 490 Hz", pwm490, 1000);
+
+  OneShotOutput::Config oneshot125{};
+  oneshot125.update_rate_hz = 3900.0f;
+  oneshot125.neutral_pulse_us = 125.0f;  // forward-only ESC
+  Run<OneShotOutput>("OneShot125 3.9 kHz", oneshot125, 2000);
+  OneShotOutput::Config oneshot42{};
+  oneshot42.protocol = OneShotProtocol::kOneShot42;
+  oneshot42.update_rate_hz = 11000.0f;
+  oneshot42.neutral_pulse_us = 42.0f;
+  Run<OneShotOutput>("OneShot42 11 kHz", oneshot42, 2000);
+  OneShotOutput::Config multishot{};
+  multishot.protocol = OneShotProtocol::kMultiShot;
+  multishot.update_rate_hz = 32000.0f;
+  multishot.neutral_pulse_us = 5.0f;
+  Run<OneShotOutput>("MultiShot 32 kHz", multishot, 2000);
+
+  // Model, not measured: a DShot frame starts on Write() and is read after 16 bits.
+  flight::bench::Report("DShot300 frame (model)", 16.0 * 1e3 / 300.0, "us");
+  flight::bench::Report("DShot600 frame (model)", 16.0 * 1e3 / 600.0, "us");
+  return 0;
+}
@@ -0,0 +1,163 @@
+/**
+ * @file bench_io_reactor.cpp
+ * @brief 1 kHz control-loop jitter with inline sockets vs the I/O reactor, idle and under a UDP flood.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bench_util.h"
+#include "flight/io/reactor_endpoints.h"
+#include "flight/receiver/command_protocol.h"
+#include "flight/telemetry/udp_telemetry.h"
+
+namespace {
+
+using flight::receiver::CommandFrame;
+
+constexpr int kTicks = 1500;
+constexpr uint64_t kPeriodNs = 1000000;
+/** @brief Datagrams per flood burst; one burst per millisecond. */
+constexpr int kBurst = 64;
+
+/** @brief Sends bursts of v2 command packets at a port until stopped. */
+class Flood {
+ public:
+  Flood(uint16_t port, bool enabled) {
+    if (!enabled) {
+      return;
+    }
+    thread_ = std::thread([this, port] {
+      const int sock = ::socket(AF_INET, SOCK_DGRAM, 0);
+      sockaddr_in addr{};
+      addr.sin_family = AF_INET;
+      addr.sin_port = htons(port);
+      addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      CommandFrame frame{};
+      frame.channel_count = 3;
+      while (!stop_.load(std::memory_order_relaxed)) {
+        for (int i = 0; i < kBurst; ++i) {
+          ++frame.sequence;
+          const auto packet = flight::receiver::EncodeCommandPacket(frame);
+          ::sendto(sock, &packet, sizeof(packet), 0, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      ::close(sock);
+    });
+  }
+  ~Flood() {
+    stop_ = true;
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+ private:
+  std::atomic<bool> stop_{false};
+  std::thread thread_;
+};
+
+struct Result {
+  std::vector<uint64_t> lateness_ns;
+  std::vector<uint64_t> io_ns;
+};
+
+/** @brief Run the loop: sleep to the deadline, read commands, compute, publish telemetry. */
+Result RunLoop(flight::receiver::ICommandReceiver& receiver, flight::telemetry::ITelemetrySink& sink) {
+  Result result;
+  result.lateness_ns.reserve(kTicks);
+  result.io_ns.reserve(kTicks);
+  timespec deadline{};
+  clock_gettime(CLOCK_MONOTONIC, &deadline);
+  float state = 0.0f;
+  for (int tick = 0; tick < kTicks; ++tick) {
+    deadline.tv_nsec += kPeriodNs;
+    if (deadline.tv_nsec >= 1000000000) {
+      deadline.tv_nsec -= 1000000000;
+      ++deadline.tv_sec;
+    }
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr);
+    const uint64_t target = static_cast<uint64_t>(deadline.tv_sec) * 1000000000ull + deadline.tv_nsec;
+    const uint64_t start = flight::bench::NowNs();
+    result.lateness_ns.push_back(start > target ? start - target : 0);
+
+    CommandFrame frames[8];
+    const size_t count = receiver.ReadBatch(frames, 8);
+    const uint64_t after_read = flight::bench::NowNs();
+    // Stand-in for estimator and controller work.
+    for (int i = 0; i < 2000; ++i) {
+      state = state * 0.999f + (count > 0 ? frames[count - 1].channels[0] : 0.001f);
+    }
+    flight::bench::DoNotOptimize(state);
+    flight::telemetry::TelemetrySnapshot snapshot{};
+    snapshot.timestamp_us = target / 1000;
+    const uint64_t before_publish = flight::bench::NowNs();
+    sink.Publish(snapshot);
+    const uint64_t end = flight::bench::NowNs();
+    result.io_ns.push_back((after_read - start) + (end - before_publish));
+  }
+  return result;
+}
+
+uint64_t Percentile(std::vector<uint64_t> values, double p) {
+  std::sort(values.begin(), values.end());
+  return values[static_cast<size_t>(p * (values.size() - 1))];
+}
+
+void Print(const char* name, const Result& result) {
+  char label[80];
+  const char* metrics[] = {"late p50", "late p99", "late max", "I/O p50", "I/O p99", "I/O max"};
+  const std::vector<uint64_t>* series[] = {&result.lateness_ns, &result.io_ns};
+  const double points[] = {0.5, 0.99, 1.0};
+  for (int s = 0; s < 2; ++s) {
+    for (int p = 0; p < 3; ++p) {
+      std::snprintf(label, sizeof(label), "%s %s", name, metrics[s * 3 + p]);
+      flight::bench::Report(label, Percentile(*series[s], points[p]) / 1000.0, "us");
+    }
+  }
+}
+
+Result Inline(uint16_t port, bool flood) {
+  flight::receiver::UdpReceiver receiver({port});
+  flight::telemetry::UdpTelemetrySender sender({"127.0.0.1", 14569, 0});
+  receiver.Initialize();
+  sender.Initialize();
+  Flood traffic(port, flood);
+  return RunLoop(receiver, sender);
+}
+
+Result Reactor(uint16_t port, bool flood) {
+  flight::receiver::UdpReceiver udp({port});
+  flight::telemetry::UdpTelemetrySender sender({"127.0.0.1", 14569, 0});
+  flight::io::ReactorCommandReceiver receiver(udp);
+  flight::io::ReactorTelemetrySink sink(sender);
+  receiver.Initialize();
+  sink.Initialize();
+  flight::io::IoReactor reactor;
+  reactor.Add(&receiver);
+  reactor.Add(&sink);
+  reactor.Start();
+  Flood traffic(port, flood);
+  Result result = RunLoop(receiver, sink);
+  reactor.Stop();
+  return result;
+}
+
+}  // namespace
+
+int main() {
+  Print("inline idle", Inline(14570, false));
+  Print("inline flood", Inline(14571, true));
+  Print("reactor idle", Reactor(14572, false));
+  Print("reactor flood", Reactor(14573, true));
+  return 0;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file bench_lqr_controller.cpp
+ * @brief LQR table lookup + gain product per region, and the full controller tick.
+ */
+
+#include <cmath>
+#include <cstdio>
+
+#include "bench_util.h"
+#include "flight/controllers/lqr_controller.h"
+
+namespace {
+
+using flight::controllers::LqrController;
+
+constexpr uint32_t kIterations = 1000000;
+
+}  // namespace
+
+int main() {
+  LqrController controller;
+  controller.Initialize();
+  flight::controllers::ControlSetpoint setpoint{};
+  float sink = 0.0f;
+  double slowest_ns = 0.0;
+
+  // Each region has a longer lookup than the one before, so the last one
+  // has the slowest mean tick.
+  for (uint8_t region = 0; region < flight::controllers::lqr_tables::kRegions; ++region) {
+    const float speed = region == 0 ? 0.0f
+                                    : flight::controllers::lqr_tables::kRegionSpeed[region - 1] + 0.01f;
+    flight::core::Pose pose{};
+    pose.velocity_mps.x = speed;
+    const uint64_t start = flight::bench::NowNs();
+    for (uint32_t n = 0; n < kIterations; ++n) {
+      pose.position_m.x = static_cast<float>(n & 255) * 1e-3f;
+      pose.position_m.z = -static_cast<float>(n & 127) * 1e-3f;
+      sink += controller.Update(pose, setpoint, 0.01f).motors[n & 3];
+    }
+    const double ns = static_cast<double>(flight::bench::NowNs() - start) / kIterations;
+    slowest_ns = ns > slowest_ns ? ns : slowest_ns;
+    char name[40];
+    std::snprintf(name, sizeof(name), "region %u tick", static_cast<unsigned>(controller.LastRegion()));
+    flight::bench::Report(name, ns, "ns/tick");
+  }
+  flight::bench::Report("slowest region (mean)", slowest_ns, "ns/tick");
+  flight::bench::DoNotOptimize(sink);
+  return 0;
+}
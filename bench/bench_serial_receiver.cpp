@@ -0,0 +1,122 @@
+/**
+ * @file bench_serial_receiver.cpp
+ * @brief CRSF and SBUS parse cost against the wire rate of their links.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "bench_util.h"
+#include "flight/receiver/serial_receiver.h"
+
+namespace {
+
+using flight::receiver::CommandFrame;
+
+constexpr int kSeconds = 20;
+
+/** @brief UART over a prerecorded buffer that hands out fixed-size DMA-style chunks. */
+class MemoryUart final : public flight::hal::IUart {
+ public:
+  explicit MemoryUart(const std::vector<uint8_t>& stream) : stream_(stream) {}
+  bool Write(const uint8_t*, size_t) override { return true; }
+  bool Read(uint8_t* out, size_t length) override { return ReadAvailable(out, length) == length; }
+  size_t ReadAvailable(uint8_t* out, size_t capacity) override {
+    const size_t count = std::min({capacity, limit_ - position_, stream_.size() - position_});
+    std::copy_n(stream_.data() + position_, count, out);
+    position_ += count;
+    return count;
+  }
+  /** @brief Make the next @p bytes visible, as one control tick's worth of arrivals. */
+  void Arrive(size_t bytes) { limit_ = std::min(stream_.size(), limit_ + bytes); }
+  bool Done() const { return position_ == stream_.size(); }
+
+ private:
+  const std::vector<uint8_t>& stream_;
+  size_t position_ = 0;
+  size_t limit_ = 0;
+};
+
+void PackChannels(uint32_t n, uint8_t* packed) {
+  uint64_t bits = 0;
+  uint32_t available = 0;
+  size_t next = 0;
+  for (uint32_t i = 0; i < 16; ++i) {
+    bits |= static_cast<uint64_t>(172 + (n * 37 + i * 101) % 1640) << available;
+    available += 11;
+    while (available >= 8) {
+      packed[next++] = static_cast<uint8_t>(bits);
+      bits >>= 8;
+      available -= 8;
+    }
+  }
+}
+
+std::vector<uint8_t> CrsfStream(size_t bytes) {
+  std::vector<uint8_t> stream;
+  for (uint32_t n = 0; stream.size() < bytes; ++n) {
+    uint8_t frame[26] = {0xC8, 24, flight::receiver::CrsfParser::kRcChannelsPacked};
+    PackChannels(n, frame + 3);
+    frame[25] = flight::receiver::Crc8DvbS2(frame + 2, 23);
+    stream.insert(stream.end(), frame, frame + 26);
+    if (n % 4 == 0) {
+      uint8_t stats[14] = {0xC8, 12, 0x14, 80, 0, 100, 10, 0, 4, 2, 0, 0, 0};
+      stats[13] = flight::receiver::Crc8DvbS2(stats + 2, 11);
+      stream.insert(stream.end(), stats, stats + 14);
+    }
+  }
+  return stream;
+}
+
+std::vector<uint8_t> SbusStream(size_t bytes) {
+  std::vector<uint8_t> stream;
+  for (uint32_t n = 0; stream.size() < bytes; ++n) {
+    uint8_t frame[25] = {flight::receiver::SbusParser::kHeader};
+    PackChannels(n, frame + 1);
+    stream.insert(stream.end(), frame, frame + 25);
+  }
+  return stream;
+}
+
+/** @brief Parse @p stream in 1 kHz ticks; report ns per byte and CPU share of the link. */
+template <typename Receiver>
+void Run(const char* name, const std::vector<uint8_t>& stream, uint32_t bytes_per_second) {
+  MemoryUart uart(stream);
+  Receiver receiver({&uart});
+  receiver.Initialize();
+  const size_t per_tick = bytes_per_second / 1000;
+  float sink = 0.0f;
+  uint32_t frames = 0;
+
+  const uint64_t start = flight::bench::NowNs();
+  while (!uart.Done()) {
+    uart.Arrive(per_tick);
+    CommandFrame frame{};
+    if (receiver.ReadBatch(&frame, 1) == 1) {
+      sink += frame.channels[frame.sequence & 15];
+      ++frames;
+    }
+  }
+  const uint64_t elapsed = flight::bench::NowNs() - start;
+  flight::bench::DoNotOptimize(sink);
+
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s parse", name);
+  flight::bench::Report(label, static_cast<double>(elapsed) / stream.size(), "ns/byte");
+  std::snprintf(label, sizeof(label), "%s CPU at line rate", name);
+  const double wire_ns = 1e9 * stream.size() / bytes_per_second;
+  flight::bench::Report(label, 100.0 * elapsed / wire_ns, "%");
+  std::snprintf(label, sizeof(label), "%s ticks with a frame", name);
+  flight::bench::Report(label, frames, "");
+}
+
+}  // namespace
+
+int main() {
+  // 420 kbaud 8N1 = 42000 B/s; 100 kbaud 8E2 = 8333 B/s.
+  const std::vector<uint8_t> crsf = CrsfStream(42000u * kSeconds);
+  const std::vector<uint8_t> sbus = SbusStream(8333u * kSeconds);
+  Run<flight::receiver::CrsfReceiver>("CRSF 420k", crsf, 42000);
+  Run<flight::receiver::SbusReceiver>("SBUS 100k", sbus, 8333);
+  return 0;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file bench_sliding_dft.cpp
+ * @brief Sliding-DFT analyzer accuracy and cost versus an offline FFT.
+ */
+
+#include <cmath>
+#include <complex>
+#include <cstdlib>
+
+#include "bench_util.h"
+#include "flight/filters/spectrum_analyzer.h"
+
+namespace {
+
+using flight::filters::SpectrumAnalyzer;
+
+constexpr float kPi = 3.14159265f;
+constexpr uint16_t kN = SpectrumAnalyzer::kWindowSize;
+
+/** @brief In-place radix-2 FFT. */
+void Fft(std::complex<float>* data, uint16_t n) {
+  for (uint16_t i = 1, j = 0; i < n; ++i) {
+    uint16_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j) {
+      std::swap(data[i], data[j]);
+    }
+  }
+  for (uint16_t len = 2; len <= n; len <<= 1) {
+    const float angle = -2.0f * kPi / static_cast<float>(len);
+    const std::complex<float> wlen(std::cos(angle), std::sin(angle));
+    for (uint16_t i = 0; i < n; i += len) {
+      std::complex<float> w(1.0f, 0.0f);
+      for (uint16_t k = 0; k < len / 2; ++k) {
+        const auto u = data[i + k];
+        const auto v = data[i + k + len / 2] * w;
+        data[i + k] = u + v;
+        data[i + k + len / 2] = u - v;
+        w *= wlen;
+      }
+    }
+  }
+}
+
+/** @brief Dominant frequency of a Hann-windowed FFT over the last window. */
+float OfflinePeakHz(const float* window, float rate_hz, float min_hz, float max_hz) {
+  std::complex<float> data[kN];
+  for (uint16_t i = 0; i < kN; ++i) {
+    const float w = 0.5f - 0.5f * std::cos(2.0f * kPi * static_cast<float>(i) / kN);
+    data[i] = window[i] * w;
+  }
+  Fft(data, kN);
+  float best = 0.0f;
+  uint16_t best_k = 1;
+  for (uint16_t k = 1; k < kN / 2 - 1; ++k) {
+    const float hz = static_cast<float>(k) * rate_hz / kN;
+    if (hz < min_hz || hz > max_hz) {
+      continue;
+    }
+    if (std::abs(data[k]) > best) {
+      best = std::abs(data[k]);
+      best_k = k;
+    }
+  }
+  const float l = std::abs(data[best_k - 1]);
+  const float m = std::abs(data[best_k]);
+  const float r = std::abs(data[best_k + 1]);
+  const float denom = l - 2.0f * m + r;
+  const float offset = denom < 0.0f ? 0.5f * (l - r) / denom : 0.0f;
+  return (static_cast<float>(best_k) + offset) * rate_hz / kN;
+}
+
+}  // namespace
+
+int main() {
+  constexpr uint32_t kSamples = 200000;
+  SpectrumAnalyzer::Config config{};
+  SpectrumAnalyzer analyzer(config);
+  analyzer.Initialize();
+
+  float window[kN] = {};
+  double sdft_error_hz = 0.0;
+  double fft_error_hz = 0.0;
+  uint32_t checks = 0;
+  uint64_t sdft_ns = 0;
+  uint64_t fft_ns = 0;
+  float phase = 0.0f;
+  std::srand(1);
+
+  for (uint32_t n = 0; n < kSamples; ++n) {
+    // Slowly sweeping thruster tone plus a weaker fixed tone and noise.
+    const float tone_hz = 120.0f + 80.0f * std::sin(2.0f * kPi * static_cast<float>(n) / kSamples);
+    const float t = static_cast<float>(n) / config.sample_rate_hz;
+    phase = std::fmod(phase + 2.0f * kPi * tone_hz / config.sample_rate_hz, 2.0f * kPi);
+    const float noise = (static_cast<float>(std::rand()) / RAND_MAX - 0.5f) * 0.1f;
+    const float x = std::sin(phase) + 0.3f * std::sin(2.0f * kPi * 310.0f * t) + noise;
+    window[n % kN] = x;
+
+    const uint64_t start = flight::bench::NowNs();
+    analyzer.Push({x, x, x});
+    sdft_ns += flight::bench::NowNs() - start;
+
+    if (n > kN && (n % 997) == 0) {
+      float ordered[kN];
+      for (uint16_t i = 0; i < kN; ++i) {
+        ordered[i] = window[(n + 1 + i) % kN];
+      }
+      const uint64_t fft_start = flight::bench::NowNs();
+      const float fft_hz = OfflinePeakHz(ordered, config.sample_rate_hz, config.min_hz, config.max_hz);
+      fft_ns += flight::bench::NowNs() - fft_start;
+
+      analyzer.UpdateAllPeaks();
+      sdft_error_hz += std::fabs(analyzer.DominantHz(0) - tone_hz);
+      fft_error_hz += std::fabs(fft_hz - tone_hz);
+      ++checks;
+    }
+  }
+
+  flight::bench::Report("sdft push (3 axes)", static_cast<double>(sdft_ns) / kSamples, "ns/sample");
+  flight::bench::Report("offline fft (1 axis, per window)",
+                        static_cast<double>(fft_ns) / checks, "ns/window");
+  flight::bench::Report("sdft mean |peak error|", sdft_error_hz / checks, "Hz");
+  flight::bench::Report("offline fft mean |peak error|", fft_error_hz / checks, "Hz");
+  flight::bench::Report("bin resolution", analyzer.BinHz(), "Hz");
+  return 0;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file bench_telemetry_batching.cpp
+ * @brief Cost, syscalls and bytes per sample: one v3 packet per snapshot vs batched delta v4.
+ */
+
+#include <cmath>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "bench_util.h"
+#include "flight/telemetry/udp_telemetry.h"
+
+namespace {
+
+constexpr uint32_t kSamples = 50000;
+constexpr uint16_t kPort = 14566;
+
+flight::telemetry::TelemetrySnapshot Sample(uint32_t n) {
+  flight::telemetry::TelemetrySnapshot s;
+  const float t = static_cast<float>(n) * 0.001f;
+  s.timestamp_us = 1000000 + n * 1000ull;
+  s.pose.orientation = {std::cos(0.1f * t), 0.0f, 0.0f, std::sin(0.1f * t)};
+  s.pose.angular_velocity_rps = {0.02f * std::sin(50 * t), 0.02f * std::cos(50 * t), 0.1f};
+  s.pose.position_m = {0.5f * t, 0.0f, -10.0f};
+  s.pose.velocity_mps = {0.5f, 0.0f, 0.0f};
+  s.setpoint.velocity_mps = {0.5f, 0.0f, 0.0f};
+  s.output.motor_count = 4;
+  for (int i = 0; i < 4; ++i) {
+    s.output.motors[i] = 0.4f + 0.02f * std::sin(30 * t + i);
+  }
+  s.armed = true;
+  s.command_sequence = n / 20;
+  s.actuator_write_us = s.timestamp_us + 120;
+  return s;
+}
+
+void Run(const char* name, const flight::telemetry::UdpTelemetrySender::Config& config) {
+  flight::telemetry::UdpTelemetrySender sender(config);
+  sender.Initialize();
+  const uint64_t start = flight::bench::NowNs();
+  for (uint32_t n = 0; n < kSamples; ++n) {
+    sender.Publish(Sample(n));
+  }
+  sender.Flush();
+  const uint64_t elapsed = flight::bench::NowNs() - start;
+
+  char label[80];
+  std::snprintf(label, sizeof(label), "%s publish", name);
+  flight::bench::Report(label, static_cast<double>(elapsed) / kSamples, "ns/sample");
+  std::snprintf(label, sizeof(label), "%s syscalls", name);
+  flight::bench::Report(label, static_cast<double>(sender.Syscalls()) / kSamples, "per sample");
+  std::snprintf(label, sizeof(label), "%s payload", name);
+  flight::bench::Report(label, static_cast<double>(sender.BytesSent()) / kSamples, "B/sample");
+}
+
+}  // namespace
+
+int main() {
+  // A bound but unread socket: the kernel discards overflow silently.
+  const int sink = ::socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(kPort);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  ::bind(sink, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+
+  flight::telemetry::UdpTelemetrySender::Config config;
+  config.port = kPort;
+  config.rate_hz = 0;
+  Run("v3 per sample", config);
+  config.batch_frames = 10;
+  config.flush_datagrams = 1;
+  Run("v4 batch 10", config);
+  config.batch_frames = 20;
+  config.flush_datagrams = 4;
+  Run("v4 batch 20 x4", config);
+  ::close(sink);
+  return 0;
+}
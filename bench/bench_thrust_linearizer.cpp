@@ -0,0 +1,70 @@
+/**
+ * @file bench_thrust_linearizer.cpp
+ * @brief Thrust linearization cost for 8 channels: per-tick pow vs lookup table.
+ */
+
+#include <cmath>
+
+#include "bench_util.h"
+#include "flight/actuators/thrust_linearizer.h"
+
+namespace {
+
+using flight::actuators::ThrustLinearizer;
+
+constexpr uint32_t kTicks = 2000000;
+constexpr uint8_t kChannels = 8;
+
+/** @brief Direct inverse evaluated every tick (the approach the tables replace). */
+void DirectInverse(const ThrustLinearizer::Config& config, float voltage_scale, const float* thrust,
+                   float* command) {
+  for (uint8_t i = 0; i < kChannels; ++i) {
+    const float magnitude = std::fabs(thrust[i]) * voltage_scale;
+    if (magnitude < config.zero_threshold) {
+      command[i] = 0.0f;
+      continue;
+    }
+    const bool reverse = thrust[i] < 0.0f;
+    const float fraction =
+        std::fmin(reverse ? magnitude / config.reverse_max : magnitude, 1.0f);
+    const float exponent = reverse ? config.reverse_exponent : config.forward_exponent;
+    const float value = config.deadband + (1.0f - config.deadband) * std::pow(fraction, 1.0f / exponent);
+    command[i] = reverse ? -value : value;
+  }
+}
+
+double NsPerTick(uint64_t elapsed_ns) {
+  return static_cast<double>(elapsed_ns) / kTicks;
+}
+
+}  // namespace
+
+int main() {
+  ThrustLinearizer linearizer;
+  float thrust[kChannels];
+  float command[kChannels];
+  float sink = 0.0f;
+
+  uint64_t start = flight::bench::NowNs();
+  for (uint32_t n = 0; n < kTicks; ++n) {
+    for (uint8_t i = 0; i < kChannels; ++i) {
+      thrust[i] = static_cast<float>((n * 7 + i * 131) & 1023) / 512.0f - 1.0f;
+    }
+    DirectInverse(linearizer.GetConfig(), 1.0f, thrust, command);
+    sink += command[n & 7];
+  }
+  flight::bench::Report("pow per motor, 8 ch", NsPerTick(flight::bench::NowNs() - start), "ns/tick");
+
+  start = flight::bench::NowNs();
+  for (uint32_t n = 0; n < kTicks; ++n) {
+    for (uint8_t i = 0; i < kChannels; ++i) {
+      thrust[i] = static_cast<float>((n * 7 + i * 131) & 1023) / 512.0f - 1.0f;
+    }
+    linearizer.Apply(thrust, command, kChannels);
+    sink += command[n & 7];
+  }
+  flight::bench::Report("lookup table, 8 ch", NsPerTick(flight::bench::NowNs() - start), "ns/tick");
+
+  flight::bench::DoNotOptimize(sink);
+  return 0;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace flight::bench {
+
+/** @brief Monotonic time in nanoseconds. */
+inline uint64_t NowNs() {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now().time_since_epoch())
+                                   .count());
+}
+
+/** @brief Keep the optimizer from discarding a benchmarked value. */
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/** @brief Print one result line as `name: value unit`. */
+inline void Report(const char* name, double value, const char* unit) {
+  std::printf("%-40s %12.2f %s\n", name, value, unit);
+}
+
+}  // namespace flight::bench
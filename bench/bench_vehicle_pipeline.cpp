@@ -0,0 +1,110 @@
+/**
+ * @file bench_vehicle_pipeline.cpp
+ * @brief Ticks per second: interface-based Rov4Vehicle vs StaticRovPipeline.
+ */
+
+#include "bench_util.h"
+#include "flight/controllers/rov_controller.h"
+#include "flight/vehicle/rov4_vehicle.h"
+#include "flight/vehicle/static_rov_pipeline.h"
+
+namespace {
+
+constexpr uint32_t kTicks = 2000000;
+
+/** @brief One armed-stick frame per tick. */
+class BenchReceiver final : public flight::receiver::ICommandReceiver {
+ public:
+  bool Initialize() override { return true; }
+  std::optional<flight::receiver::CommandFrame> Read() override {
+    if (pending_ == 0) {
+      return std::nullopt;
+    }
+    --pending_;
+    flight::receiver::CommandFrame frame{};
+    frame.channel_count = 3;
+    frame.channels[0] = 0.05f;
+    frame.channels[1] = 1.0f;
+    return frame;
+  }
+  void Arm() { pending_ = 1; }
+
+ private:
+  int pending_ = 0;
+};
+
+class BenchEstimator final : public flight::estimators::IStateEstimator {
+ public:
+  bool Initialize() override { return true; }
+  flight::estimators::EstimatorOutput Update(const flight::estimators::EstimatorInput&) override {
+    flight::estimators::EstimatorOutput output{};
+    output.timestamp_us = ++timestamp_us_;
+    return output;
+  }
+
+ private:
+  uint64_t timestamp_us_ = 0;
+};
+
+class BenchOutput final : public flight::actuators::IActuatorOutput {
+ public:
+  bool Initialize() override { return true; }
+  bool Write(const flight::actuators::ActuatorCommand* commands, uint8_t count) override {
+    sum += commands[count - 1].value;
+    return true;
+  }
+  float sum = 0.0f;
+};
+
+class BenchSink final : public flight::telemetry::ITelemetrySink {
+ public:
+  bool Initialize() override { return true; }
+  void Publish(const flight::telemetry::TelemetrySnapshot& snapshot) override {
+    published += snapshot.armed ? 1u : 0u;
+  }
+  uint32_t published = 0;
+};
+
+template <typename Vehicle>
+void Run(const char* name, Vehicle& vehicle, BenchReceiver& receiver) {
+  vehicle.Initialize();
+  const uint64_t start = flight::bench::NowNs();
+  for (uint32_t n = 0; n < kTicks; ++n) {
+    receiver.Arm();
+    vehicle.Update(0.001f);
+  }
+  const double seconds = static_cast<double>(flight::bench::NowNs() - start) * 1e-9;
+  flight::bench::Report(name, kTicks / seconds / 1e6, "M ticks/s");
+}
+
+}  // namespace
+
+int main() {
+  BenchReceiver receiver;
+  BenchEstimator estimator;
+  flight::controllers::RovController controller({});
+  BenchOutput output;
+  BenchSink sink;
+
+  flight::vehicle::VehicleDependencies deps;
+  deps.estimator = &estimator;
+  deps.controller = &controller;
+  deps.actuators = &output;
+  deps.receiver = &receiver;
+  deps.telemetry_sink = &sink;
+  flight::vehicle::VehicleRegistry registry;
+  auto vehicle = registry.Create(flight::vehicle::VehicleType::kRov4Thruster, deps);
+  Run("Rov4Vehicle (virtual)", *vehicle, receiver);
+
+  flight::vehicle::StaticRovPipeline<BenchEstimator, flight::controllers::RovController,
+                                     BenchOutput, BenchReceiver, flight::vehicle::NoImu, BenchSink>
+      pipeline(estimator, controller, output, receiver, nullptr, &sink);
+  Run("StaticRovPipeline + sink", pipeline, receiver);
+
+  flight::vehicle::StaticRovPipeline lean(estimator, controller, output, receiver);
+  Run("StaticRovPipeline, no sink", lean, receiver);
+
+  flight::bench::DoNotOptimize(output.sum);
+  flight::bench::DoNotOptimize(sink.published);
+  return 0;
+}
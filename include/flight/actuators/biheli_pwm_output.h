@@ -1,36 +1,53 @@
 #pragma once
 
 #include "flight/actuators/actuators.h"
+#include "flight/actuators/pulse_mapping.h"
+#include "flight/actuators/pwm_slices.h"
+#include "flight/hal/hal.h"
 
 namespace flight::actuators {
 
 /**
  * @brief Biheli PWM output (bidirectional ESC).
  *
- * Normalized command [-1, 1] is mapped to PWM microseconds.
+ * Normalized command [-1, 1] is mapped to PWM microseconds. With a PWM HAL
+ * each channel runs on a hardware slice; all slices share one period and
+ * latch new pulses together at the end of the frame.
  */
 class BiheliPwmOutput final : public IActuatorOutput {
  public:
+  static constexpr uint8_t kMaxChannels = PwmSlicePlan::kMaxChannels;
+
   /** @brief Pulse width configuration. */
   struct Config {
     float min_pulse_us = 1100.0f;
     float max_pulse_us = 1900.0f;
     float neutral_pulse_us = 1500.0f;
+    /** @brief Pulse frame rate; up to 490 Hz for ESCs that accept it. */
+    float update_rate_hz = 50.0f;
+    uint8_t channel_count = 4;
+    uint32_t pins[kMaxChannels] = {0};
   };
 
-  /** @brief Construct with PWM config. */
-  explicit BiheliPwmOutput(const Config& config);
+  /** @brief Construct with PWM config; @p pwm drives the pins when set. */
+  explicit BiheliPwmOutput(const Config& config, hal::IPwm* pwm = nullptr);
 
-  bool Initialize() override { return true; }
+  /** @brief Plan slices and start neutral pulses (no-op without a PWM HAL). */
+  bool Initialize() override;
   /** @brief Write actuator commands. */
   bool Write(const ActuatorCommand* commands, uint8_t count) override;
 
   /** @brief Last mapped pulse width for diagnostics. */
   float PulseUs(uint8_t index) const { return last_pulse_us_[index]; }
+  /** @brief Slice timing chosen by Initialize(). */
+  const PwmTiming& Timing() const { return driver_.Timing(); }
 
  private:
   Config config_{};
-  float last_pulse_us_[8] = {};
+  hal::IPwm* pwm_ = nullptr;
+  PulseRange range_{};
+  PwmSliceDriver driver_{};
+  float last_pulse_us_[kMaxChannels] = {};
   uint8_t last_count_ = 0;
 };
 
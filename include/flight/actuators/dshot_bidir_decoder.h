@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+#include "flight/actuators/telemetry.h"
+
+namespace flight::actuators {
+
+/** @brief Line bits in a bidirectional DShot response (start bit + 20 GCR bits). */
+constexpr uint8_t kDshotResponseBits = 21;
+
+namespace dshot_detail {
+
+/** @brief GCR quintet for each nibble. */
+inline constexpr std::array<uint8_t, 16> kGcrEncode = {0x19, 0x1B, 0x12, 0x13, 0x1D, 0x15,
+                                                       0x16, 0x17, 0x1A, 0x09, 0x0A, 0x0B,
+                                                       0x1E, 0x0D, 0x0E, 0x0F};
+
+/** @brief Inverse of kGcrEncode; 0xFF marks quintets that are not valid GCR. */
+constexpr std::array<uint8_t, 32> MakeGcrDecodeTable() {
+  std::array<uint8_t, 32> table{};
+  for (auto& entry : table) {
+    entry = 0xFF;
+  }
+  for (uint8_t nibble = 0; nibble < 16; ++nibble) {
+    table[kGcrEncode[nibble]] = nibble;
+  }
+  return table;
+}
+
+inline constexpr std::array<uint8_t, 32> kGcrDecode = MakeGcrDecodeTable();
+
+}  // namespace dshot_detail
+
+/**
+ * @brief Decoder for bidirectional DShot eRPM responses.
+ *
+ * The ESC answers each inverted command frame with 21 bits at 5/4 of the
+ * command bit rate: a low start bit followed by the NRZI-encoded GCR form
+ * of `eee mmmmmmmmm cccc` (period code plus inverted nibble checksum).
+ * Sample streams are oversampled line levels, LSB first in each word, as
+ * shifted in by the `dshot_telem_rx` PIO program.
+ */
+class DshotBidirDecoder {
+ public:
+  static constexpr uint8_t kMaxChannels = 8;
+
+  struct Config {
+    /** @brief Samples per command bit; a response bit is 4/5 of that. */
+    uint8_t samples_per_bit = 10;
+    uint8_t motor_pole_count = 14;
+  };
+
+  /** @brief Latest decoded state of one motor. */
+  struct ChannelState {
+    uint16_t period_code = 0;
+    uint32_t erpm = 0;
+    uint32_t rpm = 0;
+    uint32_t frames = 0;
+    uint32_t errors = 0;
+    bool valid = false;
+  };
+
+  DshotBidirDecoder();
+  explicit DshotBidirDecoder(const Config& config);
+
+  /**
+   * @brief Recover the 21 response line bits from an oversampled stream.
+   *
+   * Walks level runs with count-trailing-zeros from the first falling edge
+   * and rounds each run to whole bits; the final high run may merge with
+   * the idle line and is padded out.
+   */
+  static std::optional<uint32_t> ExtractLineBits(const uint32_t* words,
+                                                 uint16_t sample_count,
+                                                 uint8_t samples_per_bit);
+
+  /** @brief Undo NRZI and GCR; returns the 16-bit value or nullopt on a bad quintet. */
+  static std::optional<uint16_t> DecodeLineBits(uint32_t line_bits);
+
+  /** @brief True if the inverted nibble checksum of a response matches. */
+  static bool ChecksumOk(uint16_t value);
+
+  /**
+   * @brief Decode one captured response and update the channel state.
+   *
+   * Returns false if no frame could be recovered; @p frame still reports
+   * the channel with `crc_ok` cleared on checksum failures.
+   */
+  bool Decode(uint8_t channel, const uint32_t* words, uint16_t sample_count,
+              DshotTelemetryFrame& frame);
+
+  /** @brief Decode already recovered line bits (nullopt counts as an error). */
+  bool Accept(uint8_t channel, const std::optional<uint32_t>& line_bits,
+              DshotTelemetryFrame& frame);
+
+  const ChannelState& State(uint8_t channel) const { return states_[channel]; }
+  uint32_t Rpm(uint8_t channel) const { return states_[channel].rpm; }
+  const Config& GetConfig() const { return config_; }
+
+ private:
+  Config config_{};
+  ChannelState states_[kMaxChannels]{};
+};
+
+}  // namespace flight::actuators
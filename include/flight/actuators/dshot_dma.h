@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+
+#include "flight/actuators/dshot_encoder.h"
+
+namespace flight::actuators {
+
+/** @brief DShot special commands (sent in the throttle field, 0-47). */
+enum class DshotCommand : uint8_t {
+  kMotorStop = 0,
+  kBeep1 = 1,
+  kBeep2 = 2,
+  kBeep3 = 3,
+  kBeep4 = 4,
+  kBeep5 = 5,
+  kEscInfo = 6,
+  kSpinDirection1 = 7,
+  kSpinDirection2 = 8,
+  k3dModeOff = 9,
+  k3dModeOn = 10,
+  kSaveSettings = 12,
+  kExtendedTelemetryEnable = 13,
+  kExtendedTelemetryDisable = 14,
+  kSpinDirectionNormal = 20,
+  kSpinDirectionReversed = 21,
+};
+
+/**
+ * @brief Fixed-size queue of special commands interleaved with throttle.
+ *
+ * Only the channels named in a command's mask are taken over, for as many
+ * frames as the command needs; every other channel keeps its throttle frame.
+ */
+class DshotCommandQueue {
+ public:
+  static constexpr uint8_t kCapacity = 8;
+
+  /** @brief Queue a command for the channels in @p channel_mask. */
+  bool Push(uint8_t channel_mask, DshotCommand command);
+
+  /**
+   * @brief Replace frames of the channels owned by the head command.
+   *
+   * Advances the head command by one frame and pops it once done.
+   */
+  void Apply(uint16_t* packets, uint8_t count, bool bidirectional);
+
+  bool Empty() const { return size_ == 0; }
+  uint8_t Size() const { return size_; }
+
+  /** @brief Frames a command must be repeated for the ESC to accept it. */
+  static uint8_t RepeatCount(DshotCommand command);
+
+ private:
+  struct Entry {
+    uint8_t channel_mask = 0;
+    DshotCommand command = DshotCommand::kMotorStop;
+    uint8_t remaining = 0;
+  };
+
+  Entry entries_[kCapacity]{};
+  uint8_t head_ = 0;
+  uint8_t size_ = 0;
+};
+
+/** @brief One DMA transfer into a PIO TX FIFO. */
+struct DshotDmaTransfer {
+  uint8_t state_machine = 0;
+  uint8_t word_offset = 0;
+  uint8_t word_count = 0;
+};
+
+/**
+ * @brief Encoded frame plus the DMA transfers that push it to PIO.
+ *
+ * Parallel mode is one transfer of the bit-transposed stream to a single
+ * state machine; serial mode is one transfer per channel state machine.
+ * All transfers are started together with one channel-mask trigger.
+ */
+struct DshotDmaFrame {
+  static constexpr uint8_t kMaxSerialChannels = 4;
+  static constexpr uint8_t kMaxWords = kDshotParallelWords > kMaxSerialChannels * kDshotSerialWords
+                                           ? kDshotParallelWords
+                                           : kMaxSerialChannels * kDshotSerialWords;
+
+  uint32_t words[kMaxWords] = {};
+  DshotDmaTransfer transfers[kMaxSerialChannels]{};
+  uint8_t transfer_count = 0;
+
+  /** @brief Lay out per-channel words for one state machine per channel. */
+  bool BuildSerial(const uint16_t* packets, uint8_t count, const uint8_t* state_machines);
+  /** @brief Lay out one bit-transposed stream for a single state machine. */
+  bool BuildParallel(const uint16_t* packets, uint8_t count, uint8_t state_machine);
+};
+
+}  // namespace flight::actuators
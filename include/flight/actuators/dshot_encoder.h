@@ -0,0 +1,149 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "flight/actuators/actuators.h"
+
+namespace flight::actuators {
+
+/** @brief DShot bit rate in kbit/s. */
+enum class DshotSpeed : uint32_t {
+  k150 = 150,
+  k300 = 300,
+  k600 = 600,
+  k1200 = 1200,
+};
+
+/** @brief PIO ticks per DShot bit (symbol `110` for 1, `100` for 0). */
+constexpr uint8_t kDshotSymbolTicks = 3;
+/** @brief Bits per DShot frame. */
+constexpr uint8_t kDshotFrameBits = 16;
+/** @brief Ticks carrying frame data. */
+constexpr uint16_t kDshotFrameTicks = kDshotFrameBits * kDshotSymbolTicks;
+/** @brief 32-bit FIFO words per channel for single-pin output (48 data + 16 idle ticks). */
+constexpr uint8_t kDshotSerialWords = 2;
+/** @brief Maximum channels carried by one bit-transposed frame. */
+constexpr uint8_t kDshotParallelLanes = 8;
+/** @brief 32-bit FIFO words per bit-transposed frame (4 ticks per word, 16 idle ticks). */
+constexpr uint8_t kDshotParallelWords = (kDshotFrameTicks + 16) / 4;
+
+namespace dshot_detail {
+
+/** @brief XOR of the two nibbles of a byte. */
+constexpr std::array<uint8_t, 256> MakeNibbleXorTable() {
+  std::array<uint8_t, 256> table{};
+  for (uint32_t i = 0; i < 256; ++i) {
+    table[i] = static_cast<uint8_t>((i ^ (i >> 4)) & 0xF);
+  }
+  return table;
+}
+
+/**
+ * @brief Expand 8 packet bits (MSB first) into 24 PIO ticks (LSB first).
+ *
+ * PIO shifts right, so tick n of the waveform sits at bit n of the word.
+ */
+constexpr std::array<uint32_t, 256> MakeSymbolTable() {
+  std::array<uint32_t, 256> table{};
+  for (uint32_t value = 0; value < 256; ++value) {
+    uint32_t ticks = 0;
+    for (uint32_t bit = 0; bit < 8; ++bit) {
+      const bool set = (value >> (7 - bit)) & 0x1;
+      const uint32_t symbol = set ? 0b011u : 0b001u;  // tick order: high, data, low
+      ticks |= symbol << (bit * kDshotSymbolTicks);
+    }
+    table[value] = ticks;
+  }
+  return table;
+}
+
+/**
+ * @brief Transpose an 8x8 bit matrix stored row-major in a 64-bit word.
+ *
+ * Bit `8 * r + c` moves to bit `8 * c + r`.
+ */
+constexpr uint64_t Transpose8x8(uint64_t x) {
+  uint64_t t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAull;
+  x = x ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCull;
+  x = x ^ t ^ (t << 14);
+  t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ull;
+  x = x ^ t ^ (t << 28);
+  return x;
+}
+
+inline constexpr std::array<uint8_t, 256> kNibbleXor = MakeNibbleXorTable();
+inline constexpr std::array<uint32_t, 256> kSymbolTicks = MakeSymbolTable();
+
+}  // namespace dshot_detail
+
+/**
+ * @brief Table-driven DShot frame encoder shared by all DShot outputs.
+ *
+ * Produces either one FIFO word pair per pin (one state machine per channel)
+ * or a bit-transposed tick stream where each byte drives up to 8 consecutive
+ * pins from a single state machine (`out pins, 8`).
+ */
+class DshotEncoder {
+ public:
+  /** @brief Encoder configuration. */
+  struct Config {
+    DshotSpeed speed = DshotSpeed::k300;
+    uint16_t min_throttle = 48;
+    uint16_t max_throttle = 2047;
+    bool enable_telemetry = false;
+    /** @brief Bidirectional DShot uses an inverted checksum. */
+    bool bidirectional = false;
+  };
+
+  DshotEncoder();
+  explicit DshotEncoder(const Config& config);
+
+  /** @brief 4-bit DShot checksum of the 12-bit data field. */
+  static constexpr uint16_t Checksum(uint16_t data, bool inverted = false) {
+    const uint16_t csum = static_cast<uint16_t>(dshot_detail::kNibbleXor[data & 0xFF] ^
+                                                ((data >> 8) & 0xF));
+    return inverted ? static_cast<uint16_t>(~csum & 0xF) : csum;
+  }
+
+  /** @brief Pack an 11-bit throttle (or command) and telemetry bit into a frame. */
+  static constexpr uint16_t PackFrame(uint16_t throttle, bool telemetry, bool inverted = false) {
+    const uint16_t data = static_cast<uint16_t>(((throttle & 0x7FF) << 1) | (telemetry ? 1 : 0));
+    return static_cast<uint16_t>((data << 4) | Checksum(data, inverted));
+  }
+
+  /** @brief Map a normalized [-1, 1] command onto the throttle range. */
+  static uint16_t ValueToThrottle(float value, uint16_t min_throttle, uint16_t max_throttle);
+
+  /** @brief PIO clock divider that yields kDshotSymbolTicks ticks per bit. */
+  static float ClockDivider(uint32_t sys_clock_hz, DshotSpeed speed);
+
+  /** @brief Expand one frame into single-pin FIFO words. */
+  static void EncodeSerial(uint16_t packet, uint32_t (&words)[kDshotSerialWords]) {
+    const uint32_t hi = dshot_detail::kSymbolTicks[packet >> 8];
+    const uint32_t lo = dshot_detail::kSymbolTicks[packet & 0xFF];
+    words[0] = hi | (lo << 24);
+    words[1] = lo >> 8;
+  }
+
+  /**
+   * @brief Expand up to 8 frames into one bit-transposed tick stream.
+   *
+   * Byte n of the stream is tick n; bit c of that byte is the level of lane c.
+   */
+  static void EncodeParallel(const uint16_t* packets,
+                             uint8_t count,
+                             uint32_t (&words)[kDshotParallelWords]);
+
+  /** @brief Convert commands to frames for every channel in one pass. */
+  void PackAll(const ActuatorCommand* commands, uint8_t count, uint16_t* packets) const;
+
+  const Config& GetConfig() const { return config_; }
+
+ private:
+  Config config_{};
+};
+
+}  // namespace flight::actuators
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "flight/actuators/actuators.h"
+#include "flight/actuators/dshot_dma.h"
+#include "flight/actuators/dshot_encoder.h"
 
 namespace flight::actuators {
 
@@ -19,16 +21,20 @@ class DshotOutput final : public IActuatorOutput {
   bool Write(const ActuatorCommand* commands, uint8_t count) override;
 
   static uint16_t PackCommand(uint16_t throttle, bool telemetry) {
-    const uint16_t data =
-        static_cast<uint16_t>((throttle << 1) | (telemetry ? 1 : 0));
-    const uint16_t csum = (data ^ (data >> 4) ^ (data >> 8)) & 0xF;
-    return static_cast<uint16_t>((data << 4) | csum);
+    return DshotEncoder::PackFrame(throttle, telemetry);
   }
 
- private:
-  uint16_t ValueToThrottle(float value) const;
+  /** @brief Queue a special command for the channels in @p channel_mask. */
+  bool QueueCommand(uint8_t channel_mask, DshotCommand command) {
+    return commands_.Push(channel_mask, command);
+  }
 
+  /** @brief Last encoded frame of a channel. */
+  uint16_t Packet(uint8_t index) const { return last_packets_[index]; }
+
+ private:
   Config config_{};
+  DshotCommandQueue commands_{};
   ActuatorCommand last_commands_[8] = {};
   uint16_t last_packets_[8] = {};
   uint8_t last_count_ = 0;
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "flight/actuators/dshot_bidir_decoder.h"
+#include "flight/actuators/telemetry.h"
+
+namespace flight::actuators {
+
+/** @brief Telemetry for every motor, refreshed once per control tick. */
+struct DshotTelemetryTable {
+  static constexpr uint8_t kMaxChannels = DshotBidirDecoder::kMaxChannels;
+
+  DshotTelemetryFrame frames[kMaxChannels]{};
+  /** @brief Bit per channel that received a new frame this tick. */
+  uint8_t updated_mask = 0;
+};
+
+/**
+ * @brief Bit-sliced bidirectional DShot decoder for up to 8 pins at once.
+ *
+ * Input is a ring of sample bytes from an `in pins, 8` capture: byte n holds
+ * sample n of all 8 lanes. A response window is de-interleaved with 8x8 bit
+ * transposes into per-lane sample words, and each response bit is the
+ * popcount majority of its sample window.
+ *
+ * The pins also carry the host's own command frames. With `skip_tx_frame`
+ * the first burst after idle is taken as the command and skipped; the next
+ * burst within the turnaround timeout is decoded as its response.
+ */
+class DshotSlicedDecoder {
+ public:
+  static constexpr uint8_t kLanes = 8;
+  /** @brief Samples decoded per response; leaves headroom for skew between ESCs. */
+  static constexpr uint16_t kWindowSamples = 256;
+  static constexpr uint16_t kWindowWords = kWindowSamples / 32;
+
+  struct Config {
+    uint8_t samples_per_bit = 10;
+    uint8_t motor_pole_count = 14;
+    uint8_t channel_count = 4;
+    /** @brief Sample-byte bit carrying each channel. */
+    uint8_t lanes[kLanes] = {0, 1, 2, 3, 4, 5, 6, 7};
+    /** @brief Skip the 16-bit command frame that precedes each response. */
+    bool skip_tx_frame = true;
+    /** @brief Command bits after a command frame within which the response must start. */
+    uint8_t response_timeout_bits = 20;
+  };
+
+  DshotSlicedDecoder();
+  explicit DshotSlicedDecoder(const Config& config);
+
+  /**
+   * @brief Decode every complete response between two ring positions.
+   *
+   * Idle samples are skipped for all lanes with one mask test per byte.
+   * Returns the new read index; an incomplete response is left in place
+   * and the command-frame gate carries over to the next call.
+   */
+  uint16_t Process(const uint8_t* ring, uint16_t ring_size, uint16_t read_index,
+                   uint16_t write_index, DshotTelemetryTable& table);
+
+  /** @brief Forget the gate state after the caller skipped samples; the next burst is a command. */
+  void Resync();
+
+  /** @brief Decode one window of kWindowSamples bytes starting at a response. */
+  void DecodeWindow(const uint8_t* window, DshotTelemetryTable& table);
+
+  /** @brief Split interleaved sample bytes into LSB-first sample words per lane. */
+  static void Deinterleave(const uint8_t* window, uint32_t (&lane_words)[kLanes][kWindowWords]);
+
+  /** @brief Recover 21 line bits by popcount majority over each bit window. */
+  static std::optional<uint32_t> MajorityLineBits(const uint32_t* words,
+                                                  uint16_t sample_count,
+                                                  uint8_t samples_per_bit);
+
+  const DshotBidirDecoder::ChannelState& State(uint8_t channel) const {
+    return decoder_.State(channel);
+  }
+  uint32_t Rpm(uint8_t channel) const { return decoder_.Rpm(channel); }
+  /** @brief Command frames no ESC answered within the timeout (not decode errors). */
+  uint32_t MissedResponses() const { return missed_responses_; }
+
+ private:
+  enum class Gate : uint8_t { kAwaitCommand, kSkipCommand, kAwaitResponse };
+
+  Config config_{};
+  DshotBidirDecoder decoder_{};
+  uint8_t lane_mask_ = 0;
+  uint16_t command_samples_ = 0;
+  uint16_t timeout_samples_ = 0;
+  Gate gate_ = Gate::kAwaitCommand;
+  uint16_t gate_remaining_ = 0;
+  uint32_t missed_responses_ = 0;
+};
+
+}  // namespace flight::actuators
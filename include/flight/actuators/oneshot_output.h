@@ -0,0 +1,72 @@
+#pragma once
+
+#include "flight/actuators/actuators.h"
+#include "flight/actuators/pulse_mapping.h"
+#include "flight/actuators/pwm_slices.h"
+#include "flight/hal/hal.h"
+
+namespace flight::actuators {
+
+/** @brief Short-pulse analog ESC protocols. */
+enum class OneShotProtocol : uint8_t {
+  kOneShot125,  ///< 125-250 us
+  kOneShot42,   ///< 42-84 us
+  kMultiShot,   ///< 5-25 us
+};
+
+/** @brief Pulse range of a protocol, with the 3D-mode neutral at the midpoint. */
+constexpr PulseRange OneShotPulseRange(OneShotProtocol protocol) {
+  switch (protocol) {
+    case OneShotProtocol::kOneShot42:
+      return {42.0f, 84.0f, 63.0f};
+    case OneShotProtocol::kMultiShot:
+      return {5.0f, 25.0f, 15.0f};
+    case OneShotProtocol::kOneShot125:
+    default:
+      return {125.0f, 250.0f, 187.5f};
+  }
+}
+
+/**
+ * @brief OneShot125 / OneShot42 / MultiShot output on hardware PWM slices.
+ *
+ * Uses the same pulse mapping and slice driver as BiheliPwmOutput; only
+ * the pulse range and a much higher frame rate differ.
+ */
+class OneShotOutput final : public IActuatorOutput {
+ public:
+  static constexpr uint8_t kMaxChannels = PwmSlicePlan::kMaxChannels;
+
+  struct Config {
+    OneShotProtocol protocol = OneShotProtocol::kOneShot125;
+    /** @brief Frame rate; the period must exceed the longest pulse. */
+    float update_rate_hz = 2000.0f;
+    uint8_t channel_count = 4;
+    uint32_t pins[kMaxChannels] = {0};
+    /**
+     * @brief Stop pulse as calibrated on the ESC; 0 keeps the protocol midpoint.
+     *
+     * Forward-only ESCs stop at the minimum pulse, so set this to the low end
+     * of the range for them.
+     */
+    float neutral_pulse_us = 0.0f;
+  };
+
+  explicit OneShotOutput(const Config& config, hal::IPwm* pwm = nullptr);
+
+  bool Initialize() override;
+  bool Write(const ActuatorCommand* commands, uint8_t count) override;
+
+  float PulseUs(uint8_t index) const { return last_pulse_us_[index]; }
+  const PwmTiming& Timing() const { return driver_.Timing(); }
+
+ private:
+  Config config_{};
+  hal::IPwm* pwm_ = nullptr;
+  PulseRange range_{};
+  PwmSliceDriver driver_{};
+  float last_pulse_us_[kMaxChannels] = {};
+  uint8_t last_count_ = 0;
+};
+
+}  // namespace flight::actuators
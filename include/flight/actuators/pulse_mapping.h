@@ -0,0 +1,27 @@
+#pragma once
+
+namespace flight::actuators {
+
+/** @brief Pulse widths of an analog ESC protocol. */
+struct PulseRange {
+  float min_us = 1100.0f;
+  float max_us = 1900.0f;
+  float neutral_us = 1500.0f;
+};
+
+/**
+ * @brief Map a normalized command [-1, 1] to a pulse width.
+ *
+ * 0 maps to the neutral pulse and +/-1 to its distance towards max; the
+ * result is clamped to [min_us, max_us].
+ */
+inline float MapPulseUs(float value, const PulseRange& range) {
+  const float clamped = value < -1.0f ? -1.0f : (value > 1.0f ? 1.0f : value);
+  const float pulse = range.neutral_us + clamped * (range.max_us - range.neutral_us);
+  if (pulse < range.min_us) {
+    return range.min_us;
+  }
+  return pulse > range.max_us ? range.max_us : pulse;
+}
+
+}  // namespace flight::actuators
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "flight/hal/hal.h"
+
+namespace flight::actuators {
+
+/** @brief PWM slices on the RP2350 (8 on GPIO 0-31, 4 more on GPIO 32-47). */
+constexpr uint8_t kPwmSliceCount = 12;
+
+/** @brief Slice driving a GPIO. */
+constexpr uint8_t PwmSliceForGpio(uint32_t gpio) {
+  return static_cast<uint8_t>(gpio < 32 ? (gpio >> 1) & 7u : 8u + ((gpio >> 1) & 3u));
+}
+
+/** @brief Slice channel (A = 0, B = 1) driving a GPIO. */
+constexpr uint8_t PwmChannelForGpio(uint32_t gpio) {
+  return static_cast<uint8_t>(gpio & 1u);
+}
+
+/** @brief Divider and wrap giving one PWM period per update. */
+struct PwmTiming {
+  uint8_t divider = 1;
+  uint16_t top = 0;
+  /** @brief Counter tick length. */
+  float tick_us = 0.0f;
+  /** @brief Actual period, (top + 1) ticks. */
+  float period_us = 0.0f;
+};
+
+/**
+ * @brief Smallest integer divider whose wrap fits 16 bits at @p update_rate_hz.
+ *
+ * The smallest divider keeps pulse resolution highest. Returns nullopt if
+ * the rate is too low even at the largest divider.
+ */
+std::optional<PwmTiming> ComputePwmTiming(uint32_t clock_hz, float update_rate_hz);
+
+/** @brief Compare level for a pulse width, clamped to the period. */
+uint16_t PulseToLevel(float pulse_us, const PwmTiming& timing);
+
+/** @brief Channel-to-slice mapping for a set of output pins. */
+struct PwmSlicePlan {
+  static constexpr uint8_t kMaxChannels = 8;
+
+  uint8_t slice[kMaxChannels] = {};
+  uint8_t channel[kMaxChannels] = {};
+  uint32_t slice_mask = 0;
+  uint8_t count = 0;
+
+  /** @brief Map pins to slices; false if two pins share a slice output. */
+  bool Build(const uint32_t* pins, uint8_t pin_count);
+};
+
+/**
+ * @brief Runs a set of pins as in-phase hardware PWM slices.
+ *
+ * Shared by the pulse-width ESC outputs: one divider/wrap for every slice,
+ * all slices started together, and levels staged into the double-buffered
+ * compare registers so a whole frame latches at once.
+ */
+class PwmSliceDriver {
+ public:
+  explicit PwmSliceDriver(hal::IPwm* pwm = nullptr) : pwm_(pwm) {}
+
+  /**
+   * @brief Plan slices, configure timing and start with @p initial_pulse_us.
+   *
+   * Fails on shared slice outputs or if the period is not longer than
+   * @p max_pulse_us.
+   */
+  bool Initialize(const uint32_t* pins,
+                  uint8_t count,
+                  float update_rate_hz,
+                  float max_pulse_us,
+                  float initial_pulse_us);
+
+  /** @brief Stage pulse widths for the next frame. */
+  void Write(const float* pulse_us, uint8_t count);
+
+  bool Ready() const { return ready_; }
+  const PwmTiming& Timing() const { return timing_; }
+
+ private:
+  hal::IPwm* pwm_ = nullptr;
+  PwmSlicePlan plan_{};
+  PwmTiming timing_{};
+  bool ready_ = false;
+};
+
+}  // namespace flight::actuators
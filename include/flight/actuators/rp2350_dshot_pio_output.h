@@ -3,19 +3,18 @@
 #include <cstdint>
 
 #include "flight/actuators/actuators.h"
+#include "flight/actuators/dshot_dma.h"
+#include "flight/actuators/dshot_encoder.h"
 
 namespace flight::actuators {
 
 class Rp2350DshotPioOutput final : public IActuatorOutput {
  public:
-  static constexpr uint32_t kMaxChannels = 4;
+  static constexpr uint32_t kMaxChannels = kDshotParallelLanes;
+  /** @brief Channel limit with one state machine per channel. */
+  static constexpr uint32_t kMaxSerialChannels = DshotDmaFrame::kMaxSerialChannels;
 
-  enum class DshotSpeed : uint32_t {
-    k150 = 150,
-    k300 = 300,
-    k600 = 600,
-    k1200 = 1200,
-  };
+  using DshotSpeed = actuators::DshotSpeed;
 
   struct Config {
     uint8_t pio_index = 0;
@@ -26,20 +25,50 @@ class Rp2350DshotPioOutput final : public IActuatorOutput {
     bool enable_telemetry = false;
     uint16_t min_throttle = 48;
     uint16_t max_throttle = 2047;
+    /** @brief Drive consecutive pins from pins[0] with a single state machine. */
+    bool parallel = false;
+    /**
+     * @brief Bidirectional DShot (eRPM telemetry on the signal wire).
+     *
+     * Inverts the output (idle high), uses the inverted checksum and
+     * releases the pins after every frame so the ESC can reply to a
+     * telemetry receiver sampling the same pins.
+     */
+    bool bidirectional = false;
   };
 
+  /** @brief Ticks per frame window in either layout (data plus idle tail). */
+  static constexpr uint32_t kFrameTicks = kDshotSerialWords * 32;
+
   Rp2350DshotPioOutput();
   explicit Rp2350DshotPioOutput(const Config& config);
 
   bool Initialize() override;
+  /**
+   * @brief Encode and start one DMA frame for all channels.
+   *
+   * Never waits on the FIFOs; returns false if the previous frame is still
+   * being shifted out, in which case this update is dropped.
+   */
   bool Write(const ActuatorCommand* commands, uint8_t count) override;
 
- private:
-  uint16_t ValueToThrottle(float value) const;
-  void BuildSymbolWords(uint16_t packet, uint32_t* words, uint8_t& word_count) const;
+  /** @brief Queue a special command for the channels in @p channel_mask. */
+  bool QueueCommand(uint8_t channel_mask, DshotCommand command) {
+    return commands_.Push(channel_mask, command);
+  }
 
+  /** @brief Writes dropped because DMA was still busy. */
+  uint32_t Overruns() const { return overruns_; }
+
+ private:
   Config config_{};
-  uint8_t active_sms_[kMaxChannels] = {};
+  DshotEncoder encoder_{};
+  DshotCommandQueue commands_{};
+  DshotDmaFrame frame_{};
+  uint8_t active_sms_[kMaxSerialChannels] = {};
+  int dma_channels_[kMaxSerialChannels] = {-1, -1, -1, -1};
+  uint32_t dma_mask_ = 0;
+  uint32_t overruns_ = 0;
   uint8_t last_count_ = 0;
 };
 
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+
+#include "flight/actuators/dshot_sliced_decoder.h"
+#include "flight/actuators/telemetry.h"
+
+namespace flight::actuators {
+
+/**
+ * @brief All-channel bidirectional DShot telemetry on one PIO state machine.
+ *
+ * Samples an 8-pin window starting at the lowest configured pin with
+ * `in pins, 8`; DMA streams the samples into a ring without CPU help.
+ * Every configured pin must lie within that window. The endless DMA
+ * transfer has no lap counter, so the fixed sample clock and the time
+ * since the last read tell how far it has written.
+ */
+class Rp2350DshotSlicedTelemetryReceiver final : public ITelemetryReceiver {
+ public:
+  static constexpr uint8_t kMaxChannels = DshotSlicedDecoder::kLanes;
+  /** @brief Ring size as a power of two (8 KiB, ~2.7 ms at DShot300 x10). */
+  static constexpr uint8_t kRingBits = 13;
+  static constexpr uint16_t kRingBytes = 1u << kRingBits;
+
+  struct Config {
+    uint8_t pio_index = 1;
+    uint8_t state_machine = 0;
+    uint8_t channel_count = 4;
+    uint32_t pins[kMaxChannels] = {0};
+    uint32_t dshot_khz = 300;
+    uint8_t samples_per_bit = 10;
+    uint8_t motor_pole_count = 14;
+  };
+
+  Rp2350DshotSlicedTelemetryReceiver();
+  explicit Rp2350DshotSlicedTelemetryReceiver(const Config& config);
+
+  bool Initialize() override;
+  std::optional<DshotTelemetryFrame> Read() override;
+  /** @brief Decode everything captured since the last call; one frame per updated channel. */
+  size_t ReadBatch(DshotTelemetryFrame* out, size_t capacity) override;
+
+  /**
+   * @brief Decode pending captures and return the table for all channels.
+   *
+   * If the DMA lapped the reader since the last call (more than one ring
+   * period, ~2.7 ms), the backlog is dropped and only the newest half ring
+   * is decoded.
+   */
+  const DshotTelemetryTable& ReadTable();
+
+  const DshotSlicedDecoder& Decoder() const { return decoder_; }
+  /** @brief Reads that found the ring lapped and dropped the backlog. */
+  uint32_t Overruns() const { return overruns_; }
+
+ private:
+  void Refresh();
+
+  Config config_{};
+  DshotSlicedDecoder decoder_{};
+  DshotTelemetryTable table_{};
+  uint8_t pending_mask_ = 0;
+  int dma_channel_ = -1;
+  uint16_t read_index_ = 0;
+  uint16_t last_write_index_ = 0;
+  uint64_t last_refresh_us_ = 0;
+  uint32_t sample_hz_ = 0;
+  uint32_t overruns_ = 0;
+  bool initialized_ = false;
+  alignas(kRingBytes) uint8_t ring_[kRingBytes] = {};
+};
+
+}  // namespace flight::actuators
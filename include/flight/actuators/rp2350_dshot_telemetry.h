@@ -2,10 +2,18 @@
 
 #include <cstdint>
 
+#include "flight/actuators/dshot_bidir_decoder.h"
 #include "flight/actuators/telemetry.h"
 
 namespace flight::actuators {
 
+/**
+ * @brief Bidirectional DShot telemetry with one PIO state machine per pin.
+ *
+ * The pins also carry the host's command frames: the first non-idle word
+ * after idle opens the command, which is skipped, and only a burst that
+ * starts within `response_timeout_bits` after it is captured as the response.
+ */
 class Rp2350DshotTelemetryReceiver final : public ITelemetryReceiver {
  public:
   struct Config {
@@ -15,22 +23,44 @@ class Rp2350DshotTelemetryReceiver final : public ITelemetryReceiver {
     uint32_t pins[4] = {0};
     uint32_t dshot_khz = 300;
     uint8_t samples_per_bit = 10;
+    uint8_t motor_pole_count = 14;
+    /** @brief Command bits after a command frame within which the response must start. */
+    uint8_t response_timeout_bits = 20;
   };
 
+  /** @brief FIFO words buffered per response (idle lead-in plus 21 response bits). */
+  static constexpr uint8_t kCaptureWords = 7;
+
   Rp2350DshotTelemetryReceiver();
   explicit Rp2350DshotTelemetryReceiver(const Config& config);
 
   bool Initialize() override;
   std::optional<DshotTelemetryFrame> Read() override;
+  /** @brief Poll every channel once and return all frames decoded this call. */
+  size_t ReadBatch(DshotTelemetryFrame* out, size_t capacity) override;
+
+  /** @brief Per-motor eRPM/RPM state from the latest decoded responses. */
+  const DshotBidirDecoder& Decoder() const { return decoder_; }
+  /** @brief Command frames no ESC answered within the timeout (not decode errors). */
+  uint32_t MissedResponses() const { return missed_responses_; }
 
  private:
-  bool DecodeFrame(uint8_t channel, DshotTelemetryFrame& frame);
+  enum class Gate : uint8_t { kAwaitCommand, kSkipCommand, kAwaitResponse };
+
+  bool PollChannel(uint8_t channel, DshotTelemetryFrame& frame);
+  void ResetChannel(uint8_t channel);
 
   Config config_{};
+  DshotBidirDecoder decoder_{};
   uint8_t active_sms_[4] = {};
   bool initialized_ = false;
-  uint32_t sample_words_[4][6] = {};
+  uint32_t sample_words_[4][kCaptureWords] = {};
   uint16_t sample_count_[4] = {};
+  Gate gate_[4] = {};
+  uint8_t gate_words_[4] = {};
+  uint8_t command_words_ = 0;
+  uint8_t timeout_words_ = 0;
+  uint32_t missed_responses_ = 0;
 };
 
 }  // namespace flight::actuators
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 
+#include "flight/core/batch_read.h"
+
 namespace flight::actuators {
 
 /** @brief Raw DShot telemetry frame. */
@@ -13,12 +16,34 @@ struct DshotTelemetryFrame {
   bool crc_ok = false;
 };
 
+/**
+ * @brief Convert a bidirectional DShot period code to electrical RPM.
+ *
+ * The 12-bit code is `eee mmmmmmmmm`: the eRPM period in microseconds is
+ * `m << e`. A zero period or the all-ones code (motor stopped) yields 0.
+ */
+inline uint32_t ErpmFromPeriodCode(uint16_t code) {
+  code &= 0x0FFF;
+  if (code == 0x0FFF) {
+    return 0;
+  }
+  const uint32_t period_us = static_cast<uint32_t>(code & 0x1FF) << (code >> 9);
+  if (period_us == 0) {
+    return 0;
+  }
+  return 60000000u / period_us;
+}
+
 /** @brief Telemetry receiver interface. */
 class ITelemetryReceiver {
  public:
   virtual ~ITelemetryReceiver() = default;
   virtual bool Initialize() = 0;
   virtual std::optional<DshotTelemetryFrame> Read() = 0;
+  /** @brief Drain up to @p capacity pending telemetry frames; returns the count written. */
+  virtual size_t ReadBatch(DshotTelemetryFrame* out, size_t capacity) {
+    return core::DrainReads([this] { return Read(); }, out, capacity);
+  }
 };
 
 }  // namespace flight::actuators
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+
+#include "flight/actuators/actuators.h"
+#include "flight/config/config.h"
+
+namespace flight::actuators {
+
+/**
+ * @brief Maps desired normalized thrust to the ESC command that produces it.
+ *
+ * The thruster model per direction is `thrust = max * ((|u| - d) / (1 - d))^p`
+ * above the ESC deadband `d`, with separate `max` and `p` for forward and
+ * reverse. Its inverse is tabulated once at init on breakpoints evenly
+ * spaced in sqrt(thrust), dense near zero where the curve is steepest, and
+ * linearly interpolated per tick; battery sag is a single scale factor on
+ * the requested thrust.
+ */
+class ThrustLinearizer {
+ public:
+  static constexpr uint8_t kMaxChannels = 8;
+  static constexpr uint8_t kTableSize = 65;
+
+  struct Config {
+    float forward_exponent = 2.0f;
+    float reverse_exponent = 2.0f;
+    /** @brief Reverse thrust at full command relative to forward. */
+    float reverse_max = 0.7f;
+    /** @brief Command magnitude below which the ESC produces no thrust. */
+    float deadband = 0.05f;
+    /** @brief Supply voltage the curves were measured at. */
+    float nominal_voltage = 16.0f;
+    /** @brief Requested thrust below this maps to exactly zero command. */
+    float zero_threshold = 1e-3f;
+  };
+
+  ThrustLinearizer();
+  explicit ThrustLinearizer(const Config& config);
+
+  /** @brief Read `thrust.*` keys from @p store over @p defaults. */
+  static Config LoadConfig(const config::IConfigStore& store, const Config& defaults);
+  static Config LoadConfig(const config::IConfigStore& store) { return LoadConfig(store, Config{}); }
+
+  /** @brief Rebuild the lookup tables from the current config. */
+  void Build();
+
+  /** @brief Thrust scales with voltage squared; lower voltage needs more command. */
+  void SetVoltage(float volts);
+
+  /** @brief Linearize up to kMaxChannels thrust requests in [-1, 1]. */
+  void Apply(const float* thrust, float* command, uint8_t count) const;
+
+  /** @brief Single-value convenience wrapper around Apply(). */
+  float Command(float thrust) const;
+
+  /** @brief Forward model, thrust produced by a command (for tests and tools). */
+  float ModelThrust(float command) const;
+
+  const Config& GetConfig() const { return config_; }
+
+ private:
+  Config config_{};
+  float voltage_scale_ = 1.0f;
+  float reverse_scale_ = 1.0f;
+  float forward_table_[kTableSize] = {};
+  float reverse_table_[kTableSize] = {};
+};
+
+/** @brief Actuator decorator that linearizes commands before the wrapped output. */
+class LinearizedOutput final : public IActuatorOutput {
+ public:
+  LinearizedOutput(IActuatorOutput* output, const ThrustLinearizer* linearizer);
+
+  bool Initialize() override;
+  bool Write(const ActuatorCommand* commands, uint8_t count) override;
+
+ private:
+  IActuatorOutput* output_ = nullptr;
+  const ThrustLinearizer* linearizer_ = nullptr;
+};
+
+}  // namespace flight::actuators
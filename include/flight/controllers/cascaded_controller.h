@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+
+#include "flight/controllers/control_allocator.h"
+#include "flight/controllers/controllers.h"
+#include "flight/controllers/pid.h"
+#include "flight/scheduler/scheduler.h"
+
+namespace flight::controllers {
+
+/**
+ * @brief Closed-loop ROV controller: velocity/depth -> attitude -> rate.
+ *
+ * Each level is a scheduler task at its own rate. Outer levels write the
+ * setpoints of the next level; the rate level produces torques and the
+ * velocity/depth level forces, which are allocated onto the thrusters.
+ *
+ * Setpoint mapping matches the stick layout: `velocity_mps.x/y` are body
+ * surge/sway velocity, `velocity_mps.z` the climb rate, `body_rates_rps.z`
+ * the yaw rate and `attitude_rpy_rad.x/y` the roll/pitch targets.
+ */
+class CascadedController final : public IController {
+ public:
+  /** @brief Loop levels, innermost first. */
+  enum Level : uint8_t { kRateLevel = 0, kAttitudeLevel = 1, kVelocityLevel = 2 };
+  static constexpr uint8_t kLevelCount = 3;
+
+  struct Config {
+    uint32_t rate_hz = 1000;
+    uint32_t attitude_hz = 250;
+    uint32_t velocity_hz = 50;
+    /** @brief Roll/pitch/yaw rate -> torque, feed-forward on the rate setpoint. */
+    Pid::Config rate[3] = {{0.2f, 0.5f, 0.002f, 0.1f, 40.0f, 0.3f, 1.0f},
+                           {0.2f, 0.5f, 0.002f, 0.1f, 40.0f, 0.3f, 1.0f},
+                           {0.4f, 0.5f, 0.0f, 0.5f, 40.0f, 0.3f, 1.0f}};
+    /** @brief Roll/pitch angle -> rate setpoint (rad/s). */
+    Pid::Config attitude[2] = {{4.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 2.0f},
+                               {4.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 2.0f}};
+    /** @brief Surge/sway velocity -> force, feed-forward on the velocity setpoint. */
+    Pid::Config velocity[2] = {{0.8f, 0.3f, 0.0f, 1.0f, 0.0f, 0.3f, 1.0f},
+                               {0.8f, 0.3f, 0.0f, 1.0f, 0.0f, 0.3f, 1.0f}};
+    /** @brief Depth error -> heave force, feed-forward on the climb rate. */
+    Pid::Config depth = {1.5f, 0.2f, 0.0f, 1.0f, 0.0f, 0.3f, 1.0f};
+    ControlAllocator::Config geometry = ControlAllocator::Rov4Config();
+  };
+
+  CascadedController();
+  explicit CascadedController(const Config& config);
+  /** @brief Scheduler tasks capture `this`, so the controller stays put. */
+  CascadedController(const CascadedController&) = delete;
+  CascadedController& operator=(const CascadedController&) = delete;
+
+  bool Initialize() override;
+  /** @brief Advance all loop levels by @p dt_s and allocate the wrench. */
+  ControlOutput Update(const core::Pose& state,
+                       const ControlSetpoint& setpoint,
+                       float dt_s) override;
+
+  /** @brief One step of the rate loop (scheduled at rate_hz). */
+  void StepRate(float dt_s);
+  /** @brief One step of the attitude loop (scheduled at attitude_hz). */
+  void StepAttitude(float dt_s);
+  /** @brief One step of the velocity/depth loop (scheduled at velocity_hz). */
+  void StepVelocity(float dt_s);
+
+  /** @brief Steps run so far at @p level. */
+  uint32_t StepCount(Level level) const { return step_count_[level]; }
+  /** @brief Wrench requested by the last steps. */
+  const Wrench& Demand() const { return demand_; }
+  /** @brief Depth the velocity level is holding. */
+  float DepthTarget() const { return depth_target_m_; }
+  const Config& GetConfig() const { return config_; }
+
+ private:
+  Config config_{};
+  scheduler::Scheduler scheduler_;
+  ControlAllocator allocator_;
+  Pid rate_pid_[3];
+  Pid attitude_pid_[2];
+  Pid velocity_pid_[2];
+  Pid depth_pid_;
+
+  core::Pose state_{};
+  ControlSetpoint setpoint_{};
+  core::Vector3f rate_target_rps_{};
+  Wrench demand_{};
+  float depth_target_m_ = 0.0f;
+  bool depth_primed_ = false;
+  uint32_t step_count_[kLevelCount] = {};
+};
+
+}  // namespace flight::controllers
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "flight/core/types.h"
+
+namespace flight::controllers {
+
+/** @brief Body-frame wrench axes. */
+enum WrenchAxis : uint8_t {
+  kSurge = 0,
+  kSway = 1,
+  kHeave = 2,
+  kRoll = 3,
+  kPitch = 4,
+  kYaw = 5,
+};
+
+constexpr uint8_t kWrenchAxes = 6;
+
+/** @brief Normalized 6-DOF force/torque request. */
+struct Wrench {
+  float axis[kWrenchAxes] = {};
+};
+
+/**
+ * @brief Maps a wrench onto up to 8 thrusters through a fixed pseudo-inverse.
+ *
+ * `geometry[axis][thruster]` is the wrench a thruster produces at full
+ * command. Axes are allocated in priority order; when a thruster saturates
+ * the remaining request on that axis is redistributed over the unsaturated
+ * thrusters, and whatever still does not fit is scaled down so
+ * higher-priority axes keep their full authority.
+ *
+ * The pseudo-inverse of every subset of the configured thrusters is
+ * computed in the constructor (2^N tables: 16 at 4 thrusters, 256 and
+ * 48 KiB at 8), so Allocate() only does lookups and multiply-adds. The
+ * tables are the only heap allocation, made once; bounded iterations.
+ */
+class ControlAllocator {
+ public:
+  static constexpr uint8_t kMaxThrusters = 8;
+  /** @brief Redistribution passes per axis. */
+  static constexpr uint8_t kMaxIterations = 4;
+
+  struct Config {
+    uint8_t thruster_count = 0;
+    float geometry[kWrenchAxes][kMaxThrusters] = {};
+    /** @brief Allocation order, highest priority first. */
+    uint8_t priority[kWrenchAxes] = {kHeave, kYaw, kRoll, kPitch, kSway, kSurge};
+    /** @brief Tikhonov term for B B^T so unactuated axes stay invertible. */
+    float regularization = 1e-6f;
+  };
+
+  /** @brief Two horizontal (surge/yaw) and two vertical (heave) thrusters. */
+  static Config Rov4Config();
+  /**
+   * @brief Fill column @p index from a mounting position and thrust direction.
+   *
+   * Force is @p direction scaled by @p max_thrust, torque is position x force.
+   */
+  static void SetThruster(Config& config, uint8_t index, const core::Vector3f& position_m,
+                          const core::Vector3f& direction, float max_thrust = 1.0f);
+
+  ControlAllocator();
+  explicit ControlAllocator(const Config& config);
+
+  /** @brief False if the geometry could not be inverted. */
+  bool Valid() const { return valid_; }
+
+  /** @brief Allocate @p wrench; writes thruster_count commands in [-1, 1]. */
+  uint8_t Allocate(const Wrench& wrench, float* commands);
+
+  /** @brief Wrench produced by the last allocation. */
+  const Wrench& Achieved() const { return achieved_; }
+  /** @brief Pseudo-inverse entry (thruster command per unit of an axis). */
+  float Inverse(uint8_t thruster, uint8_t axis) const {
+    return subsets_[full_mask_].inverse[thruster][axis];
+  }
+  const Config& GetConfig() const { return config_; }
+
+ private:
+  using InverseMatrix = float[kMaxThrusters][kWrenchAxes];
+
+  /** @brief Pseudo-inverse over one thruster subset. */
+  struct SubsetInverse {
+    InverseMatrix inverse{};
+    /** @brief Axes this subset produces without disturbing the others (bit per axis). */
+    uint8_t decoupled_axes = 0;
+  };
+
+  /** @brief B_m^T (B_m B_m^T + eps I)^-1 over the thrusters in @p thruster_mask. */
+  bool PseudoInverse(uint32_t thruster_mask, InverseMatrix& out) const;
+  /** @brief Bit per axis the subset's inverse allocates without cross-coupling. */
+  uint8_t DecoupledAxes(const InverseMatrix& inverse) const;
+
+  Config config_{};
+  /** @brief Indexed by thruster mask; 2^thruster_count entries. */
+  std::vector<SubsetInverse> subsets_;
+  uint32_t full_mask_ = 0;
+  Wrench achieved_{};
+  bool valid_ = false;
+};
+
+}  // namespace flight::controllers
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace flight::controllers {
+
+/**
+ * @brief Gain sets on a grid of one or two scheduling variables.
+ *
+ * Breakpoints must be ascending. With `y_count == 1` the table is 1-D.
+ */
+struct GainTable {
+  static constexpr uint8_t kMaxBreakpoints = 8;
+  static constexpr uint8_t kMaxGains = 4;
+
+  uint8_t x_count = 1;
+  uint8_t y_count = 1;
+  uint8_t gain_count = 0;
+  float x[kMaxBreakpoints] = {};
+  float y[kMaxBreakpoints] = {};
+  /** @brief gains[ix][iy][gain]. */
+  float gains[kMaxBreakpoints][kMaxBreakpoints][kMaxGains] = {};
+
+  /** @brief True if counts are in range and breakpoints ascend. */
+  bool Valid() const;
+};
+
+/**
+ * @brief Double-buffered gain table with bilinear lookup.
+ *
+ * Evaluate() is called from the control loop and costs at most two
+ * breakpoint scans of kMaxBreakpoints plus one bilinear blend per gain.
+ * Update() may run on another thread: it fills the buffer the loop is not
+ * using and publishes it with one atomic store, so a tick never sees a
+ * half-written table. It returns false until the loop has picked up the
+ * previous update.
+ */
+class GainSchedule {
+ public:
+  GainSchedule();
+  explicit GainSchedule(const GainTable& table);
+
+  /** @brief Publish a new table; false if invalid or the last one is still pending. */
+  bool Update(const GainTable& table);
+  /** @brief Interpolate gains at (x, y), clamped to the grid; returns gain_count. */
+  uint8_t Evaluate(float x, float y, float* gains_out);
+  /** @brief Number of tables published so far. */
+  uint32_t Generation() const { return generation_.load(std::memory_order_acquire); }
+
+ private:
+  GainTable tables_[2];
+  std::atomic<uint8_t> active_{0};
+  /** @brief Buffer index the reader last switched to. */
+  std::atomic<uint8_t> in_use_{0};
+  std::atomic<uint32_t> generation_{0};
+};
+
+}  // namespace flight::controllers
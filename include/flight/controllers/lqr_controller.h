@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+
+#include "flight/controllers/control_allocator.h"
+#include "flight/controllers/controllers.h"
+#include "flight/controllers/lqr_tables.h"
+
+namespace flight::controllers {
+
+/** @brief View of an offline-computed gain table (see lqr_tables.h). */
+struct LqrGainTable {
+  uint8_t region_count = 0;
+  /** @brief Upper |surge speed| of each region, ascending. */
+  const float* region_speed = nullptr;
+  const float (*gains)[lqr_tables::kInputs][lqr_tables::kStates] = nullptr;
+  /** @brief Tick period the gains were discretized for. */
+  float sample_time_s = lqr_tables::kSampleTimeS;
+};
+
+/** @brief Table generated by scripts/generate_lqr_tables.py. */
+LqrGainTable DefaultLqrTable();
+
+/**
+ * @brief Station-keeping controller with precomputed LQR gains.
+ *
+ * The error state is body-frame position (x, y), depth, heading, and the
+ * body velocities and yaw rate relative to the setpoint. Each tick picks
+ * the region for the current surge speed, computes `u = -K x` for surge,
+ * sway, heave and yaw, and allocates the result. The targets are
+ * `position_m`, `attitude_rpy_rad.z`, `velocity_mps` and `body_rates_rps.z`.
+ *
+ * The gains are discrete-time and only hold at the table's sample time
+ * (100 Hz for the default table); they are not rescaled for other rates.
+ * Run the controller at that rate; ticks whose `dt_s` is more than 10 %
+ * off are counted in RateMismatches().
+ */
+class LqrController final : public IController {
+ public:
+  static constexpr uint8_t kStates = lqr_tables::kStates;
+  static constexpr uint8_t kInputs = lqr_tables::kInputs;
+
+  struct Config {
+    LqrGainTable table = DefaultLqrTable();
+    ControlAllocator::Config geometry = ControlAllocator::Rov4Config();
+  };
+
+  LqrController();
+  explicit LqrController(const Config& config);
+
+  bool Initialize() override;
+  ControlOutput Update(const core::Pose& state,
+                       const ControlSetpoint& setpoint,
+                       float dt_s) override;
+
+  /** @brief Region index for a surge speed (clamped to the last region). */
+  uint8_t Region(float surge_speed_mps) const;
+  /** @brief Region used by the last update. */
+  uint8_t LastRegion() const { return region_; }
+  /** @brief Error state of the last update. */
+  const float* ErrorState() const { return error_; }
+  /** @brief Wrench requested by the last update. */
+  const Wrench& Demand() const { return demand_; }
+  /** @brief Updates whose dt_s was more than 10 % off the table's sample time. */
+  uint32_t RateMismatches() const { return rate_mismatches_; }
+
+ private:
+  Config config_{};
+  ControlAllocator allocator_;
+  float error_[kStates] = {};
+  Wrench demand_{};
+  uint8_t region_ = 0;
+  uint32_t rate_mismatches_ = 0;
+};
+
+}  // namespace flight::controllers
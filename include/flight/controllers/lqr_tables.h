@@ -0,0 +1,56 @@
+#pragma once
+
+// Generated by scripts/generate_lqr_tables.py; do not edit by hand.
+
+#include <cstdint>
+
+namespace flight::controllers::lqr_tables {
+
+constexpr uint8_t kStates = 8;
+constexpr uint8_t kInputs = 4;
+constexpr uint8_t kRegions = 5;
+constexpr float kSampleTimeS = 0.01f;
+
+/** @brief Upper |surge speed| (m/s) of each region; the last is open ended. */
+constexpr float kRegionSpeed[kRegions] = {0.1f, 0.3f, 0.6f, 1.0f, 1.5f};
+
+/** @brief u = -K x per region; rows surge/sway/heave/yaw, columns x y z yaw u v w r. */
+constexpr float kGains[kRegions][kInputs][kStates] = {
+    // |u| < 0.1 m/s
+    {
+        {1.92879f, 0.0f, 0.0f, 0.0f, 1.187379f, 0.0f, 0.0f, 0.0f},
+        {0.0f, 1.937565f, 0.0f, 0.0f, 0.0f, 1.236595f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 2.376924f, 0.0f, 0.0f, 0.0f, 1.322327f, 0.0f},
+        {0.0f, 0.0f, 0.0f, 1.336917f, 0.0f, 0.0f, 0.0f, 0.7343528f},
+    },
+    // |u| < 0.3 m/s
+    {
+        {1.932335f, 0.0f, 0.0f, 0.0f, 1.127523f, 0.0f, 0.0f, 0.0f},
+        {0.0f, 1.937565f, 0.0f, 0.0f, 0.0f, 1.236595f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 2.376924f, 0.0f, 0.0f, 0.0f, 1.322327f, 0.0f},
+        {0.0f, 0.0f, 0.0f, 1.336917f, 0.0f, 0.0f, 0.0f, 0.7343528f},
+    },
+    // |u| < 0.6 m/s
+    {
+        {1.93782f, 0.0f, 0.0f, 0.0f, 1.034938f, 0.0f, 0.0f, 0.0f},
+        {0.0f, 1.937565f, 0.0f, 0.0f, 0.0f, 1.236595f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 2.376924f, 0.0f, 0.0f, 0.0f, 1.322327f, 0.0f},
+        {0.0f, 0.0f, 0.0f, 1.336917f, 0.0f, 0.0f, 0.0f, 0.7343528f},
+    },
+    // |u| < 1 m/s
+    {
+        {1.944637f, 0.0f, 0.0f, 0.0f, 0.9198648f, 0.0f, 0.0f, 0.0f},
+        {0.0f, 1.937565f, 0.0f, 0.0f, 0.0f, 1.236595f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 2.376924f, 0.0f, 0.0f, 0.0f, 1.322327f, 0.0f},
+        {0.0f, 0.0f, 0.0f, 1.336917f, 0.0f, 0.0f, 0.0f, 0.7343528f},
+    },
+    // |u| < 1.5 m/s
+    {
+        {1.952042f, 0.0f, 0.0f, 0.0f, 0.7948642f, 0.0f, 0.0f, 0.0f},
+        {0.0f, 1.937565f, 0.0f, 0.0f, 0.0f, 1.236595f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 2.376924f, 0.0f, 0.0f, 0.0f, 1.322327f, 0.0f},
+        {0.0f, 0.0f, 0.0f, 1.336917f, 0.0f, 0.0f, 0.0f, 0.7343528f},
+    },
+};
+
+}  // namespace flight::controllers::lqr_tables
@@ -0,0 +1,48 @@
+#pragma once
+
+namespace flight::controllers {
+
+/**
+ * @brief Single-axis PID block.
+ *
+ * Derivative acts on the measurement through a first-order low-pass, so
+ * setpoint steps do not kick. The integrator is clamped and frozen while the
+ * output is saturated in the direction it would grow (conditional
+ * integration).
+ */
+class Pid {
+ public:
+  struct Config {
+    float kp = 1.0f;
+    float ki = 0.0f;
+    float kd = 0.0f;
+    /** @brief Gain applied to the feed-forward term passed to Update(). */
+    float kff = 0.0f;
+    /** @brief Derivative low-pass cutoff; 0 disables filtering. */
+    float d_cutoff_hz = 30.0f;
+    /** @brief Absolute limit of the integral contribution. */
+    float integral_limit = 0.5f;
+    /** @brief Absolute output limit. */
+    float output_limit = 1.0f;
+  };
+
+  Pid();
+  explicit Pid(const Config& config);
+
+  /** @brief Run one step and return the limited output. */
+  float Update(float setpoint, float measurement, float dt_s, float feedforward = 0.0f);
+  /** @brief Clear integrator and derivative history. */
+  void Reset();
+
+  float Integral() const { return integral_; }
+  const Config& GetConfig() const { return config_; }
+
+ private:
+  Config config_{};
+  float integral_ = 0.0f;
+  float derivative_ = 0.0f;
+  float last_measurement_ = 0.0f;
+  bool primed_ = false;
+};
+
+}  // namespace flight::controllers
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "flight/controllers/control_allocator.h"
 #include "flight/controllers/controllers.h"
+#include "flight/controllers/gain_schedule.h"
 
 namespace flight::controllers {
 
@@ -11,24 +13,42 @@ struct RovMixConfig {
   float heave_gain = 1.0f;
 };
 
+/** @brief Gain order in a GainTable used with RovController. */
+enum RovGain : uint8_t { kRovSurgeGain = 0, kRovYawGain = 1, kRovHeaveGain = 2 };
+
 /**
- * @brief 4-thruster ROV controller (2 horizontal, 2 vertical).
+ * @brief ROV controller mixing through a ControlAllocator.
  *
- * Uses setpoint velocity and yaw rate to generate motor outputs.
+ * Uses setpoint velocity and yaw rate as a surge/heave/yaw wrench. The
+ * default geometry is the 4-thruster frame (2 horizontal, 2 vertical).
  */
 class RovController final : public IController {
  public:
   /** @brief Construct with mix gains. */
   explicit RovController(const RovMixConfig& config);
+  /** @brief Construct with mix gains and a thruster geometry. */
+  RovController(const RovMixConfig& config, const ControlAllocator::Config& geometry);
 
-  bool Initialize() override { return true; }
+  bool Initialize() override { return allocator_.Valid(); }
   /** @brief Compute motor outputs from setpoint. */
   ControlOutput Update(const core::Pose& state,
                        const ControlSetpoint& setpoint,
                        float dt_s) override;
 
+  /**
+   * @brief Schedule the mix gains on horizontal speed (x) and depth (y, -z).
+   *
+   * The table holds RovGain-ordered sets; nullptr reverts to RovMixConfig.
+   */
+  void SetGainSchedule(GainSchedule* schedule) { schedule_ = schedule; }
+
+  /** @brief Allocator used for mixing. */
+  const ControlAllocator& Allocator() const { return allocator_; }
+
  private:
   RovMixConfig config_{};
+  ControlAllocator allocator_;
+  GainSchedule* schedule_ = nullptr;
 };
 
 }  // namespace flight::controllers
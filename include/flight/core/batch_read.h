@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+
+namespace flight::core {
+
+/**
+ * @brief Fill @p out by calling a single-item reader until it runs dry.
+ *
+ * Used by the default ReadBatch() adapters so drivers that only implement
+ * Read() keep working. @p read must return an optional-like value.
+ */
+template <typename T, typename ReadFn>
+size_t DrainReads(ReadFn&& read, T* out, size_t capacity) {
+  size_t count = 0;
+  while (count < capacity) {
+    auto item = read();
+    if (!item) {
+      break;
+    }
+    out[count++] = *item;
+  }
+  return count;
+}
+
+}  // namespace flight::core
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace flight::core {
+
+// Magic numbers of every UDP packet kind. Receivers tell packet kinds apart
+// by these alone, so they live in one place and are checked for uniqueness
+// at compile time; the receiver and telemetry modules re-export them.
+
+/** @brief "MFTT": command packets (v1-v3). */
+constexpr uint32_t kCommandMagic = 0x4D465454;
+/** @brief "MFTS": time-sync request and reply. */
+constexpr uint32_t kTimeSyncMagic = 0x4D465453;
+/** @brief "MFTL": v3 and v4 telemetry datagrams. */
+constexpr uint32_t kTelemetryMagic = 0x4D46544C;
+/** @brief "MFST": one sample of the streams set in the header mask. */
+constexpr uint32_t kStreamTelemetryMagic = 0x4D465354;
+/** @brief "MFSQ": ground station subscription request. */
+constexpr uint32_t kStreamSubscribeMagic = 0x4D465351;
+
+/** @brief Every magic above; add new packet kinds here. */
+constexpr uint32_t kProtocolMagics[] = {kCommandMagic, kTimeSyncMagic, kTelemetryMagic,
+                                        kStreamTelemetryMagic, kStreamSubscribeMagic};
+
+constexpr bool ProtocolMagicsDistinct() {
+  constexpr size_t count = sizeof(kProtocolMagics) / sizeof(kProtocolMagics[0]);
+  for (size_t i = 0; i < count; ++i) {
+    for (size_t j = i + 1; j < count; ++j) {
+      if (kProtocolMagics[i] == kProtocolMagics[j]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+static_assert(ProtocolMagicsDistinct(), "protocol magics must be distinct");
+
+}  // namespace flight::core
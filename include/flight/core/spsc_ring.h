@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace flight::core {
+
+/** @brief What a full ring gives up to make room. */
+enum class DropPolicy : uint8_t {
+  /** @brief Push() fails; the producer keeps what is already queued. */
+  kDropNewest,
+  /** @brief Push() overwrites the oldest item; the newest state always gets through. */
+  kDropOldest,
+};
+
+/**
+ * @brief Lock-free single-producer/single-consumer FIFO of @p Capacity items.
+ *
+ * With kDropNewest, Push() fails instead of overwriting when full, so the
+ * producer decides what to drop. With kDropOldest, Push() always succeeds
+ * in constant time and never looks at the consumer. Each slot carries a
+ * sequence word written around the copy (a seqlock), so the consumer can
+ * reject a slot the producer lapped or was rewriting during the read.
+ * Either way, lost items are counted in Dropped(). Capacity must be a
+ * power of two.
+ */
+template <typename T, size_t Capacity>
+class SpscRing {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+  static_assert(std::is_trivially_copyable<T>::value, "items are copied with memcpy");
+
+ public:
+  explicit SpscRing(DropPolicy policy = DropPolicy::kDropNewest) : policy_(policy) {}
+
+  /** @brief Producer: append @p value; false if it was dropped (kDropNewest and full). */
+  bool Push(const T& value) {
+    const uint64_t head = head_.load(std::memory_order_relaxed);
+    if (policy_ == DropPolicy::kDropNewest &&
+        head - tail_.load(std::memory_order_acquire) == Capacity) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    Slot& slot = slots_[head & (Capacity - 1)];
+    slot.sequence.store(2 * head + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(static_cast<void*>(&slot.value), &value, sizeof(T));
+    slot.sequence.store(2 * head + 2, std::memory_order_release);
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /** @brief Consumer: remove the oldest item still intact; false if empty. */
+  bool Pop(T& out) {
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    while (true) {
+      const uint64_t head = head_.load(std::memory_order_acquire);
+      if (tail == head) {
+        tail_.store(tail, std::memory_order_release);
+        return false;
+      }
+      if (head - tail > Capacity) {
+        Drop(tail, head - Capacity - tail);
+      }
+      const Slot& slot = slots_[tail & (Capacity - 1)];
+      const uint64_t expected = 2 * tail + 2;
+      if (slot.sequence.load(std::memory_order_acquire) != expected) {
+        Drop(tail, 1);
+        continue;
+      }
+      std::memcpy(static_cast<void*>(&out), &slot.value, sizeof(T));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.sequence.load(std::memory_order_relaxed) != expected) {
+        Drop(tail, 1);
+        continue;
+      }
+      tail_.store(tail + 1, std::memory_order_release);
+      return true;
+    }
+  }
+
+  DropPolicy Policy() const { return policy_; }
+  /** @brief Items refused (kDropNewest) or overwritten before the consumer reached them (kDropOldest). */
+  uint64_t Dropped() const { return dropped_.load(std::memory_order_relaxed); }
+  /** @brief Items accepted by Push() so far. */
+  uint64_t Pushed() const { return head_.load(std::memory_order_relaxed); }
+
+ private:
+  struct alignas(64) Slot {
+    std::atomic<uint64_t> sequence{0};
+    T value{};
+  };
+
+  /** @brief Consumer: skip @p count lapped items (kDropOldest only). */
+  void Drop(uint64_t& tail, uint64_t count) {
+    tail += count;
+    dropped_.fetch_add(count, std::memory_order_relaxed);
+  }
+
+  Slot slots_[Capacity];
+  DropPolicy policy_;
+  // Separate cache lines so producer and consumer do not false-share.
+  alignas(64) std::atomic<uint64_t> head_{0};
+  alignas(64) std::atomic<uint64_t> tail_{0};
+  std::atomic<uint64_t> dropped_{0};
+};
+
+}  // namespace flight::core
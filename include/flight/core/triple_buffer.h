@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace flight::core {
+
+/**
+ * @brief Wait-free single-producer/single-consumer latest-value mailbox.
+ *
+ * The producer writes into a private back slot and swaps it with the shared
+ * middle slot; the consumer swaps its front slot with the middle one only
+ * when a new value was published. Neither side ever blocks or copies a
+ * partially written value, and a stalled consumer only ever sees the newest
+ * value, never a backlog.
+ */
+template <typename T>
+class TripleBuffer {
+ public:
+  /** @brief Producer: publish @p value, replacing any unread one. */
+  void Write(const T& value) {
+    slots_[back_] = value;
+    const uint8_t previous = middle_.exchange(static_cast<uint8_t>(back_ | kFresh), std::memory_order_acq_rel);
+    back_ = previous & kIndexMask;
+  }
+
+  /** @brief Consumer: take the newest value if one arrived since the last Read(). */
+  bool Read(T& out) {
+    if ((middle_.load(std::memory_order_relaxed) & kFresh) == 0) {
+      return false;
+    }
+    const uint8_t previous = middle_.exchange(front_, std::memory_order_acq_rel);
+    front_ = previous & kIndexMask;
+    out = slots_[front_];
+    return true;
+  }
+
+ private:
+  static constexpr uint8_t kFresh = 0x4;
+  static constexpr uint8_t kIndexMask = 0x3;
+
+  T slots_[3]{};
+  uint8_t back_ = 0;
+  std::atomic<uint8_t> middle_{1};
+  uint8_t front_ = 2;
+};
+
+}  // namespace flight::core
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+namespace flight::filters {
+
+/** @brief Normalized biquad coefficients (a0 == 1). */
+struct BiquadCoefficients {
+  float b0 = 1.0f;
+  float b1 = 0.0f;
+  float b2 = 0.0f;
+  float a1 = 0.0f;
+  float a2 = 0.0f;
+};
+
+/**
+ * @brief Compute notch coefficients for a center frequency.
+ *
+ * @param center_hz Notch center frequency.
+ * @param q Quality factor (higher is narrower).
+ * @param sample_rate_hz Filter sample rate.
+ */
+BiquadCoefficients MakeNotchCoefficients(float center_hz, float q, float sample_rate_hz);
+
+/** @brief Direct form II transposed biquad state. */
+struct BiquadState {
+  float z1 = 0.0f;
+  float z2 = 0.0f;
+
+  /** @brief Filter one sample with the given coefficients. */
+  float Apply(const BiquadCoefficients& c, float x) {
+    const float y = c.b0 * x + z1;
+    z1 = c.b1 * x - c.a1 * y + z2;
+    z2 = c.b2 * x - c.a2 * y;
+    return y;
+  }
+
+  /** @brief Clear filter history. */
+  void Reset() {
+    z1 = 0.0f;
+    z2 = 0.0f;
+  }
+};
+
+}  // namespace flight::filters
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+
+#include "flight/actuators/telemetry.h"
+#include "flight/core/types.h"
+#include "flight/filters/biquad.h"
+
+namespace flight::filters {
+
+/**
+ * @brief Gyro notch bank tracking motor RPM from ESC telemetry.
+ *
+ * Each motor owns one notch per harmonic. Motor frequencies come from
+ * bidirectional DShot eRPM telemetry; coefficient updates are spread across
+ * ticks so at most @c max_retunes_per_tick notches are recomputed per Apply().
+ *
+ * A small set of per-axis notches can additionally be steered by a spectrum
+ * analyzer (see SpectrumAnalyzer) to catch vibration not tied to motor RPM;
+ * peaks the RPM notches already cover are not given a second notch.
+ */
+class RpmNotchFilter {
+ public:
+  static constexpr uint8_t kMaxMotors = 8;
+  static constexpr uint8_t kMaxHarmonics = 3;
+  static constexpr uint8_t kMaxNotches = kMaxMotors * kMaxHarmonics;
+  static constexpr uint8_t kMaxSpectrumNotches = 3;
+
+  /** @brief Filter bank configuration. */
+  struct Config {
+    float sample_rate_hz = 1000.0f;
+    uint8_t motor_count = 4;
+    uint8_t harmonics = 2;
+    uint8_t motor_pole_count = 14;
+    float min_hz = 20.0f;
+    float q = 5.0f;
+    uint8_t max_retunes_per_tick = 4;
+    /** @brief Spectrum-steered notches per axis (0 disables). */
+    uint8_t spectrum_notches = 1;
+    float spectrum_q = 3.0f;
+  };
+
+  /** @brief Construct with filter config. */
+  explicit RpmNotchFilter(const Config& config);
+
+  /** @brief Reset filter state and disable all notches. */
+  bool Initialize();
+
+  /** @brief Feed a decoded ESC telemetry frame (ignored if CRC failed). */
+  void UpdateTelemetry(const actuators::DshotTelemetryFrame& frame);
+  /** @brief Set the electrical RPM of a motor directly. */
+  void SetMotorErpm(uint8_t motor, uint32_t erpm);
+
+  /** @brief Steer the spectrum notches of one axis from analyzer peaks, strongest first. */
+  void SetSpectrumPeaks(uint8_t axis, const float* hz, uint8_t count);
+
+  /** @brief Retune a bounded number of notches, then filter one gyro sample. */
+  core::Vector3f Apply(const core::Vector3f& gyro);
+
+  /** @brief Current mechanical rotation frequency of a motor in Hz. */
+  float MotorHz(uint8_t motor) const { return motor_hz_[motor]; }
+  /** @brief Center frequency of a notch (0 when disabled). */
+  float NotchHz(uint8_t motor, uint8_t harmonic) const;
+  /** @brief Center frequency of a spectrum notch (0 when disabled). */
+  float SpectrumNotchHz(uint8_t axis, uint8_t index) const;
+  /** @brief Number of notch coefficient updates done by the last Apply(). */
+  uint8_t LastRetuneCount() const { return last_retunes_; }
+
+ private:
+  struct Notch {
+    BiquadCoefficients coeffs{};
+    BiquadState state[3]{};
+    float center_hz = 0.0f;
+    bool active = false;
+  };
+
+  void Retune();
+  /** @brief True if @p hz lies within the bandwidth of an RPM harmonic notch. */
+  bool CoveredByRpmNotch(float hz) const;
+  bool RetuneNotch(Notch& notch, float target_hz, float q, float max_hz);
+
+  Config config_{};
+  Notch notches_[kMaxNotches]{};
+  Notch spectrum_notches_[3][kMaxSpectrumNotches]{};
+  float motor_hz_[kMaxMotors] = {};
+  float spectrum_hz_[3][kMaxSpectrumNotches] = {};
+  uint8_t notch_count_ = 0;
+  uint8_t slot_count_ = 0;
+  uint8_t retune_cursor_ = 0;
+  uint8_t last_retunes_ = 0;
+};
+
+}  // namespace flight::filters
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+
+#include "flight/core/types.h"
+
+namespace flight::filters {
+
+/**
+ * @brief Sliding-DFT gyro spectrum analyzer.
+ *
+ * Each Push() updates every tracked bin of all three axes in O(bins), so the
+ * per-sample cost is fixed and small enough for the fast loop. A Hann window
+ * is applied in the frequency domain when peaks are searched; peak search is
+ * spread across ticks (one axis per Push()).
+ */
+class SpectrumAnalyzer {
+ public:
+  static constexpr uint16_t kWindowSize = 64;
+  static constexpr uint8_t kMaxBins = kWindowSize / 2;
+  static constexpr uint8_t kMaxPeaks = 3;
+
+  /** @brief Analyzer configuration. */
+  struct Config {
+    float sample_rate_hz = 1000.0f;
+    float min_hz = 40.0f;
+    float max_hz = 400.0f;
+    /** @brief Peak must exceed this multiple of the mean band magnitude. */
+    float peak_ratio = 2.0f;
+  };
+
+  /** @brief Detected spectral peak. */
+  struct Peak {
+    float hz = 0.0f;
+    float magnitude = 0.0f;
+  };
+
+  /** @brief Construct with analyzer config. */
+  explicit SpectrumAnalyzer(const Config& config);
+
+  /** @brief Compute bin twiddles and clear history. */
+  bool Initialize();
+
+  /** @brief Add one gyro sample and refresh peaks for one axis. */
+  void Push(const core::Vector3f& gyro);
+
+  /** @brief Recompute peaks of every axis now. */
+  void UpdateAllPeaks();
+
+  /** @brief Peaks of an axis sorted by magnitude (hz == 0 when unused). */
+  const Peak* Peaks(uint8_t axis) const { return peaks_[axis]; }
+  /** @brief Dominant peak frequency of an axis (0 when none). */
+  float DominantHz(uint8_t axis) const { return peaks_[axis][0].hz; }
+  /** @brief Windowed magnitude of a DFT bin for diagnostics. */
+  float BinMagnitude(uint8_t axis, uint8_t bin) const;
+  /** @brief Frequency resolution of one bin. */
+  float BinHz() const { return config_.sample_rate_hz / static_cast<float>(kWindowSize); }
+
+ private:
+  void UpdatePeaks(uint8_t axis);
+
+  Config config_{};
+  uint8_t first_bin_ = 1;
+  uint8_t last_bin_ = 1;
+  float twiddle_re_[kMaxBins + 1] = {};
+  float twiddle_im_[kMaxBins + 1] = {};
+  float bin_re_[3][kMaxBins + 1] = {};
+  float bin_im_[3][kMaxBins + 1] = {};
+  float history_[3][kWindowSize] = {};
+  uint16_t head_ = 0;
+  uint16_t filled_ = 0;
+  uint8_t peak_axis_ = 0;
+  float damping_n_ = 1.0f;
+  Peak peaks_[3][kMaxPeaks]{};
+};
+
+}  // namespace flight::filters
@@ -67,8 +67,28 @@ class IUart {
   virtual ~IUart() = default;
   /** @brief Write bytes to UART. */
   virtual bool Write(const uint8_t* data, size_t length) = 0;
-  /** @brief Read bytes from UART. */
+  /**
+   * @brief Read exactly @p length bytes from UART.
+   *
+   * Must not block: returns false without consuming anything when fewer
+   * than @p length bytes are buffered. ReadAvailable() and the serial
+   * receivers rely on this.
+   */
   virtual bool Read(uint8_t* out, size_t length) = 0;
+  /**
+   * @brief Read whatever is buffered, up to @p capacity bytes, without blocking.
+   *
+   * The default pulls one byte at a time through Read(), so it is only
+   * non-blocking if Read() keeps the contract above. Drivers with a
+   * receive FIFO or DMA ring should override it with a bulk copy.
+   */
+  virtual size_t ReadAvailable(uint8_t* out, size_t capacity) {
+    size_t count = 0;
+    while (count < capacity && Read(out + count, 1)) {
+      ++count;
+    }
+    return count;
+  }
 };
 
 /**
@@ -83,4 +103,25 @@ class IGpio {
   virtual bool Read() const = 0;
 };
 
+/**
+ * @brief Hardware PWM slice abstraction (counter, wrap and two compare channels).
+ *
+ * Compare levels are double-buffered: a new level takes effect when the
+ * slice counter next wraps, so slices enabled together latch together.
+ */
+class IPwm {
+ public:
+  virtual ~IPwm() = default;
+  /** @brief Counter clock in Hz before the slice divider. */
+  virtual uint32_t ClockHz() const = 0;
+  /** @brief Set the integer clock divider and wrap value of a slice. */
+  virtual bool ConfigureSlice(uint8_t slice, uint8_t divider, uint16_t top) = 0;
+  /** @brief Route a GPIO to its PWM slice output. */
+  virtual void EnablePin(uint32_t gpio) = 0;
+  /** @brief Stage a compare level for the next period. */
+  virtual void SetLevel(uint8_t slice, uint8_t channel, uint16_t level) = 0;
+  /** @brief Start all slices in @p slice_mask in phase. */
+  virtual void EnableSlices(uint32_t slice_mask) = 0;
+};
+
 }  // namespace flight::hal
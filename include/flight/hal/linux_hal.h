@@ -0,0 +1,29 @@
+#pragma once
+
+#include <thread>
+
+#include "flight/hal/hal.h"
+
+namespace flight::hal {
+
+/**
+ * @brief Host clock on CLOCK_MONOTONIC.
+ *
+ * UdpReceiver uses the same clock when no ITime is configured, so its
+ * received_us and a vehicle driven by LinuxTime share one time base.
+ */
+class LinuxTime final : public ITime {
+ public:
+  uint64_t NowUs() const override;
+  void SleepUs(uint64_t duration_us) override;
+};
+
+/**
+ * @brief Pin @p thread to @p cpu.
+ *
+ * A negative @p cpu leaves the thread floating and returns true. False if
+ * the affinity call fails or off Linux.
+ */
+bool PinThreadToCpu(std::thread& thread, int cpu);
+
+}  // namespace flight::hal
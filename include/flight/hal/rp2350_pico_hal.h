@@ -43,4 +43,16 @@ class Rp2350I2c final : public II2c {
   Config config_{};
 };
 
+/**
+ * @brief RP2350 hardware PWM slices.
+ */
+class Rp2350Pwm final : public IPwm {
+ public:
+  uint32_t ClockHz() const override;
+  bool ConfigureSlice(uint8_t slice, uint8_t divider, uint16_t top) override;
+  void EnablePin(uint32_t gpio) override;
+  void SetLevel(uint8_t slice, uint8_t channel, uint16_t level) override;
+  void EnableSlices(uint32_t slice_mask) override;
+};
+
 }  // namespace flight::hal
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace flight::io {
+
+/**
+ * @brief Something the reactor services on its own thread.
+ */
+class IIoEndpoint {
+ public:
+  virtual ~IIoEndpoint() = default;
+  /** @brief Descriptor to watch for readability, or -1 for none. */
+  virtual int ReadableFd() const { return -1; }
+  /** @brief Reactor thread: ReadableFd() is readable. */
+  virtual void OnReadable() {}
+  /** @brief Reactor thread: called after every wake-up (readiness or timeout). */
+  virtual void OnWake() {}
+};
+
+/**
+ * @brief Linux I/O thread that owns the network descriptors (epoll).
+ *
+ * Endpoints are registered before Start(). The thread sleeps in
+ * epoll_wait() until a descriptor is readable or `wake_interval_us`
+ * passes. It then runs OnReadable() for the ready endpoints and OnWake()
+ * for all of them. Outbound queues are drained on that periodic wake, so
+ * producers never have to signal the thread with a syscall.
+ */
+class IoReactor {
+ public:
+  static constexpr size_t kMaxEndpoints = 8;
+
+  struct Config {
+    /** @brief Longest sleep between wake-ups; bounds outbound queue latency. */
+    uint32_t wake_interval_us = 1000;
+    /** @brief CPU to pin the reactor thread to, or -1 to leave it floating. */
+    int cpu = -1;
+  };
+
+  IoReactor();
+  explicit IoReactor(const Config& config);
+  ~IoReactor();
+  IoReactor(const IoReactor&) = delete;
+  IoReactor& operator=(const IoReactor&) = delete;
+
+  /** @brief Register an endpoint; false when running or full. */
+  bool Add(IIoEndpoint* endpoint);
+  /** @brief Create the epoll set and start the thread. */
+  bool Start();
+  /** @brief Stop and join the thread. */
+  void Stop();
+  bool Running() const { return running_.load(std::memory_order_acquire); }
+  /** @brief Wake-ups so far (for tests and diagnostics). */
+  uint64_t Wakeups() const { return wakeups_.load(std::memory_order_relaxed); }
+
+ private:
+  void Run();
+
+  Config config_{};
+  IIoEndpoint* endpoints_[kMaxEndpoints] = {nullptr};
+  size_t endpoint_count_ = 0;
+  int epoll_fd_ = -1;
+  int stop_fd_ = -1;
+  std::thread thread_;
+  std::atomic<bool> running_{false};
+  std::atomic<uint64_t> wakeups_{0};
+};
+
+}  // namespace flight::io
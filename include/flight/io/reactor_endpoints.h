@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "flight/core/spsc_ring.h"
+#include "flight/core/triple_buffer.h"
+#include "flight/io/io_reactor.h"
+#include "flight/receiver/udp_receiver.h"
+#include "flight/telemetry/async_telemetry.h"
+#include "flight/telemetry/telemetry.h"
+
+namespace flight::io {
+
+/**
+ * @brief UdpReceiver moved onto the reactor thread.
+ *
+ * The reactor drains the socket (and answers time sync) when it becomes
+ * readable and publishes the newest frame into a triple buffer. Read() on
+ * the control loop is a few atomic operations and no syscall.
+ */
+class ReactorCommandReceiver final : public receiver::ICommandReceiver, public IIoEndpoint {
+ public:
+  explicit ReactorCommandReceiver(receiver::UdpReceiver& udp);
+
+  /** @brief Open the socket; call before IoReactor::Start(). */
+  bool Initialize() override;
+  std::optional<receiver::CommandFrame> Read() override;
+  size_t ReadBatch(receiver::CommandFrame* out, size_t capacity) override;
+
+  int ReadableFd() const override { return udp_.Fd(); }
+  void OnReadable() override;
+
+  /** @brief Frames published by the reactor. */
+  uint64_t Published() const { return published_.load(std::memory_order_relaxed); }
+
+ private:
+  receiver::UdpReceiver& udp_;
+  core::TripleBuffer<receiver::CommandFrame> mailbox_;
+  std::atomic<uint64_t> published_{0};
+};
+
+/**
+ * @brief AsyncTelemetrySink drained by the reactor thread.
+ *
+ * Publish() only enqueues; the reactor hands queued snapshots to the
+ * wrapped sink (e.g. UdpTelemetrySender) on its next wake-up. A full queue
+ * drops according to @p drop and counts the loss.
+ */
+class ReactorTelemetrySink final : public telemetry::ITelemetrySink, public IIoEndpoint {
+ public:
+  static constexpr size_t kQueueDepth = telemetry::AsyncTelemetrySink::kQueueDepth;
+
+  explicit ReactorTelemetrySink(telemetry::ITelemetrySink& sink,
+                                core::DropPolicy drop = core::DropPolicy::kDropOldest);
+
+  bool Initialize() override { return async_.Initialize(); }
+  void Publish(const telemetry::TelemetrySnapshot& snapshot) override { async_.Publish(snapshot); }
+
+  void OnWake() override { async_.Drain(); }
+
+  /** @brief Snapshots lost to a full queue. */
+  uint64_t Dropped() const { return async_.Dropped(); }
+  /** @brief Snapshots handed to the wrapped sink. */
+  uint64_t Forwarded() const { return async_.Forwarded(); }
+
+ private:
+  telemetry::AsyncTelemetrySink async_;
+};
+
+}  // namespace flight::io
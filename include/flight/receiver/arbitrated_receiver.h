@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "flight/hal/hal.h"
+#include "flight/receiver/receiver.h"
+
+namespace flight::receiver {
+
+/**
+ * @brief Receiver that arbitrates between several command links.
+ *
+ * Every read polls all links, so a backup link is already up to date when
+ * the preferred one drops and failover happens in the same tick. A link is
+ * stale once its newest frame is older than `missed_frames` of its own
+ * observed frame interval (capped at `timeout_us`). Links are preferred in
+ * configuration order. A stale link, a link reporting failsafe, or one whose
+ * quality is below `min_quality` is skipped while a better one is
+ * available. When no link is fresh, Read() returns a frame with `failsafe`
+ * set.
+ *
+ * Frame age and interval are measured on `Config::time` when a link is
+ * polled. The links' own `received_us` stamps may come from different
+ * clocks, so they are passed through but not compared.
+ */
+class ArbitratedReceiver final : public ICommandReceiver {
+ public:
+  static constexpr size_t kMaxLinks = 4;
+  /** @brief Frames taken from one link per poll. */
+  static constexpr size_t kPollBatch = 8;
+
+  struct Config {
+    /** @brief Links in priority order (index 0 preferred). */
+    ICommandReceiver* links[kMaxLinks] = {nullptr};
+    size_t link_count = 0;
+    /** @brief Clock for frame age; required. */
+    const hal::ITime* time = nullptr;
+    /** @brief Upper bound on frame age before a link is stale. */
+    uint32_t timeout_us = 100000;
+    /** @brief Missed frame intervals after which a link is stale. */
+    float missed_frames = 3.0f;
+    /** @brief Links below this quality are used only when nothing better is fresh. */
+    float min_quality = 0.5f;
+    /** @brief Smoothing for quality and frame interval (per frame). */
+    float alpha = 0.1f;
+    /** @brief Consecutive frames before a recovered link is preferred again. */
+    uint32_t recovery_frames = 3;
+  };
+
+  /** @brief Per-link state, updated on every poll. */
+  struct LinkStatus {
+    bool initialized = false;
+    bool has_frame = false;
+    bool fresh = false;
+    /** @brief Poll time (Config::time) at which the newest frame was taken. */
+    uint64_t last_us = 0;
+    /** @brief Smoothed frame interval. */
+    float interval_us = 0.0f;
+    /** @brief Smoothed delivered fraction from sequence gaps, in [0, 1]. */
+    float quality = 1.0f;
+    uint32_t frames = 0;
+    /** @brief Frames missing from the sequence. */
+    uint32_t lost = 0;
+    /** @brief Frames received since the link was last stale. */
+    uint32_t streak = 0;
+    CommandFrame last{};
+  };
+
+  explicit ArbitratedReceiver(const Config& config);
+
+  /** @brief Initialize every link; true if at least one came up. */
+  bool Initialize() override;
+  /**
+   * @brief Poll all links and return the selected link's newest frame.
+   *
+   * Returns nothing when the selected link has no new frame, the backup's
+   * latest frame on a switch, and a failsafe frame while no link is fresh.
+   */
+  std::optional<CommandFrame> Read() override;
+  /** @brief At most one frame per tick: the arbitrated one. */
+  size_t ReadBatch(CommandFrame* out, size_t capacity) override;
+
+  /** @brief Selected link index, or -1 when in failsafe (or before the first frame). */
+  int ActiveLink() const { return active_; }
+  const LinkStatus& Status(size_t link) const { return status_[link]; }
+  /** @brief Number of changes of the selected link, including to and from failsafe. */
+  uint32_t Switches() const { return switches_; }
+
+ private:
+  void Poll(size_t link, uint64_t now_us, bool& updated);
+  bool Usable(size_t link, bool require_quality) const;
+  int Select() const;
+
+  Config config_{};
+  LinkStatus status_[kMaxLinks]{};
+  int active_ = -1;
+  bool any_frame_ = false;
+  uint32_t switches_ = 0;
+};
+
+}  // namespace flight::receiver
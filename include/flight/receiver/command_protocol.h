@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flight/core/protocol_magics.h"
+#include "flight/receiver/receiver.h"
+
+namespace flight::receiver {
+
+using core::kCommandMagic;
+using core::kTimeSyncMagic;
+
+/** @brief v1 command packet (no sequence, no timestamp). */
+struct CommandPacketV1 {
+  uint32_t magic = kCommandMagic;
+  uint8_t version = 1;
+  uint8_t channel_count = 0;
+  float channels[16] = {0};
+};
+
+/**
+ * @brief v2 command packet.
+ *
+ * `sent_us` is the send time already converted to the vehicle clock with
+ * the offset from the time-sync exchange, so the vehicle can measure uplink
+ * latency without knowing the ground clock. 0 means not synchronized.
+ */
+struct CommandPacketV2 {
+  uint32_t magic = kCommandMagic;
+  uint8_t version = 2;
+  uint8_t channel_count = 0;
+  uint16_t flags = 0;
+  uint32_t sequence = 0;
+  uint32_t reserved = 0;
+  uint64_t sent_us = 0;
+  float channels[16] = {0};
+};
+
+/**
+ * @brief Clock-offset exchange (NTP-style, four timestamps).
+ *
+ * The ground sends a request with `t0`; the vehicle answers on the same
+ * socket with `t1` (receive) and `t2` (reply) in its own clock.
+ */
+struct TimeSyncPacket {
+  enum Kind : uint8_t { kRequest = 0, kReply = 1 };
+  uint32_t magic = kTimeSyncMagic;
+  uint8_t version = 1;
+  uint8_t kind = kRequest;
+  uint16_t reserved = 0;
+  uint32_t id = 0;
+  uint32_t reserved2 = 0;
+  uint64_t t0_us = 0;
+  uint64_t t1_us = 0;
+  uint64_t t2_us = 0;
+};
+
+static_assert(sizeof(CommandPacketV1) == 72, "v1 layout is part of the wire format");
+static_assert(sizeof(CommandPacketV2) == 88, "v2 layout is part of the wire format");
+static_assert(sizeof(TimeSyncPacket) == 40, "time-sync layout is part of the wire format");
+
+/**
+ * @brief Fixed part of a v3 (compact) command packet.
+ *
+ * On the wire the header is followed by one little-endian int16 per set bit
+ * of `channel_mask` (channel value * 32767, in channel order) and a CRC-16
+ * over everything before it. Channels below `channel_count` whose bit is
+ * clear decode as 0, so only non-zero channels are sent.
+ */
+struct CompactCommandHeader {
+  uint32_t magic = kCommandMagic;
+  uint8_t version = 3;
+  uint8_t channel_count = 0;
+  uint16_t channel_mask = 0;
+  uint64_t sent_us = 0;
+  uint32_t sequence = 0;
+};
+
+/** @brief Header bytes on the wire (the struct has tail padding). */
+constexpr size_t kCompactHeaderBytes = offsetof(CompactCommandHeader, sequence) + sizeof(uint32_t);
+/** @brief Largest v3 packet: all 16 channels plus the CRC. */
+constexpr size_t kMaxCompactCommandPacket = kCompactHeaderBytes + 16 * sizeof(int16_t) + 2;
+
+static_assert(kCompactHeaderBytes == 20, "v3 header layout is part of the wire format");
+
+/** @brief Largest datagram the command socket has to hold. */
+constexpr size_t kMaxCommandDatagram = sizeof(CommandPacketV2);
+
+/** @brief Decode a v1, v2 or v3 command packet; v2/v3 also fill sequence and sent_us. */
+bool DecodeCommandPacket(const void* data, size_t length, CommandFrame& frame);
+/** @brief Encode @p frame as a v2 packet. */
+CommandPacketV2 EncodeCommandPacket(const CommandFrame& frame);
+/**
+ * @brief Encode @p frame as a v3 (compact) packet into @p out.
+ * @return Packet length, or 0 if @p capacity is too small.
+ */
+size_t EncodeCompactCommandPacket(const CommandFrame& frame, void* out, size_t capacity);
+
+/** @brief Channel value in [-1, 1] to int16 (clamped; NaN maps to 0). */
+int16_t QuantizeChannel(float value);
+/** @brief CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF). */
+uint16_t Crc16Ccitt(const void* data, size_t length);
+
+/** @brief True if @p a is after @p b, allowing for 32-bit wrap. */
+inline bool IsNewerSequence(uint32_t a, uint32_t b) {
+  return static_cast<int32_t>(a - b) > 0;
+}
+
+/** @brief Parse a time-sync request; false for anything else. */
+bool DecodeTimeSyncRequest(const void* data, size_t length, TimeSyncPacket& request);
+/** @brief Answer @p request with receive time @p t1_us and reply time @p t2_us. */
+TimeSyncPacket MakeTimeSyncReply(const TimeSyncPacket& request, uint64_t t1_us, uint64_t t2_us);
+
+/** @brief Ground-side result of one exchange. */
+struct ClockOffsetSample {
+  /** @brief Vehicle clock minus ground clock. */
+  int64_t offset_us = 0;
+  /** @brief Round trip without the vehicle's turnaround time. */
+  int64_t round_trip_us = 0;
+};
+
+/** @brief Offset and round trip from a reply received at ground time @p t3_us. */
+ClockOffsetSample EstimateClockOffset(const TimeSyncPacket& reply, uint64_t t3_us);
+
+}  // namespace flight::receiver
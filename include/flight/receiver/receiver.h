@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 
+#include "flight/core/batch_read.h"
+
 namespace flight::receiver {
 
 /** @brief Normalized command channels coming from a receiver. */
@@ -10,6 +13,14 @@ struct CommandFrame {
   float channels[16] = {0};
   uint8_t channel_count = 0;
   bool failsafe = false;
+  /** @brief Frame sequence (transport-specific; 0 when unknown). */
+  uint32_t sequence = 0;
+  /** @brief Time between arrival and Read(), in microseconds (0 when unknown). */
+  uint32_t age_us = 0;
+  /** @brief Sender timestamp in the vehicle clock (0 when unknown). */
+  uint64_t sent_us = 0;
+  /** @brief Arrival time in the vehicle clock (0 when unknown). */
+  uint64_t received_us = 0;
 };
 
 /** @brief Receiver interface (ELRS, SBUS, UDP, etc.). */
@@ -20,6 +31,10 @@ class ICommandReceiver {
   virtual bool Initialize() = 0;
   /** @brief Read a command frame if available. */
   virtual std::optional<CommandFrame> Read() = 0;
+  /** @brief Drain up to @p capacity pending command frames; returns the count written. */
+  virtual size_t ReadBatch(CommandFrame* out, size_t capacity) {
+    return core::DrainReads([this] { return Read(); }, out, capacity);
+  }
 };
 
 }  // namespace flight::receiver
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flight/receiver/receiver.h"
+
+namespace flight::receiver {
+
+/** @brief CRC-8/DVB-S2 (poly 0xD5), as used by CRSF. */
+uint8_t Crc8DvbS2(const uint8_t* data, size_t length);
+
+/** @brief Unpack 16 little-endian 11-bit channels (22 bytes), shared by CRSF and SBUS. */
+void UnpackRcChannels(const uint8_t* packed, uint16_t* raw);
+
+/** @brief Map an 11-bit CRSF/SBUS value (172..1811, centre 992) to [-1, 1]. */
+float NormalizeRcChannel(uint16_t raw);
+
+/** @brief Counters kept by the serial parsers. */
+struct SerialParserStats {
+  /** @brief RC channel frames delivered. */
+  uint32_t frames = 0;
+  /** @brief Valid frames of other types (CRSF telemetry, link statistics). */
+  uint32_t other_frames = 0;
+  /** @brief Frames rejected by CRC (CRSF) or end byte (SBUS). */
+  uint32_t errors = 0;
+  /** @brief Bytes skipped while looking for a sync byte. */
+  uint32_t discarded_bytes = 0;
+};
+
+/**
+ * @brief Fixed byte ring the serial parsers buffer into.
+ *
+ * Dropping bytes from the front only moves the head, so resyncing after a
+ * bad length or CRC costs nothing per buffered byte.
+ */
+template <size_t Capacity>
+class SerialByteRing {
+ public:
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                "capacity must be a power of two");
+
+  /** @brief Append @p byte; the caller keeps Size() below Capacity. */
+  void Push(uint8_t byte) {
+    bytes_[(head_ + size_) & (Capacity - 1)] = byte;
+    ++size_;
+  }
+  /** @brief Byte @p offset from the oldest one. */
+  uint8_t operator[](size_t offset) const { return bytes_[(head_ + offset) & (Capacity - 1)]; }
+  /** @brief Copy @p count bytes starting at @p offset into contiguous @p out. */
+  void Copy(size_t offset, size_t count, uint8_t* out) const {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = (*this)[offset + i];
+    }
+  }
+  void Drop(size_t count) {
+    head_ = (head_ + count) & (Capacity - 1);
+    size_ -= count;
+  }
+  void Clear() { head_ = size_ = 0; }
+  size_t Size() const { return size_; }
+
+ private:
+  uint8_t bytes_[Capacity] = {0};
+  size_t head_ = 0;
+  size_t size_ = 0;
+};
+
+/**
+ * @brief Incremental CRSF (ExpressLRS / Crossfire) frame parser.
+ *
+ * Frames are `[sync][len][type][payload][crc8]` where `len` counts type,
+ * payload and CRC. Bytes are pushed one at a time into a fixed ring, so a
+ * frame may arrive split across any number of UART reads. When the length
+ * byte or CRC is bad, the parser drops one byte and rescans what it has
+ * already buffered for the next sync byte.
+ */
+class CrsfParser {
+ public:
+  static constexpr uint32_t kBaud = 420000;
+  /** @brief 8N1: start + 8 data + stop. */
+  static constexpr uint32_t kBitsPerByte = 10;
+  static constexpr size_t kMaxFrame = 64;
+  static constexpr uint8_t kRcChannelsPacked = 0x16;
+
+  /** @brief Feed one byte; true when it completes an RC channels frame in @p frame. */
+  bool Push(uint8_t byte, CommandFrame& frame);
+  /** @brief Drop any partial frame. */
+  void Reset() { ring_.Clear(); }
+
+  const SerialParserStats& Stats() const { return stats_; }
+
+ private:
+  SerialByteRing<kMaxFrame> ring_;
+  SerialParserStats stats_{};
+};
+
+/**
+ * @brief Incremental SBUS frame parser.
+ *
+ * SBUS frames are 25 bytes: header 0x0F, 22 bytes of channels, a flag byte
+ * and an end byte (0x00, or 0x?4 for SBUS2). There is no CRC, so the end
+ * byte is the only integrity check. The failsafe flag maps to
+ * CommandFrame::failsafe.
+ */
+class SbusParser {
+ public:
+  static constexpr uint32_t kBaud = 100000;
+  /** @brief 8E2: start + 8 data + parity + 2 stop. */
+  static constexpr uint32_t kBitsPerByte = 12;
+  static constexpr size_t kFrameBytes = 25;
+  static constexpr uint8_t kHeader = 0x0F;
+  static constexpr uint8_t kFlagFrameLost = 0x04;
+  static constexpr uint8_t kFlagFailsafe = 0x08;
+
+  /** @brief Feed one byte; true when it completes a frame in @p frame. */
+  bool Push(uint8_t byte, CommandFrame& frame);
+  void Reset() { ring_.Clear(); }
+
+  const SerialParserStats& Stats() const { return stats_; }
+  /** @brief Frames the receiver flagged as lost since construction. */
+  uint32_t LostFrames() const { return lost_frames_; }
+
+ private:
+  /** @brief Smallest power of two holding one frame. */
+  SerialByteRing<32> ring_;
+  static_assert(kFrameBytes <= 32, "ring must hold a full SBUS frame");
+  SerialParserStats stats_{};
+  uint32_t lost_frames_ = 0;
+};
+
+}  // namespace flight::receiver
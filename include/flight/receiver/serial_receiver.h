@@ -0,0 +1,103 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "flight/hal/hal.h"
+#include "flight/receiver/receiver.h"
+#include "flight/receiver/serial_protocols.h"
+
+namespace flight::receiver {
+
+/**
+ * @brief Command receiver for a serial RC link (see CrsfReceiver, SbusReceiver).
+ *
+ * Each read drains the UART in fixed chunks and pushes the bytes through
+ * @p Parser, keeping the newest frames like UdpReceiver does. A frame's
+ * arrival time is the chunk read time minus the wire time of the bytes that
+ * came after its last byte, so `received_us` does not depend on how often
+ * the loop polls. Frames are numbered in arrival order.
+ */
+template <typename Parser>
+class SerialReceiver final : public ICommandReceiver {
+ public:
+  struct Config {
+    hal::IUart* uart = nullptr;
+    /** @brief Clock for received_us; frames are not timestamped if null. */
+    const hal::ITime* time = nullptr;
+    uint32_t baud = Parser::kBaud;
+  };
+
+  /** @brief Bytes taken from the UART per ReadAvailable() call. */
+  static constexpr size_t kChunk = 64;
+
+  explicit SerialReceiver(const Config& config) : config_(config) {}
+
+  bool Initialize() override {
+    parser_.Reset();
+    sequence_ = 0;
+    return config_.uart != nullptr && config_.baud > 0;
+  }
+
+  std::optional<CommandFrame> Read() override {
+    CommandFrame frame{};
+    if (ReadBatch(&frame, 1) == 0) {
+      return std::nullopt;
+    }
+    return frame;
+  }
+
+  /** @brief Parse everything buffered and return the newest @p capacity frames, oldest first. */
+  size_t ReadBatch(CommandFrame* out, size_t capacity) override {
+    if (!config_.uart || capacity == 0) {
+      return 0;
+    }
+    const uint64_t byte_ns = 1000000000ull * Parser::kBitsPerByte / config_.baud;
+    size_t stored = 0;
+    size_t head = 0;
+    uint8_t chunk[kChunk];
+    CommandFrame frame{};
+    for (;;) {
+      const size_t count = config_.uart->ReadAvailable(chunk, kChunk);
+      if (count == 0) {
+        break;
+      }
+      const uint64_t now_us = config_.time ? config_.time->NowUs() : 0;
+      for (size_t i = 0; i < count; ++i) {
+        if (!parser_.Push(chunk[i], frame)) {
+          continue;
+        }
+        const uint32_t age_us = static_cast<uint32_t>((count - 1 - i) * byte_ns / 1000);
+        frame.sequence = ++sequence_;
+        frame.age_us = age_us;
+        frame.received_us = now_us > age_us ? now_us - age_us : 0;
+        out[head] = frame;
+        head = head + 1 == capacity ? 0 : head + 1;
+        stored = std::min(stored + 1, capacity);
+      }
+      if (count < kChunk) {
+        break;
+      }
+    }
+    if (stored == capacity && head != 0) {
+      std::rotate(out, out + head, out + capacity);
+    }
+    return stored;
+  }
+
+  const Parser& GetParser() const { return parser_; }
+
+ private:
+  Config config_{};
+  Parser parser_{};
+  uint32_t sequence_ = 0;
+};
+
+/** @brief CRSF / ExpressLRS receiver at 420 kbaud. */
+using CrsfReceiver = SerialReceiver<CrsfParser>;
+/** @brief SBUS receiver at 100 kbaud (UART inversion is a pin setting). */
+using SbusReceiver = SerialReceiver<SbusParser>;
+
+}  // namespace flight::receiver
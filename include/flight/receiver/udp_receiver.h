@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <optional>
 
+#include "flight/hal/hal.h"
 #include "flight/receiver/receiver.h"
 
 namespace flight::receiver {
@@ -10,30 +11,86 @@ namespace flight::receiver {
 /**
  * @brief UDP receiver for command frames.
  *
- * Packet format:
- * - magic: 0x4D465454 ("MFTT")
- * - version: 1
- * - channel_count
- * - channels[16]
+ * Accepts v1, v2 and compact v3 command packets (see command_protocol.h)
+ * and answers time-sync requests on the same socket. A v3 packet with a
+ * bad length, channel mask or CRC-16 is rejected and counted in
+ * DrainStats::invalid. v2 and v3 frames older than the newest
+ * sequence seen are discarded, except that the filter resyncs to a frame
+ * more than kSequenceResyncWindow behind (a restarted ground station) or
+ * one arriving after `resync_timeout_us` without an accepted frame.
+ *
+ * Every read drains the whole socket with recvmmsg(), so a ground station
+ * that sends faster than the loop runs cannot build up a backlog of stale
+ * commands. Only the newest frames are returned; the rest are counted as
+ * dropped.
  */
 class UdpReceiver final : public ICommandReceiver {
  public:
   /** @brief UDP configuration options. */
   struct Config {
     uint16_t port = 14550;
+    /**
+     * @brief Vehicle clock for received_us and time sync; hal::LinuxTime if null.
+     *
+     * Pass the vehicle's VehicleDependencies::time so received_us and the
+     * actuator write time are measured on the same clock.
+     */
+    const hal::ITime* time = nullptr;
+    /** @brief Link silence after which any sequence is accepted; match the failsafe timeout. */
+    uint32_t resync_timeout_us = 100000;
+  };
+
+  /** @brief Result of the last drain. */
+  struct DrainStats {
+    /** @brief Datagrams taken from the socket. */
+    uint32_t datagrams = 0;
+    /** @brief Valid frames superseded by newer ones. */
+    uint32_t dropped = 0;
+    /** @brief Datagrams that failed to decode. */
+    uint32_t invalid = 0;
+    /** @brief v2/v3 frames at or behind the newest sequence already seen. */
+    uint32_t out_of_order = 0;
+    /** @brief Times the sequence filter restarted from an older sequence. */
+    uint32_t resyncs = 0;
+    /** @brief Time-sync requests answered. */
+    uint32_t time_sync = 0;
+    /** @brief Age of the newest returned frame in microseconds. */
+    uint32_t age_us = 0;
   };
 
+  /** @brief recvmmsg() batch size. */
+  static constexpr size_t kBatch = 16;
+  /** @brief Backward sequence jump treated as a sender restart rather than reordering. */
+  static constexpr uint32_t kSequenceResyncWindow = 1024;
+
   /** @brief Construct receiver with config. */
   explicit UdpReceiver(const Config& config);
 
   /** @brief Initialize UDP socket. */
   bool Initialize() override;
-  /** @brief Receive latest frame (non-blocking). */
+  /** @brief Drain the socket and return the newest frame (non-blocking). */
   std::optional<CommandFrame> Read() override;
+  /** @brief Drain the socket and return the newest @p capacity frames, oldest first. */
+  size_t ReadBatch(CommandFrame* out, size_t capacity) override;
+
+  const DrainStats& LastDrain() const { return last_drain_; }
+  /** @brief Socket descriptor (-1 before Initialize()), for an external poller. */
+  int Fd() const { return socket_fd_; }
+  /** @brief Frames dropped as stale or out of order since Initialize(). */
+  uint64_t TotalDropped() const { return total_dropped_; }
 
  private:
+  uint64_t NowUs() const;
+  /** @brief Sequence filter: true to accept @p sequence, counting drops and resyncs. */
+  bool AcceptSequence(uint32_t sequence, uint64_t now_us);
+
   Config config_{};
   int socket_fd_ = -1;
+  bool have_sequence_ = false;
+  uint32_t last_sequence_ = 0;
+  uint64_t last_accept_us_ = 0;
+  DrainStats last_drain_{};
+  uint64_t total_dropped_ = 0;
 };
 
 }  // namespace flight::receiver
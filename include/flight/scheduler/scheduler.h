@@ -12,12 +12,17 @@ struct Task {
   uint32_t rate_hz = 0;
   std::function<void(float)> callback;
   float accumulator_s = 0.0f;
+  /** @brief Time since the task last ran; passed to the callback. */
+  float elapsed_s = 0.0f;
 };
 
 /**
  * @brief Simple fixed-rate scheduler.
  *
- * Each task runs at its configured rate when Tick() advances time.
+ * Each task runs at its configured rate when Tick() advances time, at
+ * most once per Tick(). If ticks are slower than a task's rate, it runs
+ * every tick with the real elapsed time instead of catching up on stale
+ * state.
  */
 class Scheduler {
  public:
@@ -25,6 +30,8 @@ class Scheduler {
   void AddTask(const Task& task);
   /** @brief Advance scheduler by dt seconds. */
   void Tick(float dt_s);
+  /** @brief Restart every task's period from now. */
+  void Reset();
 
  private:
   std::vector<Task> tasks_;
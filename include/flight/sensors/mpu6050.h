@@ -22,6 +22,8 @@ class Mpu6050Imu final : public IImu {
   bool Initialize() override;
   /** @brief Read latest IMU sample. */
   std::optional<ImuSample> Read() override;
+  /** @brief Read at most one sample (the FIFO is not enabled). */
+  size_t ReadBatch(ImuSample* out, size_t capacity) override;
 
  private:
   hal::II2c* i2c_ = nullptr;
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "flight/core/types.h"
+#include "flight/sensors/sensors.h"
+
+namespace flight::sensors {
+
+/**
+ * @brief Read-only window over the most recent samples of a history buffer.
+ *
+ * Each channel is a contiguous, unit-stride array of @c size samples ordered
+ * oldest to newest. The view points into the producer's storage, which the
+ * producer may be rewriting, so samples are read with relaxed atomic loads
+ * (plain loads on the targets we build for). Use
+ * SoaRingBuffer::StillValid() after consuming it to detect overwrites.
+ */
+template <size_t Channels>
+struct HistoryView {
+  const std::atomic<float>* channels[Channels] = {};
+  const std::atomic<core::TimestampUs>* timestamps = nullptr;
+  size_t size = 0;
+  /** @brief Sequence index of the oldest sample in the view. */
+  uint64_t first_index = 0;
+
+  /** @brief Sample @p index (0 = oldest) of @p channel. */
+  float Value(size_t channel, size_t index) const {
+    return channels[channel][index].load(std::memory_order_relaxed);
+  }
+  core::TimestampUs Timestamp(size_t index) const {
+    return timestamps[index].load(std::memory_order_relaxed);
+  }
+  /** @brief Copy the @c size samples of @p channel into @p out. */
+  void CopyChannel(size_t channel, float* out) const {
+    for (size_t i = 0; i < size; ++i) {
+      out[i] = Value(channel, i);
+    }
+  }
+};
+
+/**
+ * @brief Fixed-capacity structure-of-arrays sample history.
+ *
+ * Storage holds Capacity + 1 slots: the spare one takes the producer's
+ * in-progress write, so a full Capacity-sample view stays valid until the
+ * next sample really overwrites it. Every sample is written twice (slot i
+ * and i + kSlots), so the last N samples of each channel are always
+ * contiguous and can be handed out without copying or wrap handling. One
+ * producer (the fast loop) pushes; any number of readers take views and
+ * validate them seqlock-style afterwards.
+ */
+template <size_t Channels, size_t Capacity>
+class SoaRingBuffer {
+ public:
+  static_assert(Channels > 0, "SoaRingBuffer needs at least one channel");
+  static_assert(Capacity > 0, "SoaRingBuffer needs a non-zero capacity");
+
+  static constexpr size_t kChannels = Channels;
+  static constexpr size_t kCapacity = Capacity;
+  static constexpr size_t kSlots = Capacity + 1;
+
+  /** @brief Append one sample (producer only). */
+  void Push(const float (&values)[Channels], core::TimestampUs timestamp_us) {
+    const uint64_t index = count_.load(std::memory_order_relaxed);
+    const size_t slot = static_cast<size_t>(index % kSlots);
+    // A reader that sees any of the stores below also sees count_ == index,
+    // so StillValid() knows this slot is in flight.
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t c = 0; c < Channels; ++c) {
+      data_[c][slot].store(values[c], std::memory_order_relaxed);
+      data_[c][slot + kSlots].store(values[c], std::memory_order_relaxed);
+    }
+    timestamps_[slot].store(timestamp_us, std::memory_order_relaxed);
+    timestamps_[slot + kSlots].store(timestamp_us, std::memory_order_relaxed);
+    count_.store(index + 1, std::memory_order_release);
+  }
+
+  /** @brief Total number of samples ever pushed. */
+  uint64_t Count() const { return count_.load(std::memory_order_acquire); }
+
+  /** @brief Number of samples currently retained. */
+  size_t Size() const {
+    const uint64_t count = Count();
+    return count < Capacity ? static_cast<size_t>(count) : Capacity;
+  }
+
+  /** @brief View of the newest @p length samples (clamped to Size()). */
+  HistoryView<Channels> Latest(size_t length) const {
+    const uint64_t count = Count();
+    const size_t available = count < Capacity ? static_cast<size_t>(count) : Capacity;
+    HistoryView<Channels> view{};
+    view.size = length < available ? length : available;
+    view.first_index = count - view.size;
+    const size_t start = static_cast<size_t>(view.first_index % kSlots);
+    for (size_t c = 0; c < Channels; ++c) {
+      view.channels[c] = &data_[c][start];
+    }
+    view.timestamps = &timestamps_[start];
+    return view;
+  }
+
+  /**
+   * @brief Check that a view was not overwritten while it was read.
+   *
+   * The producer may be writing sample Count() right now, which reuses the
+   * slot of sample Count() - kSlots.
+   */
+  bool StillValid(const HistoryView<Channels>& view) const {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t count = count_.load(std::memory_order_relaxed);
+    return count + 1 <= view.first_index + kSlots;
+  }
+
+  /** @brief Drop all samples (not safe while readers hold views). */
+  void Clear() { count_.store(0, std::memory_order_release); }
+
+ private:
+  static_assert(sizeof(std::atomic<float>) == sizeof(float), "samples stay unit-stride");
+
+  alignas(16) std::atomic<float> data_[Channels][2 * kSlots] = {};
+  alignas(16) std::atomic<core::TimestampUs> timestamps_[2 * kSlots] = {};
+  std::atomic<uint64_t> count_{0};
+};
+
+/** @brief Channel order of ImuHistory. */
+enum ImuChannel : uint8_t {
+  kImuAccelX = 0,
+  kImuAccelY,
+  kImuAccelZ,
+  kImuGyroX,
+  kImuGyroY,
+  kImuGyroZ,
+  kImuChannelCount,
+};
+
+/** @brief Channel order of MagHistory. */
+enum MagChannel : uint8_t {
+  kMagX = 0,
+  kMagY,
+  kMagZ,
+  kMagChannelCount,
+};
+
+/** @brief Channel order of BaroHistory. */
+enum BaroChannel : uint8_t {
+  kBaroPressure = 0,
+  kBaroTemperature,
+  kBaroAltitude,
+  kBaroChannelCount,
+};
+
+/** @brief IMU history (accel + gyro per axis). */
+template <size_t Capacity>
+class ImuHistory : public SoaRingBuffer<kImuChannelCount, Capacity> {
+ public:
+  void Push(const ImuSample& sample) {
+    const float values[kImuChannelCount] = {sample.accel_mps2.x, sample.accel_mps2.y,
+                                            sample.accel_mps2.z, sample.gyro_rps.x,
+                                            sample.gyro_rps.y,   sample.gyro_rps.z};
+    SoaRingBuffer<kImuChannelCount, Capacity>::Push(values, sample.timestamp_us);
+  }
+};
+
+/** @brief Magnetometer history. */
+template <size_t Capacity>
+class MagHistory : public SoaRingBuffer<kMagChannelCount, Capacity> {
+ public:
+  void Push(const MagSample& sample) {
+    const float values[kMagChannelCount] = {sample.magnetic_ut.x, sample.magnetic_ut.y,
+                                            sample.magnetic_ut.z};
+    SoaRingBuffer<kMagChannelCount, Capacity>::Push(values, sample.timestamp_us);
+  }
+};
+
+/** @brief Barometer history. */
+template <size_t Capacity>
+class BaroHistory : public SoaRingBuffer<kBaroChannelCount, Capacity> {
+ public:
+  void Push(const BaroSample& sample) {
+    const float values[kBaroChannelCount] = {sample.pressure_pa, sample.temperature_c,
+                                             sample.altitude_m};
+    SoaRingBuffer<kBaroChannelCount, Capacity>::Push(values, sample.timestamp_us);
+  }
+};
+
+/** @brief Default IMU history depth used by the vehicle (256 samples). */
+using ImuHistoryBuffer = ImuHistory<256>;
+
+}  // namespace flight::sensors
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 
+#include "flight/core/batch_read.h"
 #include "flight/core/types.h"
 
 namespace flight::sensors {
@@ -48,6 +50,10 @@ class IImu {
   virtual bool Initialize() = 0;
   /** @brief Read a sample if available. */
   virtual std::optional<ImuSample> Read() = 0;
+  /** @brief Drain up to @p capacity pending samples; returns the count written. */
+  virtual size_t ReadBatch(ImuSample* out, size_t capacity) {
+    return core::DrainReads([this] { return Read(); }, out, capacity);
+  }
 };
 
 /** @brief Barometer interface. */
@@ -58,6 +64,10 @@ class IBarometer {
   virtual bool Initialize() = 0;
   /** @brief Read a sample if available. */
   virtual std::optional<BaroSample> Read() = 0;
+  /** @brief Drain up to @p capacity pending samples; returns the count written. */
+  virtual size_t ReadBatch(BaroSample* out, size_t capacity) {
+    return core::DrainReads([this] { return Read(); }, out, capacity);
+  }
 };
 
 /** @brief Magnetometer interface. */
@@ -68,6 +78,10 @@ class IMagnetometer {
   virtual bool Initialize() = 0;
   /** @brief Read a sample if available. */
   virtual std::optional<MagSample> Read() = 0;
+  /** @brief Drain up to @p capacity pending samples; returns the count written. */
+  virtual size_t ReadBatch(MagSample* out, size_t capacity) {
+    return core::DrainReads([this] { return Read(); }, out, capacity);
+  }
 };
 
 /** @brief GPS interface. */
@@ -78,6 +92,10 @@ class IGps {
   virtual bool Initialize() = 0;
   /** @brief Read a sample if available. */
   virtual std::optional<GpsSample> Read() = 0;
+  /** @brief Drain up to @p capacity pending samples; returns the count written. */
+  virtual size_t ReadBatch(GpsSample* out, size_t capacity) {
+    return core::DrainReads([this] { return Read(); }, out, capacity);
+  }
 };
 
 }  // namespace flight::sensors
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include "flight/core/spsc_ring.h"
+#include "flight/telemetry/telemetry.h"
+
+namespace flight::telemetry {
+
+/**
+ * @brief Decorator that takes serialization and sending off the control loop.
+ *
+ * Publish() copies the snapshot into a core::SpscRing and returns. By
+ * default a full ring drops the oldest snapshot, so the newest state always
+ * gets through; `Config::drop` selects the policy. A consumer calls Drain()
+ * to pass queued snapshots to the wrapped sink. On Linux, Start() runs that
+ * consumer on its own thread; io::ReactorTelemetrySink drains it from the
+ * reactor instead. On RP2350, call Drain() from the core1 loop.
+ */
+class AsyncTelemetrySink final : public ITelemetrySink {
+ public:
+  static constexpr size_t kQueueDepth = 64;
+
+  struct Config {
+    /** @brief Consumer thread sleep between drains. */
+    uint32_t poll_interval_us = 500;
+    /** @brief CPU to pin the consumer thread to, or -1 to leave it floating. */
+    int cpu = -1;
+    /** @brief Snapshot given up when the queue is full. */
+    core::DropPolicy drop = core::DropPolicy::kDropOldest;
+  };
+
+  explicit AsyncTelemetrySink(ITelemetrySink& sink);
+  AsyncTelemetrySink(ITelemetrySink& sink, const Config& config);
+  ~AsyncTelemetrySink() override;
+  AsyncTelemetrySink(const AsyncTelemetrySink&) = delete;
+  AsyncTelemetrySink& operator=(const AsyncTelemetrySink&) = delete;
+
+  /** @brief Initialize the wrapped sink; call before Start(). */
+  bool Initialize() override;
+  /** @brief Producer: enqueue @p snapshot (constant time, never blocks). */
+  void Publish(const TelemetrySnapshot& snapshot) override;
+
+  /** @brief Consumer: forward every queued snapshot; returns how many. */
+  size_t Drain();
+  /** @brief Start the consumer thread (Linux only). */
+  bool Start();
+  /** @brief Stop the thread after a final Drain(). */
+  void Stop();
+  bool Running() const { return running_.load(std::memory_order_acquire); }
+
+  /** @brief Snapshots lost to a full queue, under either drop policy. */
+  uint64_t Dropped() const { return queue_.Dropped(); }
+  /** @brief Snapshots handed to the wrapped sink. */
+  uint64_t Forwarded() const { return forwarded_.load(std::memory_order_relaxed); }
+
+ private:
+  void Run();
+
+  ITelemetrySink& sink_;
+  Config config_{};
+  core::SpscRing<TelemetrySnapshot, kQueueDepth> queue_;
+  std::atomic<uint64_t> forwarded_{0};
+  std::thread thread_;
+  std::atomic<bool> running_{false};
+};
+
+}  // namespace flight::telemetry
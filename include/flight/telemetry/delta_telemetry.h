@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flight/core/protocol_magics.h"
+#include "flight/telemetry/telemetry.h"
+
+namespace flight::telemetry {
+
+using core::kTelemetryMagic;
+
+/**
+ * @brief Quantized telemetry fields, in the order of the v3 packet.
+ *
+ * Floats are stored as fixed point: quaternion x 1e4, motion, setpoints
+ * and motors x 1e3 (mm, mm/s, mrad/s), gyro peaks x 10. Counters and
+ * timestamps are exact.
+ */
+struct QuantizedTelemetry {
+  static constexpr size_t kFields = 43;
+  int64_t field[kFields] = {0};
+};
+
+QuantizedTelemetry QuantizeSnapshot(const TelemetrySnapshot& snapshot);
+TelemetrySnapshot DequantizeSnapshot(const QuantizedTelemetry& quantized);
+
+/**
+ * @brief Builds one v4 (batched, delta-encoded) telemetry datagram.
+ *
+ * Layout: `magic "MFTL", version 4, frame count, 2 reserved bytes`, then
+ * frames. The first frame carries every field as a zigzag varint. Each later
+ * frame has a 43-bit mask of changed fields (6 bytes) followed by zigzag
+ * varint deltas of those fields against the previous frame. Every datagram
+ * starts from a key frame, so a lost datagram costs only its own samples.
+ */
+class DeltaTelemetryEncoder {
+ public:
+  /** @brief Keep datagrams below a typical path MTU. */
+  static constexpr size_t kMaxDatagram = 1200;
+  static constexpr size_t kHeaderBytes = 8;
+  static constexpr uint8_t kVersion = 4;
+
+  DeltaTelemetryEncoder() { Reset(); }
+
+  /** @brief Start a new, empty datagram. */
+  void Reset();
+  /** @brief Append a sample; false (datagram unchanged) if it would not fit. */
+  bool Append(const TelemetrySnapshot& snapshot);
+
+  uint8_t FrameCount() const { return data_[5]; }
+  const uint8_t* Data() const { return data_; }
+  size_t Size() const { return size_; }
+
+ private:
+  uint8_t data_[kMaxDatagram] = {0};
+  size_t size_ = 0;
+  QuantizedTelemetry previous_{};
+};
+
+/**
+ * @brief Decode a v4 datagram into up to @p capacity snapshots.
+ * @return Number of snapshots, or 0 if the datagram is malformed.
+ */
+size_t DecodeDeltaTelemetry(const uint8_t* data, size_t length, TelemetrySnapshot* out,
+                            size_t capacity);
+
+}  // namespace flight::telemetry
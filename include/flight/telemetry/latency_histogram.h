@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+namespace flight::telemetry {
+
+/**
+ * @brief Fixed-size latency histogram with power-of-two microsecond buckets.
+ *
+ * Bucket 0 holds samples below 1 µs, bucket b holds [2^(b-1), 2^b) µs, and
+ * the last bucket everything above.
+ */
+class LatencyHistogram {
+ public:
+  static constexpr uint8_t kBuckets = 24;
+
+  void Add(uint64_t latency_us);
+  void Reset();
+
+  uint32_t Bucket(uint8_t index) const { return buckets_[index]; }
+  /** @brief Inclusive lower bound of bucket @p index in microseconds. */
+  static uint64_t BucketLowerUs(uint8_t index) { return index == 0 ? 0 : 1ull << (index - 1); }
+  uint32_t Count() const { return count_; }
+  uint64_t MaxUs() const { return max_us_; }
+  uint64_t MeanUs() const { return count_ ? sum_us_ / count_ : 0; }
+  /** @brief Upper bound of the bucket holding percentile @p p in [0, 1]. */
+  uint64_t PercentileUs(float p) const;
+
+ private:
+  uint32_t buckets_[kBuckets] = {};
+  uint32_t count_ = 0;
+  uint64_t sum_us_ = 0;
+  uint64_t max_us_ = 0;
+};
+
+}  // namespace flight::telemetry
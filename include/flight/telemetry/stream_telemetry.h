@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "flight/core/protocol_magics.h"
+#include "flight/telemetry/delta_telemetry.h"
+#include "flight/telemetry/telemetry.h"
+#include "flight/telemetry/telemetry_schema.h"
+
+namespace flight::telemetry {
+
+/** @brief Telemetry streams from telemetry_schema.h; the value is the wire id. */
+enum class TelemetryStream : uint8_t {
+#define FLIGHT_STREAM_ENUM(id, name, rate) id,
+  FLIGHT_TELEMETRY_STREAMS(FLIGHT_STREAM_ENUM)
+#undef FLIGHT_STREAM_ENUM
+  kCount
+};
+
+constexpr size_t kTelemetryStreamCount = static_cast<size_t>(TelemetryStream::kCount);
+static_assert(kTelemetryStreamCount <= 16, "stream mask is 16 bits");
+
+using core::kStreamSubscribeMagic;
+using core::kStreamTelemetryMagic;
+
+#pragma pack(push, 1)
+/** @brief Stream packet header; payloads follow in stream-id order. */
+struct StreamPacketHeader {
+  uint32_t magic = kStreamTelemetryMagic;
+  uint8_t version = 1;
+  uint8_t reserved = 0;
+  uint16_t stream_mask = 0;
+  uint64_t timestamp_us = 0;
+};
+
+/** @brief One subscription entry; rate 0 unsubscribes. */
+struct StreamRate {
+  uint8_t stream = 0;
+  uint8_t reserved = 0;
+  uint16_t rate_hz = 0;
+};
+#pragma pack(pop)
+
+/** @brief Payload bytes with every stream present. */
+constexpr size_t kMaxStreamPayloadBytes = 0
+#define FLIGHT_FIELD_SIZE(stream, name, type, member) +sizeof(type)
+    FLIGHT_TELEMETRY_FIELDS(FLIGHT_FIELD_SIZE);
+#undef FLIGHT_FIELD_SIZE
+
+/** @brief Subscription header: magic, version 1, entry count, then StreamRate entries. */
+constexpr size_t kSubscribeHeaderBytes = 6;
+
+const char* StreamName(TelemetryStream stream);
+uint16_t DefaultStreamRate(TelemetryStream stream);
+/** @brief Payload bytes of one sample of @p stream. */
+size_t StreamPayloadBytes(TelemetryStream stream);
+
+/**
+ * @brief Serialize the streams in @p mask from @p snapshot.
+ *
+ * The ESC stream is left out when the snapshot carries no ESC frame.
+ * Returns the packet length, or 0 if @p capacity is too small.
+ */
+size_t EncodeStreamPacket(const TelemetrySnapshot& snapshot, uint16_t mask, void* out, size_t capacity);
+
+/**
+ * @brief Parse a stream packet into the matching members of @p snapshot.
+ *
+ * Members of streams not in @p mask are left untouched. Fails on a bad
+ * magic, version or length.
+ */
+bool DecodeStreamPacket(const void* data, size_t length, TelemetrySnapshot& snapshot, uint16_t& mask);
+
+/** @brief Build a subscription request; returns its length or 0. */
+size_t EncodeSubscription(const StreamRate* rates, size_t count, void* out, size_t capacity);
+/** @brief Parse a subscription request; returns the entry count (0 if invalid). */
+size_t DecodeSubscription(const void* data, size_t length, StreamRate* out, size_t capacity);
+
+/**
+ * @brief UDP telemetry where each schema stream has its own rate.
+ *
+ * Every Publish() sends one packet holding the streams that are due, so a
+ * 1 kHz motor stream and a 1 Hz status stream share the socket without the
+ * slow data being repeated. Rates start at the schema defaults. A ground
+ * station changes them by sending a subscription request from its
+ * telemetry port to `local_port`. Publish() checks for requests with a
+ * non-blocking recv() every `subscription_poll_us`, not on every tick.
+ * Both that read and the sends are syscalls on the publishing thread, so
+ * on the vehicle put the sender behind io::ReactorTelemetrySink (or
+ * AsyncTelemetrySink) rather than calling it from the control loop.
+ */
+class StreamTelemetrySender final : public ITelemetrySink {
+ public:
+  struct Config {
+    std::string address = "127.0.0.1";
+    uint16_t port = 14560;
+    /** @brief Port bound for subscription requests (0 picks any). */
+    uint16_t local_port = 14561;
+    uint32_t subscription_poll_us = 100000;
+  };
+
+  static constexpr size_t kMaxPacket = sizeof(StreamPacketHeader) + kMaxStreamPayloadBytes;
+
+  explicit StreamTelemetrySender(const Config& config);
+  ~StreamTelemetrySender() override;
+  StreamTelemetrySender(const StreamTelemetrySender&) = delete;
+  StreamTelemetrySender& operator=(const StreamTelemetrySender&) = delete;
+
+  bool Initialize() override;
+  void Publish(const TelemetrySnapshot& snapshot) override;
+
+  /** @brief Set a stream rate locally (0 disables it). */
+  void SetRate(TelemetryStream stream, uint16_t rate_hz);
+  uint16_t Rate(TelemetryStream stream) const;
+  /** @brief Apply a subscription request; false if it does not parse. */
+  bool ApplySubscription(const void* data, size_t length);
+
+  uint64_t PacketsSent() const { return packets_sent_; }
+  uint64_t BytesSent() const { return bytes_sent_; }
+
+ private:
+  void PollSubscriptions(uint64_t now_us);
+
+  Config config_{};
+  int socket_fd_ = -1;
+  uint16_t rate_hz_[kTelemetryStreamCount] = {0};
+  uint64_t next_due_us_[kTelemetryStreamCount] = {0};
+  uint64_t next_poll_us_ = 0;
+  uint64_t packets_sent_ = 0;
+  uint64_t bytes_sent_ = 0;
+};
+
+}  // namespace flight::telemetry
@@ -17,6 +17,16 @@ struct TelemetrySnapshot {
   controllers::ControlOutput output{};
   std::optional<actuators::DshotTelemetryFrame> esc_telemetry;
   bool armed = false;
+  /** @brief Dominant gyro vibration frequency per axis (0 when none). */
+  core::Vector3f gyro_peak_hz{};
+  /** @brief Sequence of the command frame applied this tick. */
+  uint32_t command_sequence = 0;
+  /** @brief Sender timestamp of that frame (vehicle clock, 0 if not synchronized). */
+  uint64_t command_sent_us = 0;
+  /** @brief Arrival time of that frame (vehicle clock). */
+  uint64_t command_received_us = 0;
+  /** @brief Time the actuator write for this tick returned (vehicle clock). */
+  uint64_t actuator_write_us = 0;
 };
 
 /** @brief Telemetry sink interface. */
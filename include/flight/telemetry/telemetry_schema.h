@@ -0,0 +1,69 @@
+#pragma once
+
+/**
+ * @file telemetry_schema.h
+ * @brief Single description of the subscription telemetry streams.
+ *
+ * The firmware expands these lists into its encoder and decoder
+ * (stream_telemetry.h). `scripts/telemetry_receiver.py` parses this file
+ * at run time. Keep each entry on one line, and only append: a stream's id
+ * is its position in the list, and the wire order of its fields is the
+ * order they appear here.
+ *
+ * STREAM(id, "name", default_rate_hz)
+ * FIELD(stream id, "name", wire type, TelemetrySnapshot member)
+ */
+
+#define FLIGHT_TELEMETRY_STREAMS(STREAM) \
+  STREAM(kAttitude, "attitude", 100)     \
+  STREAM(kRates, "rates", 100)           \
+  STREAM(kPosition, "position", 20)      \
+  STREAM(kSetpoint, "setpoint", 20)      \
+  STREAM(kMotors, "motors", 50)          \
+  STREAM(kEsc, "esc", 0)                 \
+  STREAM(kVibration, "vibration", 2)     \
+  STREAM(kLatency, "latency", 0)         \
+  STREAM(kStatus, "status", 1)
+
+#define FLIGHT_TELEMETRY_FIELDS(FIELD)                                  \
+  FIELD(kAttitude, "qw", float, pose.orientation.w)                     \
+  FIELD(kAttitude, "qx", float, pose.orientation.x)                     \
+  FIELD(kAttitude, "qy", float, pose.orientation.y)                     \
+  FIELD(kAttitude, "qz", float, pose.orientation.z)                     \
+  FIELD(kRates, "p", float, pose.angular_velocity_rps.x)                \
+  FIELD(kRates, "q", float, pose.angular_velocity_rps.y)                \
+  FIELD(kRates, "r", float, pose.angular_velocity_rps.z)                \
+  FIELD(kRates, "p_sp", float, setpoint.body_rates_rps.x)               \
+  FIELD(kRates, "q_sp", float, setpoint.body_rates_rps.y)               \
+  FIELD(kRates, "r_sp", float, setpoint.body_rates_rps.z)               \
+  FIELD(kPosition, "x", float, pose.position_m.x)                       \
+  FIELD(kPosition, "y", float, pose.position_m.y)                       \
+  FIELD(kPosition, "z", float, pose.position_m.z)                       \
+  FIELD(kPosition, "vx", float, pose.velocity_mps.x)                    \
+  FIELD(kPosition, "vy", float, pose.velocity_mps.y)                    \
+  FIELD(kPosition, "vz", float, pose.velocity_mps.z)                    \
+  FIELD(kSetpoint, "vx_sp", float, setpoint.velocity_mps.x)             \
+  FIELD(kSetpoint, "vy_sp", float, setpoint.velocity_mps.y)             \
+  FIELD(kSetpoint, "vz_sp", float, setpoint.velocity_mps.z)             \
+  FIELD(kSetpoint, "thrust", float, setpoint.thrust)                    \
+  FIELD(kMotors, "motor_count", uint8_t, output.motor_count)            \
+  FIELD(kMotors, "m0", float, output.motors[0])                         \
+  FIELD(kMotors, "m1", float, output.motors[1])                         \
+  FIELD(kMotors, "m2", float, output.motors[2])                         \
+  FIELD(kMotors, "m3", float, output.motors[3])                         \
+  FIELD(kMotors, "m4", float, output.motors[4])                         \
+  FIELD(kMotors, "m5", float, output.motors[5])                         \
+  FIELD(kMotors, "m6", float, output.motors[6])                         \
+  FIELD(kMotors, "m7", float, output.motors[7])                         \
+  FIELD(kEsc, "esc_channel", uint8_t, esc_telemetry->channel)           \
+  FIELD(kEsc, "esc_data", uint16_t, esc_telemetry->data)                \
+  FIELD(kEsc, "esc_raw", uint16_t, esc_telemetry->raw)                  \
+  FIELD(kEsc, "esc_crc_ok", uint8_t, esc_telemetry->crc_ok)             \
+  FIELD(kVibration, "peak_x_hz", float, gyro_peak_hz.x)                 \
+  FIELD(kVibration, "peak_y_hz", float, gyro_peak_hz.y)                 \
+  FIELD(kVibration, "peak_z_hz", float, gyro_peak_hz.z)                 \
+  FIELD(kLatency, "command_sequence", uint32_t, command_sequence)       \
+  FIELD(kLatency, "command_sent_us", uint64_t, command_sent_us)         \
+  FIELD(kLatency, "command_received_us", uint64_t, command_received_us) \
+  FIELD(kLatency, "actuator_write_us", uint64_t, actuator_write_us)     \
+  FIELD(kStatus, "armed", uint8_t, armed)
@@ -3,27 +3,68 @@
 #include <cstdint>
 #include <string>
 
+#include "flight/telemetry/delta_telemetry.h"
 #include "flight/telemetry/telemetry.h"
 
 namespace flight::telemetry {
 
+/**
+ * @brief UDP telemetry over a connected socket.
+ *
+ * With `batch_frames == 0` every published snapshot is one v3 packet. With
+ * `batch_frames > 0`, snapshots are delta-encoded into v4 datagrams of that
+ * many frames (see DeltaTelemetryEncoder), and every `flush_datagrams`
+ * completed datagrams are sent with one sendmmsg(). Queued snapshots are
+ * also flushed once the oldest is `max_age_us` old (by snapshot time, so
+ * the check runs on the next Publish()), and on destruction.
+ */
 class UdpTelemetrySender final : public ITelemetrySink {
  public:
   struct Config {
     std::string address = "127.0.0.1";
     uint16_t port = 14560;
+    /** @brief Publish rate limit; 0 sends every snapshot. */
     uint16_t rate_hz = 100;
+    /** @brief Snapshots per v4 datagram; 0 selects one v3 packet per snapshot. */
+    uint8_t batch_frames = 0;
+    /** @brief Completed datagrams per sendmmsg() (at most kMaxPending). */
+    uint8_t flush_datagrams = 1;
+    /** @brief Flush once the oldest queued snapshot is this old; 0 waits for full batches. */
+    uint32_t max_age_us = 50000;
   };
 
+  static constexpr size_t kMaxPending = 8;
+
   explicit UdpTelemetrySender(const Config& config);
+  /** @brief Sends whatever is still queued and closes the socket. */
+  ~UdpTelemetrySender() override;
+  UdpTelemetrySender(const UdpTelemetrySender&) = delete;
+  UdpTelemetrySender& operator=(const UdpTelemetrySender&) = delete;
 
   bool Initialize() override;
   void Publish(const TelemetrySnapshot& snapshot) override;
+  /** @brief Send any queued datagrams, including a partly filled one. */
+  void Flush();
+
+  /** @brief send()/sendmmsg() calls made. */
+  uint64_t Syscalls() const { return syscalls_; }
+  /** @brief UDP payload bytes handed to the kernel. */
+  uint64_t BytesSent() const { return bytes_sent_; }
 
  private:
+  void CloseDatagram();
+  void SendPending();
+
   Config config_{};
   int socket_fd_ = -1;
   uint64_t last_send_us_ = 0;
+  uint64_t oldest_queued_us_ = 0;
+  DeltaTelemetryEncoder encoder_;
+  uint8_t pending_[kMaxPending][DeltaTelemetryEncoder::kMaxDatagram] = {};
+  size_t pending_size_[kMaxPending] = {0};
+  size_t pending_count_ = 0;
+  uint64_t syscalls_ = 0;
+  uint64_t bytes_sent_ = 0;
 };
 
 }  // namespace flight::telemetry
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "flight/vehicle/rov_arming.h"
 #include "flight/vehicle/vehicle.h"
 
 namespace flight::vehicle {
@@ -23,15 +24,20 @@ class Rov4Vehicle final : public IVehicle {
   /** @brief Run control update. */
  void Update(float dt_s) override;
 
- private:
-  enum class ArmState : uint8_t { kDisarmed = 0, kArmed = 1 };
+  /** @brief Controller reported a motor count other than kRovThrusterCount; stays disarmed. */
+  bool MotorCountFault() const { return arming_.Faulted(); }
+
+  /** @brief Sender-to-arrival latency of applied commands (needs time-synced v2 frames). */
+  const telemetry::LatencyHistogram& UplinkLatency() const { return latency_.Uplink(); }
+  /** @brief Arrival-to-actuator-write latency of applied commands. */
+  const telemetry::LatencyHistogram& PipelineLatency() const { return latency_.Pipeline(); }
 
-  void UpdateArming(const receiver::CommandFrame& frame, float dt_s);
+ private:
+  void ConditionImu(sensors::ImuSample& sample);
 
   VehicleDependencies deps_;
-  ArmState arm_state_ = ArmState::kDisarmed;
-  float arm_hold_s_ = 0.0f;
-  float disarm_hold_s_ = 0.0f;
+  RovArming arming_;
+  CommandLatency latency_;
 };
 
 }  // namespace flight::vehicle
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+
+#include "flight/controllers/controllers.h"
+#include "flight/receiver/receiver.h"
+#include "flight/telemetry/latency_histogram.h"
+
+namespace flight::vehicle {
+
+/**
+ * @brief Thrusters driven by Rov4Vehicle and StaticRovPipeline.
+ *
+ * A controller reporting a different motor_count is treated as a
+ * misconfiguration: the vehicle latches a fault, disarms and writes
+ * neutral commands until it is initialized again.
+ */
+inline constexpr uint8_t kRovThrusterCount = 4;
+
+/**
+ * @brief Stick arming for the ROV: full yaw right/left with surge and heave
+ * neutral, held for one second, arms/disarms.
+ */
+class RovArming {
+ public:
+  /** @brief Feed one command frame; returns the arm state afterwards. */
+  bool Update(const receiver::CommandFrame& frame, float dt_s);
+  /** @brief No usable frame this tick; drops any hold in progress. */
+  void NoFrame();
+  /** @brief Disarm and refuse to arm again until Reset(). */
+  void Fault();
+  /** @brief Disarmed, no hold in progress and no fault. */
+  void Reset();
+  bool Armed() const { return armed_; }
+  bool Faulted() const { return faulted_; }
+
+ private:
+  bool armed_ = false;
+  bool faulted_ = false;
+  float arm_hold_s_ = 0.0f;
+  float disarm_hold_s_ = 0.0f;
+};
+
+/** @brief Uplink and pipeline latency of applied command frames. */
+class CommandLatency {
+ public:
+  /**
+   * @brief Add a frame applied by an actuator write at @p write_us.
+   *
+   * A frame is counted once even if it stays the latest for several ticks.
+   */
+  void Record(const receiver::CommandFrame& frame, uint64_t write_us);
+
+  /** @brief Sender-to-arrival latency (needs time-synced v2 frames). */
+  const telemetry::LatencyHistogram& Uplink() const { return uplink_; }
+  /** @brief Arrival-to-actuator-write latency. */
+  const telemetry::LatencyHistogram& Pipeline() const { return pipeline_; }
+
+ private:
+  telemetry::LatencyHistogram uplink_;
+  telemetry::LatencyHistogram pipeline_;
+  bool have_sequence_ = false;
+  uint32_t last_sequence_ = 0;
+};
+
+/**
+ * @brief Map ch0/ch1/ch2 (surge, yaw, heave) onto a setpoint.
+ *
+ * @return False if the frame has fewer than three channels.
+ */
+bool RovSetpointFromFrame(const receiver::CommandFrame& frame,
+                          controllers::ControlSetpoint& setpoint);
+
+}  // namespace flight::vehicle
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "flight/actuators/actuators.h"
+#include "flight/actuators/telemetry.h"
+#include "flight/controllers/controllers.h"
+#include "flight/estimators/estimators.h"
+#include "flight/receiver/receiver.h"
+#include "flight/sensors/sensors.h"
+#include "flight/telemetry/telemetry.h"
+#include "flight/vehicle/rov_arming.h"
+
+namespace flight::vehicle {
+
+/** @brief Policy placeholder for an absent IMU; compiles the IMU stage out. */
+struct NoImu {};
+/** @brief Policy placeholder for an absent telemetry sink; compiles publishing out. */
+struct NoTelemetrySink {};
+/** @brief Policy placeholder for absent ESC telemetry; compiles the read out. */
+struct NoEscTelemetry {};
+/** @brief Policy placeholder for an absent clock; compiles latency measurement out. */
+struct NoTime {};
+
+/**
+ * @brief Compile-time composed ROV tick: receiver -> arming -> estimator ->
+ * controller -> actuators -> telemetry.
+ *
+ * Same tick as Rov4Vehicle: ESC telemetry into the estimator, the command
+ * echo and actuator write time in the snapshot, latency histograms and the
+ * kRovThrusterCount fault. It leaves out RPM filtering, spectrum analysis
+ * and IMU history, so the snapshot has no gyro peaks. Every stage is a
+ * concrete type fixed at compile time. Calls are
+ * direct (and inlined where the definition is visible) instead of virtual,
+ * and the estimate, output and snapshot live in members that are updated
+ * in place. Policies only need the member functions used here, so they can
+ * be `final` implementations of the usual interfaces or plain structs.
+ * Use Rov4Vehicle when components are chosen at runtime.
+ */
+template <typename Estimator, typename Controller, typename Actuators, typename Receiver,
+          typename Imu = NoImu, typename Sink = NoTelemetrySink,
+          typename EscTelemetry = NoEscTelemetry, typename Time = NoTime>
+class StaticRovPipeline {
+ public:
+  /** @brief Upper bound of items drained from each input per tick. */
+  static constexpr size_t kMaxBatch = 8;
+  static constexpr bool kHasImu = !std::is_same_v<Imu, NoImu>;
+  static constexpr bool kHasSink = !std::is_same_v<Sink, NoTelemetrySink>;
+  static constexpr bool kHasEscTelemetry = !std::is_same_v<EscTelemetry, NoEscTelemetry>;
+  static constexpr bool kHasTime = !std::is_same_v<Time, NoTime>;
+
+  /** @brief @p time is the vehicle clock receivers stamp CommandFrame::received_us on. */
+  StaticRovPipeline(Estimator& estimator, Controller& controller, Actuators& actuators,
+                    Receiver& receiver, Imu* imu = nullptr, Sink* sink = nullptr,
+                    EscTelemetry* esc_telemetry = nullptr, const Time* time = nullptr)
+      : estimator_(estimator),
+        controller_(controller),
+        actuators_(actuators),
+        receiver_(receiver),
+        imu_(imu),
+        sink_(sink),
+        esc_telemetry_(esc_telemetry),
+        time_(time) {}
+
+  /** @brief Initialize every stage. */
+  bool Initialize() {
+    arming_.Reset();
+    bool ok = estimator_.Initialize();
+    ok = controller_.Initialize() && ok;
+    ok = actuators_.Initialize() && ok;
+    ok = receiver_.Initialize() && ok;
+    if constexpr (kHasImu) {
+      ok = (!imu_ || imu_->Initialize()) && ok;
+    }
+    return ok;
+  }
+
+  /** @brief Run one control tick. */
+  void Update(float dt_s) {
+    estimators::EstimatorInput input;
+    if constexpr (kHasEscTelemetry) {
+      const size_t count = esc_telemetry_ ? esc_telemetry_->ReadBatch(esc_frames_, kMaxBatch) : 0;
+      if (count > 0) {
+        input.esc_telemetry = esc_frames_[count - 1];
+      }
+    }
+    size_t imu_count = 0;
+    if constexpr (kHasImu) {
+      imu_count = imu_ ? imu_->ReadBatch(imu_samples_, kMaxBatch) : 0;
+    }
+    if (imu_count == 0) {
+      estimate_ = estimator_.Update(input);
+    }
+    for (size_t i = 0; i < imu_count; ++i) {
+      input.imu = imu_samples_[i];
+      estimate_ = estimator_.Update(input);
+    }
+
+    setpoint_ = {};
+    const size_t count = receiver_.ReadBatch(frames_, kMaxBatch);
+    const receiver::CommandFrame* frame = nullptr;
+    for (size_t i = count; i > 0; --i) {
+      if (frames_[i - 1].failsafe) {
+        break;
+      }
+      if (RovSetpointFromFrame(frames_[i - 1], setpoint_)) {
+        frame = &frames_[i - 1];
+        arming_.Update(*frame, dt_s);
+        break;
+      }
+    }
+    if (!frame) {
+      arming_.NoFrame();
+    }
+
+    if (arming_.Armed()) {
+      output_ = controller_.Update(estimate_.pose, setpoint_, dt_s);
+      if (output_.motor_count != kRovThrusterCount) {
+        arming_.Fault();
+      }
+    }
+    if (!arming_.Armed()) {
+      output_ = {};
+      output_.motor_count = kRovThrusterCount;
+    }
+
+    actuators::ActuatorCommand commands[kRovThrusterCount];
+    for (uint8_t i = 0; i < kRovThrusterCount; ++i) {
+      commands[i].value = output_.motors[i];
+    }
+    actuators_.Write(commands, kRovThrusterCount);
+    uint64_t write_us = 0;
+    if constexpr (kHasTime) {
+      write_us = time_ ? time_->NowUs() : 0;
+      if (frame && time_) {
+        latency_.Record(*frame, write_us);
+      }
+    }
+
+    if constexpr (kHasSink) {
+      if (sink_) {
+        snapshot_.timestamp_us = estimate_.timestamp_us;
+        snapshot_.pose = estimate_.pose;
+        snapshot_.setpoint = setpoint_;
+        snapshot_.output = output_;
+        snapshot_.esc_telemetry = input.esc_telemetry;
+        snapshot_.armed = arming_.Armed();
+        snapshot_.command_sequence = frame ? frame->sequence : 0;
+        snapshot_.command_sent_us = frame ? frame->sent_us : 0;
+        snapshot_.command_received_us = frame ? frame->received_us : 0;
+        snapshot_.actuator_write_us = write_us;
+        sink_->Publish(snapshot_);
+      }
+    }
+  }
+
+  bool Armed() const { return arming_.Armed(); }
+  /** @brief Controller reported a motor count other than kRovThrusterCount; stays disarmed. */
+  bool MotorCountFault() const { return arming_.Faulted(); }
+  const controllers::ControlOutput& Output() const { return output_; }
+  const estimators::EstimatorOutput& Estimate() const { return estimate_; }
+  /** @brief Sender-to-arrival latency of applied commands (needs time-synced v2 frames). */
+  const telemetry::LatencyHistogram& UplinkLatency() const { return latency_.Uplink(); }
+  /** @brief Arrival-to-actuator-write latency of applied commands. */
+  const telemetry::LatencyHistogram& PipelineLatency() const { return latency_.Pipeline(); }
+
+ private:
+  Estimator& estimator_;
+  Controller& controller_;
+  Actuators& actuators_;
+  Receiver& receiver_;
+  Imu* imu_;
+  Sink* sink_;
+  EscTelemetry* esc_telemetry_;
+  const Time* time_;
+
+  RovArming arming_;
+  CommandLatency latency_;
+  estimators::EstimatorOutput estimate_{};
+  controllers::ControlSetpoint setpoint_{};
+  controllers::ControlOutput output_{};
+  telemetry::TelemetrySnapshot snapshot_{};
+  receiver::CommandFrame frames_[kMaxBatch];
+  sensors::ImuSample imu_samples_[kHasImu ? kMaxBatch : 1];
+  actuators::DshotTelemetryFrame esc_frames_[kHasEscTelemetry ? kMaxBatch : 1];
+};
+
+}  // namespace flight::vehicle
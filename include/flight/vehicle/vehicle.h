@@ -6,8 +6,13 @@
 #include "flight/actuators/telemetry.h"
 #include "flight/controllers/controllers.h"
 #include "flight/estimators/estimators.h"
+#include "flight/filters/rpm_notch_filter.h"
+#include "flight/filters/spectrum_analyzer.h"
+#include "flight/hal/hal.h"
 #include "flight/receiver/receiver.h"
 #include "flight/scheduler/scheduler.h"
+#include "flight/sensors/sensor_history.h"
+#include "flight/sensors/sensors.h"
 #include "flight/telemetry/telemetry.h"
 
 namespace flight::vehicle {
@@ -39,6 +44,16 @@ struct VehicleDependencies {
   actuators::ITelemetryReceiver* telemetry = nullptr;
   telemetry::ITelemetrySink* telemetry_sink = nullptr;
   receiver::ICommandReceiver* receiver = nullptr;
+  sensors::IImu* imu = nullptr;
+  filters::RpmNotchFilter* gyro_filter = nullptr;
+  filters::SpectrumAnalyzer* gyro_spectrum = nullptr;
+  sensors::ImuHistoryBuffer* imu_history = nullptr;
+  /**
+   * @brief Vehicle clock for command latency; latency is not measured when null.
+   *
+   * Receivers must stamp CommandFrame::received_us on this same clock.
+   */
+  const hal::ITime* time = nullptr;
 };
 
 /** @brief Factory for vehicle instances. */
@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+"""Offline LQR gain table generator for makeflight.
+
+Builds a discrete ROV station-keeping model (surge, sway, heave and yaw,
+each a mass-damper driven by normalized thrust), linearizes the quadratic
+drag at a set of surge-speed regions, solves the discrete algebraic Riccati
+equation per region and writes the gains as constexpr tables:
+
+    python3 scripts/generate_lqr_tables.py > include/flight/controllers/lqr_tables.h
+
+Pure Python, no numpy required.
+"""
+
+import argparse
+import math
+
+# Axis order matches LqrController: states [x, y, z, yaw, u, v, w, r],
+# inputs [surge, sway, heave, yaw] in normalized wrench units.
+AXES = ("surge", "sway", "heave", "yaw")
+
+# Rigid-body plus added mass (kg, kg m^2).
+MASS = (13.5, 16.0, 18.0, 0.55)
+# Linear (N s/m) and quadratic (N s^2/m^2) damping per axis.
+LINEAR_DRAG = (4.0, 6.0, 8.0, 0.5)
+QUADRATIC_DRAG = (18.0, 21.0, 36.0, 1.5)
+# Force or torque at a normalized command of 1 (two 40 N thrusters).
+MAX_EFFORT = (80.0, 80.0, 80.0, 8.0)
+
+# Cost weights: position/yaw error, then velocity/yaw rate, then effort.
+Q_POSITION = (4.0, 4.0, 6.0, 2.0)
+Q_VELOCITY = (1.0, 1.0, 1.0, 0.5)
+R_EFFORT = (1.0, 1.0, 1.0, 1.0)
+
+# Upper surge-speed bound (m/s) of each region; the last one is open ended.
+REGION_SPEEDS = (0.1, 0.3, 0.6, 1.0, 1.5)
+
+
+def zeros(rows, cols):
+    return [[0.0] * cols for _ in range(rows)]
+
+
+def mat_mul(a, b):
+    return [[sum(a[i][k] * b[k][j] for k in range(len(b))) for j in range(len(b[0]))]
+            for i in range(len(a))]
+
+
+def transpose(a):
+    return [list(row) for row in zip(*a)]
+
+
+def mat_add(a, b, scale=1.0):
+    return [[a[i][j] + scale * b[i][j] for j in range(len(a[0]))] for i in range(len(a))]
+
+
+def inverse(a):
+    n = len(a)
+    m = [list(row) + [1.0 if i == j else 0.0 for j in range(n)] for i, row in enumerate(a)]
+    for col in range(n):
+        pivot = max(range(col, n), key=lambda r: abs(m[r][col]))
+        m[col], m[pivot] = m[pivot], m[col]
+        p = m[col][col]
+        m[col] = [v / p for v in m[col]]
+        for r in range(n):
+            if r != col and m[r][col] != 0.0:
+                f = m[r][col]
+                m[r] = [vr - f * vc for vr, vc in zip(m[r], m[col])]
+    return [row[n:] for row in m]
+
+
+def discrete_model(surge_speed, dt):
+    """Zero-order-hold mass-damper per axis, linearized at surge_speed."""
+    states = 2 * len(AXES)
+    a = zeros(states, states)
+    b = zeros(states, len(AXES))
+    for i in range(len(AXES)):
+        speed = surge_speed if i == 0 else 0.0
+        damping = LINEAR_DRAG[i] + 2.0 * QUADRATIC_DRAG[i] * abs(speed)
+        k = damping / MASS[i]
+        gain = MAX_EFFORT[i] / MASS[i]
+        # Exact discretization of p' = v, v' = -k v + gain * u.
+        e = math.exp(-k * dt)
+        a[i][i] = 1.0
+        a[i][len(AXES) + i] = (1.0 - e) / k
+        a[len(AXES) + i][len(AXES) + i] = e
+        b[i][i] = gain * (dt - (1.0 - e) / k) / k
+        b[len(AXES) + i][i] = gain * (1.0 - e) / k
+    return a, b
+
+
+def solve_dare(a, b, q, r, iterations=20000, tolerance=1e-10):
+    p = [row[:] for row in q]
+    at, bt = transpose(a), transpose(b)
+    for _ in range(iterations):
+        btp = mat_mul(bt, p)
+        gain = mat_mul(inverse(mat_add(r, mat_mul(btp, b))), mat_mul(btp, a))
+        apa = mat_mul(mat_mul(at, p), a)
+        next_p = mat_add(mat_add(q, apa), mat_mul(mat_mul(at, mat_mul(p, b)), gain), -1.0)
+        delta = max(abs(next_p[i][j] - p[i][j]) for i in range(len(p)) for j in range(len(p)))
+        p = next_p
+        if delta < tolerance:
+            break
+    btp = mat_mul(bt, p)
+    return mat_mul(inverse(mat_add(r, mat_mul(btp, b))), mat_mul(btp, a))
+
+
+def diag(values):
+    m = zeros(len(values), len(values))
+    for i, v in enumerate(values):
+        m[i][i] = v
+    return m
+
+
+def literal(value):
+    """C++ float literal with a guaranteed decimal point."""
+    text = f"{value:.7g}"
+    if "." not in text and "e" not in text:
+        text += ".0"
+    return text + "f"
+
+
+def emit(gains, dt):
+    states = 2 * len(AXES)
+    out = []
+    out.append("#pragma once")
+    out.append("")
+    out.append("// Generated by scripts/generate_lqr_tables.py; do not edit by hand.")
+    out.append("")
+    out.append("#include <cstdint>")
+    out.append("")
+    out.append("namespace flight::controllers::lqr_tables {")
+    out.append("")
+    out.append(f"constexpr uint8_t kStates = {states};")
+    out.append(f"constexpr uint8_t kInputs = {len(AXES)};")
+    out.append(f"constexpr uint8_t kRegions = {len(gains)};")
+    out.append(f"constexpr float kSampleTimeS = {literal(dt)};")
+    out.append("")
+    out.append("/** @brief Upper |surge speed| (m/s) of each region; the last is open ended. */")
+    speeds = ", ".join(literal(s) for s in REGION_SPEEDS)
+    out.append(f"constexpr float kRegionSpeed[kRegions] = {{{speeds}}};")
+    out.append("")
+    out.append("/** @brief u = -K x per region; rows surge/sway/heave/yaw, columns x y z yaw u v w r. */")
+    out.append("constexpr float kGains[kRegions][kInputs][kStates] = {")
+    for region, k in enumerate(gains):
+        out.append(f"    // |u| < {REGION_SPEEDS[region]:g} m/s")
+        out.append("    {")
+        for row in k:
+            values = ", ".join(literal(v) for v in row)
+            out.append(f"        {{{values}}},")
+        out.append("    },")
+    out.append("};")
+    out.append("")
+    out.append("}  // namespace flight::controllers::lqr_tables")
+    return "\n".join(out) + "\n"
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Generate makeflight LQR gain tables")
+    parser.add_argument("--dt", type=float, default=0.01, help="Controller sample time (s)")
+    args = parser.parse_args()
+
+    q = diag(Q_POSITION + Q_VELOCITY)
+    r = diag(R_EFFORT)
+    gains = []
+    previous = 0.0
+    for bound in REGION_SPEEDS:
+        # Linearize at the middle of each speed band.
+        a, b = discrete_model(0.5 * (previous + bound), args.dt)
+        gains.append(solve_dare(a, b, q, r))
+        previous = bound
+    print(emit(gains, args.dt), end="")
+
+
+if __name__ == "__main__":
+    main()
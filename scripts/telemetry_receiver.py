@@ -6,6 +6,8 @@ Optional live plotting uses matplotlib.
 """
 
 import argparse
+import os
+import re
 import socket
 import struct
 import time
@@ -36,7 +38,153 @@ STRUCT_FMT = (
     "B"   # armed
 )
 
+# Version 2 appends the dominant gyro vibration frequency per axis.
+STRUCT_FMT_V2 = STRUCT_FMT + "3f"
+# Version 3 appends the applied command's sequence, sent, received and
+# actuator-write times (vehicle clock, microseconds).
+STRUCT_FMT_V3 = STRUCT_FMT_V2 + "IQQQ"
+
 STRUCT_SIZE = struct.calcsize(STRUCT_FMT)
+STRUCT_SIZE_V2 = struct.calcsize(STRUCT_FMT_V2)
+STRUCT_SIZE_V3 = struct.calcsize(STRUCT_FMT_V3)
+
+
+# Version 4 batches several samples per datagram as zigzag varints: one key
+# frame, then per frame a mask of changed fields and their deltas. Fields
+# follow the v3 tuple order without magic, version and reserved; the scale
+# turns fixed point back into floats (1 = integer field).
+DELTA_SCALES = (
+    [1, 1]            # motor_count, timestamp_us
+    + [1e4] * 4       # orientation
+    + [1e3] * 15      # angular velocity, position, velocity, setpoint velocity, body rates
+    + [1e3]           # setpoint thrust
+    + [1e3] * 8       # motors
+    + [1] * 6         # esc channel/data/raw/crc_ok/present, armed
+    + [10.0] * 3      # gyro peaks
+    + [1] * 4         # command sequence, sent, received, actuator write
+)
+DELTA_MASK_BYTES = (len(DELTA_SCALES) + 7) // 8
+
+
+def _varint(data: bytes, pos: int):
+    value = 0
+    shift = 0
+    while True:
+        if pos >= len(data) or shift > 63:
+            raise ValueError("truncated varint")
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        if not byte & 0x80:
+            return (value >> 1) ^ -(value & 1), pos
+        shift += 7
+
+
+def decode_delta(data: bytes):
+    """Decode a v4 datagram into a list of v3-layout field tuples."""
+    if len(data) < 8 or struct.unpack_from("<I", data)[0] != MAGIC or data[4] != 4:
+        return []
+    frames = data[5]
+    pos = 8
+    values = [0] * len(DELTA_SCALES)
+    out = []
+    try:
+        for frame in range(frames):
+            if frame == 0:
+                for i in range(len(values)):
+                    values[i], pos = _varint(data, pos)
+            else:
+                mask = int.from_bytes(data[pos:pos + DELTA_MASK_BYTES], "little")
+                pos += DELTA_MASK_BYTES
+                for i in range(len(values)):
+                    if mask >> i & 1:
+                        delta, pos = _varint(data, pos)
+                        values[i] += delta
+            fields = [v if scale == 1 else v / scale for v, scale in zip(values, DELTA_SCALES)]
+            out.append((MAGIC, 4, fields[0], 0) + tuple(fields[1:]))
+    except ValueError:
+        return []
+    return out if pos == len(data) else []
+
+
+def decode_all(data: bytes):
+    """Decode any telemetry datagram into a list of field tuples."""
+    if len(data) > 4 and data[4] == 4:
+        return decode_delta(data)
+    fields = decode(data)
+    return [fields] if fields is not None else []
+
+
+def decode(data: bytes):
+    """Decode a v1-v3 telemetry packet; returns the field tuple or None."""
+    if len(data) < STRUCT_SIZE:
+        return None
+    version = data[4]
+    if version >= 3 and len(data) >= STRUCT_SIZE_V3:
+        fields = struct.unpack_from(STRUCT_FMT_V3, data)
+    elif version >= 2 and len(data) >= STRUCT_SIZE_V2:
+        fields = struct.unpack_from(STRUCT_FMT_V2, data) + (0, 0, 0, 0)
+    else:
+        fields = struct.unpack_from(STRUCT_FMT, data) + (0.0, 0.0, 0.0, 0, 0, 0, 0)
+    if fields[0] != MAGIC:
+        return None
+    return fields
+
+
+# Subscription streams ("MFST") are described once in the firmware schema
+# header; the decoder is built from it at start-up.
+STREAM_MAGIC = 0x4D465354
+SUBSCRIBE_MAGIC = 0x4D465351
+STREAM_HEADER_FMT = "<IBBHQ"
+SCHEMA_PATH = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)), "..", "include", "flight", "telemetry", "telemetry_schema.h"
+)
+WIRE_TYPES = {"float": "f", "uint8_t": "B", "uint16_t": "H", "uint32_t": "I", "uint64_t": "Q"}
+
+
+def load_schema(path: str = SCHEMA_PATH):
+    """Parse telemetry_schema.h into [(name, default_rate, [(field, fmt)])] in wire-id order."""
+    with open(path, encoding="utf-8") as handle:
+        text = handle.read()
+    streams = []
+    ids = {}
+    for match in re.finditer(r'^\s*STREAM\((\w+),\s*"(\w+)",\s*(\d+)\)', text, re.MULTILINE):
+        ids[match.group(1)] = len(streams)
+        streams.append((match.group(2), int(match.group(3)), []))
+    for match in re.finditer(r'^\s*FIELD\((\w+),\s*"(\w+)",\s*(\w+),', text, re.MULTILINE):
+        streams[ids[match.group(1)]][2].append((match.group(2), WIRE_TYPES[match.group(3)]))
+    return streams
+
+
+def decode_streams(data: bytes, schema):
+    """Decode a stream packet into (timestamp_us, {stream: {field: value}}), or None."""
+    header_size = struct.calcsize(STREAM_HEADER_FMT)
+    if len(data) < header_size:
+        return None
+    magic, version, _, mask, timestamp_us = struct.unpack_from(STREAM_HEADER_FMT, data)
+    if magic != STREAM_MAGIC or version != 1 or mask >> len(schema):
+        return None
+    pos = header_size
+    out = {}
+    for index, (name, _, fields) in enumerate(schema):
+        if not mask >> index & 1:
+            continue
+        fmt = "<" + "".join(f for _, f in fields)
+        if pos + struct.calcsize(fmt) > len(data):
+            return None
+        out[name] = dict(zip((n for n, _ in fields), struct.unpack_from(fmt, data, pos)))
+        pos += struct.calcsize(fmt)
+    return (timestamp_us, out) if pos == len(data) else None
+
+
+def encode_subscription(schema, spec: str) -> bytes:
+    """Build a subscription request from "name=rate,..." (rate 0 unsubscribes)."""
+    names = [name for name, _, _ in schema]
+    entries = []
+    for item in spec.split(","):
+        name, rate = item.split("=")
+        entries.append(struct.pack("<BBH", names.index(name.strip()), 0, int(rate)))
+    return struct.pack("<IBB", SUBSCRIBE_MAGIC, 1, len(entries)) + b"".join(entries)
 
 
 def main() -> None:
@@ -46,11 +194,22 @@ def main() -> None:
     parser.add_argument("--plot", action="store_true", help="Enable live plotting")
     parser.add_argument("--window", type=float, default=5.0, help="Seconds of data to display")
     parser.add_argument("--rate", type=float, default=20.0, help="Plot refresh rate (Hz)")
+    parser.add_argument("--schema", default=SCHEMA_PATH, help="telemetry_schema.h for stream packets")
+    parser.add_argument(
+        "--subscribe", help='Stream rates to request, e.g. "motors=1000,attitude=0" (stream sender only)'
+    )
+    parser.add_argument("--vehicle", default="127.0.0.1:14561", help="Stream sender subscription address")
     args = parser.parse_args()
 
     sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
     sock.bind((args.bind, args.port))
 
+    schema = load_schema(args.schema) if os.path.exists(args.schema) else []
+    if args.subscribe:
+        host, port = args.vehicle.rsplit(":", 1)
+        # Sent from the telemetry port: the vehicle only accepts its peer.
+        sock.sendto(encode_subscription(schema, args.subscribe), (host, int(port)))
+
     print(f"Listening on UDP {args.bind}:{args.port} (packet size {STRUCT_SIZE} bytes)")
 
     if args.plot:
@@ -105,110 +264,121 @@ def main() -> None:
 
         while True:
             data, _ = sock.recvfrom(4096)
-            if len(data) < STRUCT_SIZE:
-                continue
-            fields = struct.unpack_from(STRUCT_FMT, data)
-            if fields[0] != MAGIC:
-                continue
+            for fields in decode_all(data):
+                timestamp_us = fields[4]
+                angular_velocity = fields[9:12]
+                motor_count = fields[2]
+                motors = fields[25:33]
+                setpoint_body_rates = fields[21:24]
+
+                t_s = timestamp_us * 1e-6
+                times.append(t_s)
+                rates_x.append(angular_velocity[0])
+                rates_y.append(angular_velocity[1])
+                rates_z.append(angular_velocity[2])
+                set_rates_x.append(setpoint_body_rates[0])
+                set_rates_y.append(setpoint_body_rates[1])
+                set_rates_z.append(setpoint_body_rates[2])
+                err_x.append(setpoint_body_rates[0] - angular_velocity[0])
+                err_y.append(setpoint_body_rates[1] - angular_velocity[1])
+                err_z.append(setpoint_body_rates[2] - angular_velocity[2])
+
+                motors0.append(motors[0] if motor_count > 0 else 0.0)
+                motors1.append(motors[1] if motor_count > 1 else 0.0)
+                motors2.append(motors[2] if motor_count > 2 else 0.0)
+                motors3.append(motors[3] if motor_count > 3 else 0.0)
+
+                now = time.time()
+                if now >= next_refresh:
+                    if times:
+                        t0 = times[0]
+                        x = [t - t0 for t in times]
+                        line_rx.set_data(x, list(rates_x))
+                        line_ry.set_data(x, list(rates_y))
+                        line_rz.set_data(x, list(rates_z))
+                        line_sx.set_data(x, list(set_rates_x))
+                        line_sy.set_data(x, list(set_rates_y))
+                        line_sz.set_data(x, list(set_rates_z))
+                        line_ex.set_data(x, list(err_x))
+                        line_ey.set_data(x, list(err_y))
+                        line_ez.set_data(x, list(err_z))
+                        line_m0.set_data(x, list(motors0))
+                        line_m1.set_data(x, list(motors1))
+                        line_m2.set_data(x, list(motors2))
+                        line_m3.set_data(x, list(motors3))
 
-            timestamp_us = fields[4]
-            angular_velocity = fields[9:12]
-            motor_count = fields[2]
-            motors = fields[25:33]
-            setpoint_body_rates = fields[21:24]
-
-            t_s = timestamp_us * 1e-6
-            times.append(t_s)
-            rates_x.append(angular_velocity[0])
-            rates_y.append(angular_velocity[1])
-            rates_z.append(angular_velocity[2])
-            set_rates_x.append(setpoint_body_rates[0])
-            set_rates_y.append(setpoint_body_rates[1])
-            set_rates_z.append(setpoint_body_rates[2])
-            err_x.append(setpoint_body_rates[0] - angular_velocity[0])
-            err_y.append(setpoint_body_rates[1] - angular_velocity[1])
-            err_z.append(setpoint_body_rates[2] - angular_velocity[2])
-
-            motors0.append(motors[0] if motor_count > 0 else 0.0)
-            motors1.append(motors[1] if motor_count > 1 else 0.0)
-            motors2.append(motors[2] if motor_count > 2 else 0.0)
-            motors3.append(motors[3] if motor_count > 3 else 0.0)
-
-            now = time.time()
-            if now >= next_refresh:
-                if times:
-                    t0 = times[0]
-                    x = [t - t0 for t in times]
-                    line_rx.set_data(x, list(rates_x))
-                    line_ry.set_data(x, list(rates_y))
-                    line_rz.set_data(x, list(rates_z))
-                    line_sx.set_data(x, list(set_rates_x))
-                    line_sy.set_data(x, list(set_rates_y))
-                    line_sz.set_data(x, list(set_rates_z))
-                    line_ex.set_data(x, list(err_x))
-                    line_ey.set_data(x, list(err_y))
-                    line_ez.set_data(x, list(err_z))
-                    line_m0.set_data(x, list(motors0))
-                    line_m1.set_data(x, list(motors1))
-                    line_m2.set_data(x, list(motors2))
-                    line_m3.set_data(x, list(motors3))
-
-                    ax_rates.relim()
-                    ax_rates.autoscale_view()
-                    ax_error.relim()
-                    ax_error.autoscale_view()
-                    ax_motors.relim()
-                    ax_motors.autoscale_view()
-                    plt.pause(0.001)
-
-                next_refresh = now + (1.0 / max(1.0, args.rate))
+                        ax_rates.relim()
+                        ax_rates.autoscale_view()
+                        ax_error.relim()
+                        ax_error.autoscale_view()
+                        ax_motors.relim()
+                        ax_motors.autoscale_view()
+                        plt.pause(0.001)
+
+                    next_refresh = now + (1.0 / max(1.0, args.rate))
     else:
         while True:
             data, _ = sock.recvfrom(4096)
-            if len(data) < STRUCT_SIZE:
+            streams = decode_streams(data, schema) if schema else None
+            if streams is not None:
+                timestamp_us, values = streams
+                print(
+                    "ts=%d %s"
+                    % (
+                        timestamp_us,
+                        " ".join(
+                            "%s=%s" % (name, {k: round(v, 3) for k, v in fields.items()})
+                            for name, fields in values.items()
+                        ),
+                    )
+                )
                 continue
-            fields = struct.unpack_from(STRUCT_FMT, data)
+            for fields in decode_all(data):
+                motor_count = fields[2]
+                timestamp_us = fields[4]
 
-            magic = fields[0]
-            if magic != MAGIC:
-                continue
+                orientation = fields[5:9]
+                angular_velocity = fields[9:12]
+                velocity = fields[15:18]
+                setpoint_velocity = fields[18:21]
+                setpoint_body_rates = fields[21:24]
+                setpoint_thrust = fields[24]
+                motors = fields[25:33]
+                esc_channel = fields[33]
+                esc_data = fields[34]
+                esc_raw = fields[35]
+                esc_crc_ok = fields[36]
+                esc_present = fields[37]
+                armed = fields[38]
+                gyro_peak_hz = fields[39:42]
+                command_sequence, command_sent_us, command_received_us, actuator_write_us = fields[42:46]
+                uplink_us = command_received_us - command_sent_us if command_sent_us else -1
+                pipeline_us = actuator_write_us - command_received_us if command_received_us else -1
 
-            motor_count = fields[2]
-            timestamp_us = fields[4]
-
-            orientation = fields[5:9]
-            angular_velocity = fields[9:12]
-            velocity = fields[15:18]
-            setpoint_velocity = fields[18:21]
-            setpoint_body_rates = fields[21:24]
-            setpoint_thrust = fields[24]
-            motors = fields[25:33]
-            esc_channel = fields[33]
-            esc_data = fields[34]
-            esc_raw = fields[35]
-            esc_crc_ok = fields[36]
-            esc_present = fields[37]
-            armed = fields[38]
-
-            print(
-                "ts=%d armed=%d q=%s rates=%s vel=%s set_vel=%s set_rates=%s thrust=%.3f motors=%s esc=%s"
-                % (
-                    timestamp_us,
-                    armed,
-                    tuple(round(v, 3) for v in orientation),
-                    tuple(round(v, 3) for v in angular_velocity),
-                    tuple(round(v, 3) for v in velocity),
-                    tuple(round(v, 3) for v in setpoint_velocity),
-                    tuple(round(v, 3) for v in setpoint_body_rates),
-                    setpoint_thrust,
-                    tuple(round(v, 3) for v in motors[:motor_count]),
-                    (
-                        f"ch={esc_channel} data={esc_data} raw={esc_raw} crc={esc_crc_ok}"
-                        if esc_present
-                        else "none"
-                    ),
+                print(
+                    "ts=%d armed=%d q=%s rates=%s vel=%s set_vel=%s set_rates=%s thrust=%.3f motors=%s esc=%s peaks=%s "
+                    "cmd=%d uplink_us=%d pipeline_us=%d"
+                    % (
+                        timestamp_us,
+                        armed,
+                        tuple(round(v, 3) for v in orientation),
+                        tuple(round(v, 3) for v in angular_velocity),
+                        tuple(round(v, 3) for v in velocity),
+                        tuple(round(v, 3) for v in setpoint_velocity),
+                        tuple(round(v, 3) for v in setpoint_body_rates),
+                        setpoint_thrust,
+                        tuple(round(v, 3) for v in motors[:motor_count]),
+                        (
+                            f"ch={esc_channel} data={esc_data} raw={esc_raw} crc={esc_crc_ok}"
+                            if esc_present
+                            else "none"
+                        ),
+                        tuple(round(v, 1) for v in gyro_peak_hz),
+                        command_sequence,
+                        uplink_us,
+                        pipeline_us,
+                    )
                 )
-            )
 
 
 if __name__ == "__main__":
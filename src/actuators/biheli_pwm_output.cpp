@@ -7,33 +7,35 @@
 
 namespace flight::actuators {
 
-namespace {
-
-/** @brief Clamp helper. */
-float Clamp(float value, float min_value, float max_value) {
-  if (value < min_value) {
-    return min_value;
+/** @brief Construct with PWM configuration. */
+BiheliPwmOutput::BiheliPwmOutput(const Config& config, hal::IPwm* pwm)
+    : config_(config),
+      pwm_(pwm),
+      range_{config.min_pulse_us, config.max_pulse_us, config.neutral_pulse_us},
+      driver_(pwm) {}
+
+/** @brief Start neutral pulses on the hardware slices, if any. */
+bool BiheliPwmOutput::Initialize() {
+  if (!pwm_) {
+    return true;
   }
-  if (value > max_value) {
-    return max_value;
+  if (!driver_.Initialize(config_.pins, config_.channel_count, config_.update_rate_hz,
+                          config_.max_pulse_us, config_.neutral_pulse_us)) {
+    return false;
   }
-  return value;
+  for (uint8_t i = 0; i < config_.channel_count; ++i) {
+    last_pulse_us_[i] = config_.neutral_pulse_us;
+  }
+  return true;
 }
 
-}  // namespace
-
-/** @brief Construct with PWM configuration. */
-BiheliPwmOutput::BiheliPwmOutput(const Config& config) : config_(config) {}
-
 /** @brief Map normalized commands to PWM pulse widths. */
 bool BiheliPwmOutput::Write(const ActuatorCommand* commands, uint8_t count) {
-  last_count_ = count > 8 ? 8 : count;
+  last_count_ = count > kMaxChannels ? kMaxChannels : count;
   for (uint8_t i = 0; i < last_count_; ++i) {
-    const float value = Clamp(commands[i].value, -1.0f, 1.0f);
-    const float range = config_.max_pulse_us - config_.neutral_pulse_us;
-    const float pulse = config_.neutral_pulse_us + (value * range);
-    last_pulse_us_[i] = Clamp(pulse, config_.min_pulse_us, config_.max_pulse_us);
+    last_pulse_us_[i] = MapPulseUs(commands[i].value, range_);
   }
+  driver_.Write(last_pulse_us_, last_count_);
   return true;
 }
 
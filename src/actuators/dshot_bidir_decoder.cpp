@@ -0,0 +1,143 @@
+/**
+ * @file dshot_bidir_decoder.cpp
+ * @brief Run-length and GCR table decoder for bidirectional DShot.
+ */
+
+#include "flight/actuators/dshot_bidir_decoder.h"
+
+namespace flight::actuators {
+
+namespace {
+
+/** @brief Index of the first sample at or after @p from that differs from @p level. */
+uint16_t NextEdge(const uint32_t* words, uint16_t from, uint16_t sample_count, bool level) {
+  uint16_t index = from;
+  while (index < sample_count) {
+    uint32_t word = words[index >> 5] >> (index & 31);
+    if (level) {
+      word = ~word;
+    }
+    const uint16_t remaining_in_word = static_cast<uint16_t>(32 - (index & 31));
+    if (remaining_in_word < 32) {
+      word &= (1u << remaining_in_word) - 1u;
+    }
+    if (word != 0) {
+      const uint16_t edge = static_cast<uint16_t>(index + __builtin_ctz(word));
+      return edge < sample_count ? edge : sample_count;
+    }
+    index = static_cast<uint16_t>(index + remaining_in_word);
+  }
+  return sample_count;
+}
+
+}  // namespace
+
+DshotBidirDecoder::DshotBidirDecoder() = default;
+
+DshotBidirDecoder::DshotBidirDecoder(const Config& config) : config_(config) {}
+
+std::optional<uint32_t> DshotBidirDecoder::ExtractLineBits(const uint32_t* words,
+                                                           uint16_t sample_count,
+                                                           uint8_t samples_per_bit) {
+  if (samples_per_bit == 0) {
+    return std::nullopt;
+  }
+  // Response bits are 4/5 of a command bit; run lengths are rounded in
+  // fifths of a sample to avoid floating point.
+  const uint32_t fifths_per_bit = 4u * samples_per_bit;
+
+  uint16_t index = NextEdge(words, 0, sample_count, true);
+  if (index >= sample_count) {
+    return std::nullopt;
+  }
+
+  uint32_t line_bits = 0;
+  uint8_t bit_count = 0;
+  bool level = false;
+  while (bit_count < kDshotResponseBits) {
+    const uint16_t edge = NextEdge(words, index, sample_count, level);
+    uint8_t bits = kDshotResponseBits - bit_count;
+    if (edge < sample_count) {
+      const uint32_t run = edge - index;
+      const uint32_t rounded = (run * 5u + fifths_per_bit / 2) / fifths_per_bit;
+      if (rounded == 0) {
+        return std::nullopt;
+      }
+      if (rounded < bits) {
+        bits = static_cast<uint8_t>(rounded);
+      }
+    } else if (!level) {
+      // The stream ended while still low: the frame was cut short.
+      return std::nullopt;
+    }
+    line_bits <<= bits;
+    if (level) {
+      line_bits |= (1u << bits) - 1u;
+    }
+    bit_count = static_cast<uint8_t>(bit_count + bits);
+    index = edge;
+    level = !level;
+  }
+  return line_bits;
+}
+
+std::optional<uint16_t> DshotBidirDecoder::DecodeLineBits(uint32_t line_bits) {
+  // NRZI: a GCR one is a level change between neighbouring line bits.
+  const uint32_t gcr = (line_bits ^ (line_bits >> 1)) & 0xFFFFFu;
+  uint16_t value = 0;
+  for (int shift = 15; shift >= 0; shift -= 5) {
+    const uint8_t nibble = dshot_detail::kGcrDecode[(gcr >> shift) & 0x1F];
+    if (nibble == 0xFF) {
+      return std::nullopt;
+    }
+    value = static_cast<uint16_t>((value << 4) | nibble);
+  }
+  return value;
+}
+
+bool DshotBidirDecoder::ChecksumOk(uint16_t value) {
+  const uint16_t folded = static_cast<uint16_t>(value ^ (value >> 4) ^ (value >> 8) ^ (value >> 12));
+  return (folded & 0xF) == 0xF;
+}
+
+bool DshotBidirDecoder::Decode(uint8_t channel,
+                               const uint32_t* words,
+                               uint16_t sample_count,
+                               DshotTelemetryFrame& frame) {
+  return Accept(channel, ExtractLineBits(words, sample_count, config_.samples_per_bit), frame);
+}
+
+bool DshotBidirDecoder::Accept(uint8_t channel,
+                               const std::optional<uint32_t>& line_bits,
+                               DshotTelemetryFrame& frame) {
+  if (channel >= kMaxChannels) {
+    return false;
+  }
+  ChannelState& state = states_[channel];
+  frame = {};
+  frame.channel = channel;
+
+  const auto value = line_bits ? DecodeLineBits(*line_bits) : std::nullopt;
+  if (!value) {
+    ++state.errors;
+    return false;
+  }
+
+  frame.raw = *value;
+  frame.data = static_cast<uint16_t>(*value >> 4);
+  frame.crc_ok = ChecksumOk(*value);
+  if (!frame.crc_ok) {
+    ++state.errors;
+    return true;
+  }
+
+  const uint32_t pole_pairs = config_.motor_pole_count >= 2 ? config_.motor_pole_count / 2u : 1u;
+  state.period_code = frame.data;
+  state.erpm = ErpmFromPeriodCode(frame.data);
+  state.rpm = state.erpm / pole_pairs;
+  state.valid = true;
+  ++state.frames;
+  return true;
+}
+
+}  // namespace flight::actuators
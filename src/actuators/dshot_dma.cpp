@@ -0,0 +1,93 @@
+/**
+ * @file dshot_dma.cpp
+ * @brief DShot command queue and DMA frame layout (host-testable).
+ */
+
+#include "flight/actuators/dshot_dma.h"
+
+namespace flight::actuators {
+
+uint8_t DshotCommandQueue::RepeatCount(DshotCommand command) {
+  switch (command) {
+    case DshotCommand::kSpinDirection1:
+    case DshotCommand::kSpinDirection2:
+    case DshotCommand::k3dModeOff:
+    case DshotCommand::k3dModeOn:
+    case DshotCommand::kSaveSettings:
+    case DshotCommand::kExtendedTelemetryEnable:
+    case DshotCommand::kExtendedTelemetryDisable:
+    case DshotCommand::kSpinDirectionNormal:
+    case DshotCommand::kSpinDirectionReversed:
+      return 6;
+    default:
+      return 1;
+  }
+}
+
+bool DshotCommandQueue::Push(uint8_t channel_mask, DshotCommand command) {
+  if (size_ >= kCapacity || channel_mask == 0) {
+    return false;
+  }
+  Entry& entry = entries_[(head_ + size_) % kCapacity];
+  entry.channel_mask = channel_mask;
+  entry.command = command;
+  entry.remaining = RepeatCount(command);
+  ++size_;
+  return true;
+}
+
+void DshotCommandQueue::Apply(uint16_t* packets, uint8_t count, bool bidirectional) {
+  if (size_ == 0) {
+    return;
+  }
+  Entry& entry = entries_[head_];
+  // Commands are only accepted with the telemetry bit set.
+  const uint16_t packet =
+      DshotEncoder::PackFrame(static_cast<uint16_t>(entry.command), true, bidirectional);
+  for (uint8_t i = 0; i < count && i < 8; ++i) {
+    if (entry.channel_mask & (1u << i)) {
+      packets[i] = packet;
+    }
+  }
+  if (--entry.remaining == 0) {
+    head_ = static_cast<uint8_t>((head_ + 1) % kCapacity);
+    --size_;
+  }
+}
+
+bool DshotDmaFrame::BuildSerial(const uint16_t* packets,
+                                uint8_t count,
+                                const uint8_t* state_machines) {
+  if (count == 0 || count > kMaxSerialChannels) {
+    transfer_count = 0;
+    return false;
+  }
+  for (uint8_t i = 0; i < count; ++i) {
+    uint32_t channel_words[kDshotSerialWords];
+    DshotEncoder::EncodeSerial(packets[i], channel_words);
+    const uint8_t offset = static_cast<uint8_t>(i * kDshotSerialWords);
+    for (uint8_t w = 0; w < kDshotSerialWords; ++w) {
+      words[offset + w] = channel_words[w];
+    }
+    transfers[i] = {state_machines[i], offset, kDshotSerialWords};
+  }
+  transfer_count = count;
+  return true;
+}
+
+bool DshotDmaFrame::BuildParallel(const uint16_t* packets, uint8_t count, uint8_t state_machine) {
+  if (count == 0 || count > kDshotParallelLanes) {
+    transfer_count = 0;
+    return false;
+  }
+  uint32_t stream[kDshotParallelWords];
+  DshotEncoder::EncodeParallel(packets, count, stream);
+  for (uint8_t w = 0; w < kDshotParallelWords; ++w) {
+    words[w] = stream[w];
+  }
+  transfers[0] = {state_machine, 0, kDshotParallelWords};
+  transfer_count = 1;
+  return true;
+}
+
+}  // namespace flight::actuators
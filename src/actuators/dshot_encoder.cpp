@@ -0,0 +1,82 @@
+/**
+ * @file dshot_encoder.cpp
+ * @brief Table-driven DShot frame and PIO waveform encoder.
+ */
+
+#include "flight/actuators/dshot_encoder.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace flight::actuators {
+
+namespace {
+
+float Clamp(float value, float min_value, float max_value) {
+  return std::max(min_value, std::min(value, max_value));
+}
+
+}  // namespace
+
+DshotEncoder::DshotEncoder() = default;
+
+DshotEncoder::DshotEncoder(const Config& config) : config_(config) {}
+
+uint16_t DshotEncoder::ValueToThrottle(float value, uint16_t min_throttle, uint16_t max_throttle) {
+  const float clamped = Clamp(value, -1.0f, 1.0f);
+  const float normalized = (clamped + 1.0f) * 0.5f;
+  const float range = static_cast<float>(max_throttle - min_throttle);
+  const float mapped = static_cast<float>(min_throttle) + (normalized * range);
+  return static_cast<uint16_t>(Clamp(mapped,
+                                     static_cast<float>(min_throttle),
+                                     static_cast<float>(max_throttle)));
+}
+
+float DshotEncoder::ClockDivider(uint32_t sys_clock_hz, DshotSpeed speed) {
+  const float tick_hz = static_cast<float>(static_cast<uint32_t>(speed)) * 1000.0f *
+                        static_cast<float>(kDshotSymbolTicks);
+  return static_cast<float>(sys_clock_hz) / tick_hz;
+}
+
+/**
+ * @brief Transpose the frames so each frame bit becomes a lane mask.
+ *
+ * Every bit then expands to three tick bytes: all lanes high, data mask,
+ * all lanes low.
+ */
+void DshotEncoder::EncodeParallel(const uint16_t* packets,
+                                  uint8_t count,
+                                  uint32_t (&words)[kDshotParallelWords]) {
+  count = count > kDshotParallelLanes ? kDshotParallelLanes : count;
+  const uint8_t active = static_cast<uint8_t>((1u << count) - 1u);
+
+  uint64_t hi_rows = 0;
+  uint64_t lo_rows = 0;
+  for (uint8_t lane = 0; lane < count; ++lane) {
+    hi_rows |= static_cast<uint64_t>(packets[lane] >> 8) << (8 * lane);
+    lo_rows |= static_cast<uint64_t>(packets[lane] & 0xFF) << (8 * lane);
+  }
+  // After transposing, byte j holds bit j of every lane.
+  const uint64_t hi_cols = dshot_detail::Transpose8x8(hi_rows);
+  const uint64_t lo_cols = dshot_detail::Transpose8x8(lo_rows);
+
+  uint8_t ticks[kDshotParallelWords * 4] = {};
+  for (uint8_t i = 0; i < kDshotFrameBits; ++i) {
+    const uint8_t bit = static_cast<uint8_t>(15 - i);
+    const uint64_t cols = bit >= 8 ? hi_cols : lo_cols;
+    const uint8_t mask = static_cast<uint8_t>(cols >> (8 * (bit & 7)));
+    ticks[i * kDshotSymbolTicks] = active;
+    ticks[i * kDshotSymbolTicks + 1] = mask;
+  }
+  std::memcpy(words, ticks, sizeof(ticks));
+}
+
+void DshotEncoder::PackAll(const ActuatorCommand* commands, uint8_t count, uint16_t* packets) const {
+  for (uint8_t i = 0; i < count; ++i) {
+    const uint16_t throttle =
+        ValueToThrottle(commands[i].value, config_.min_throttle, config_.max_throttle);
+    packets[i] = PackFrame(throttle, config_.enable_telemetry, config_.bidirectional);
+  }
+}
+
+}  // namespace flight::actuators
@@ -0,0 +1,184 @@
+/**
+ * @file dshot_sliced_decoder.cpp
+ * @brief Bit-sliced multi-channel bidirectional DShot decoding.
+ */
+
+#include "flight/actuators/dshot_sliced_decoder.h"
+
+#include <cstring>
+
+#include "flight/actuators/dshot_encoder.h"
+
+namespace flight::actuators {
+
+namespace {
+
+/** @brief Command frames carry 16 bits at the full command bit time. */
+constexpr uint16_t kCommandBits = 16;
+
+/** @brief True if @p words hold at least one low sample. */
+bool AnyLow(const uint32_t (&words)[DshotSlicedDecoder::kWindowWords]) {
+  uint32_t low = 0;
+  for (uint32_t word : words) {
+    low |= ~word;
+  }
+  return low != 0;
+}
+
+/** @brief Up to 32 samples starting at @p begin. */
+uint32_t ExtractSamples(const uint32_t* words, uint16_t word_count, uint16_t begin, uint16_t width) {
+  const uint16_t index = begin >> 5;
+  uint64_t span = words[index];
+  if (index + 1 < word_count) {
+    span |= static_cast<uint64_t>(words[index + 1]) << 32;
+  }
+  span >>= (begin & 31);
+  return static_cast<uint32_t>(span & ((1ull << width) - 1ull));
+}
+
+}  // namespace
+
+DshotSlicedDecoder::DshotSlicedDecoder() : DshotSlicedDecoder(Config{}) {}
+
+DshotSlicedDecoder::DshotSlicedDecoder(const Config& config)
+    : config_(config), decoder_({config.samples_per_bit, config.motor_pole_count}) {
+  if (config_.channel_count > kLanes) {
+    config_.channel_count = kLanes;
+  }
+  for (uint8_t i = 0; i < config_.channel_count; ++i) {
+    lane_mask_ = static_cast<uint8_t>(lane_mask_ | (1u << (config_.lanes[i] & 7)));
+  }
+  if (config_.skip_tx_frame) {
+    command_samples_ = static_cast<uint16_t>(kCommandBits * config_.samples_per_bit);
+    const uint16_t timeout = static_cast<uint16_t>(config_.response_timeout_bits * config_.samples_per_bit);
+    timeout_samples_ = timeout > 0 ? timeout : 1;
+  }
+}
+
+void DshotSlicedDecoder::Resync() {
+  gate_ = Gate::kAwaitCommand;
+  gate_remaining_ = 0;
+}
+
+uint16_t DshotSlicedDecoder::Process(const uint8_t* ring,
+                                     uint16_t ring_size,
+                                     uint16_t read_index,
+                                     uint16_t write_index,
+                                     DshotTelemetryTable& table) {
+  const uint16_t mask = static_cast<uint16_t>(ring_size - 1);
+  uint16_t available = static_cast<uint16_t>((write_index - read_index) & mask);
+  uint8_t window[kWindowSamples];
+  while (true) {
+    if (gate_ == Gate::kSkipCommand) {
+      const uint16_t skip = available < gate_remaining_ ? available : gate_remaining_;
+      read_index = static_cast<uint16_t>((read_index + skip) & mask);
+      available = static_cast<uint16_t>(available - skip);
+      gate_remaining_ = static_cast<uint16_t>(gate_remaining_ - skip);
+      if (gate_remaining_ > 0) {
+        return read_index;
+      }
+      gate_ = Gate::kAwaitResponse;
+      gate_remaining_ = timeout_samples_;
+    }
+    // A low sample on any active lane marks the start of a burst.
+    while (available > 0 && (static_cast<uint8_t>(~ring[read_index]) & lane_mask_) == 0) {
+      read_index = static_cast<uint16_t>((read_index + 1) & mask);
+      --available;
+      if (gate_ == Gate::kAwaitResponse && --gate_remaining_ == 0) {
+        // No ESC answered this command.
+        gate_ = Gate::kAwaitCommand;
+        ++missed_responses_;
+      }
+    }
+    if (available == 0) {
+      return read_index;
+    }
+    if (gate_ == Gate::kAwaitCommand && command_samples_ > 0) {
+      gate_ = Gate::kSkipCommand;
+      gate_remaining_ = command_samples_;
+      continue;
+    }
+    if (available < kWindowSamples) {
+      return read_index;
+    }
+    const uint16_t first = static_cast<uint16_t>(ring_size - read_index);
+    if (first >= kWindowSamples) {
+      std::memcpy(window, ring + read_index, kWindowSamples);
+    } else {
+      std::memcpy(window, ring + read_index, first);
+      std::memcpy(window + first, ring, kWindowSamples - first);
+    }
+    DecodeWindow(window, table);
+    read_index = static_cast<uint16_t>((read_index + kWindowSamples) & mask);
+    available = static_cast<uint16_t>(available - kWindowSamples);
+    gate_ = Gate::kAwaitCommand;
+  }
+}
+
+void DshotSlicedDecoder::DecodeWindow(const uint8_t* window, DshotTelemetryTable& table) {
+  uint32_t lane_words[kLanes][kWindowWords];
+  Deinterleave(window, lane_words);
+  for (uint8_t channel = 0; channel < config_.channel_count; ++channel) {
+    const uint8_t lane = config_.lanes[channel] & 7;
+    if (!AnyLow(lane_words[lane])) {
+      continue;  // this ESC did not answer; not a decode error
+    }
+    DshotTelemetryFrame frame{};
+    const auto line_bits = MajorityLineBits(lane_words[lane], kWindowSamples, config_.samples_per_bit);
+    if (decoder_.Accept(channel, line_bits, frame)) {
+      table.frames[channel] = frame;
+      table.updated_mask = static_cast<uint8_t>(table.updated_mask | (1u << channel));
+    }
+  }
+}
+
+void DshotSlicedDecoder::Deinterleave(const uint8_t* window,
+                                      uint32_t (&lane_words)[kLanes][kWindowWords]) {
+  std::memset(lane_words, 0, sizeof(lane_words));
+  // Each block is 8 samples x 8 lanes; after the transpose byte l holds
+  // 8 consecutive samples of lane l.
+  for (uint16_t block = 0; block < kWindowSamples / 8; ++block) {
+    uint64_t rows = 0;
+    std::memcpy(&rows, window + block * 8, sizeof(rows));
+    const uint64_t cols = dshot_detail::Transpose8x8(rows);
+    const uint16_t word = block >> 2;
+    const uint8_t shift = static_cast<uint8_t>((block & 3) * 8);
+    for (uint8_t lane = 0; lane < kLanes; ++lane) {
+      lane_words[lane][word] |= static_cast<uint32_t>((cols >> (lane * 8)) & 0xFF) << shift;
+    }
+  }
+}
+
+std::optional<uint32_t> DshotSlicedDecoder::MajorityLineBits(const uint32_t* words,
+                                                             uint16_t sample_count,
+                                                             uint8_t samples_per_bit) {
+  const uint16_t word_count = static_cast<uint16_t>((sample_count + 31) / 32);
+  uint16_t start = sample_count;
+  for (uint16_t w = 0; w < word_count; ++w) {
+    const uint32_t low = ~words[w];
+    if (low != 0) {
+      start = static_cast<uint16_t>(w * 32 + __builtin_ctz(low));
+      break;
+    }
+  }
+  if (start >= sample_count) {
+    return std::nullopt;
+  }
+
+  // Response bits are 4/5 of a command bit.
+  const uint32_t fifths_per_bit = 4u * samples_per_bit;
+  uint32_t line_bits = 0;
+  for (uint32_t bit = 0; bit < kDshotResponseBits; ++bit) {
+    const uint16_t begin = static_cast<uint16_t>(start + bit * fifths_per_bit / 5);
+    const uint16_t end = static_cast<uint16_t>(start + (bit + 1) * fifths_per_bit / 5);
+    if (end > sample_count || end <= begin || end - begin > 32) {
+      return std::nullopt;
+    }
+    const uint16_t width = static_cast<uint16_t>(end - begin);
+    const int ones = __builtin_popcount(ExtractSamples(words, word_count, begin, width));
+    line_bits = (line_bits << 1) | (2 * ones > width ? 1u : 0u);
+  }
+  return line_bits;
+}
+
+}  // namespace flight::actuators
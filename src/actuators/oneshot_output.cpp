@@ -0,0 +1,40 @@
+/**
+ * @file oneshot_output.cpp
+ * @brief OneShot125, OneShot42 and MultiShot ESC outputs.
+ */
+
+#include "flight/actuators/oneshot_output.h"
+
+namespace flight::actuators {
+
+OneShotOutput::OneShotOutput(const Config& config, hal::IPwm* pwm)
+    : config_(config), pwm_(pwm), range_(OneShotPulseRange(config.protocol)), driver_(pwm) {
+  if (config_.neutral_pulse_us > 0.0f) {
+    range_.neutral_us = config_.neutral_pulse_us;
+  }
+}
+
+bool OneShotOutput::Initialize() {
+  if (!pwm_) {
+    return true;
+  }
+  if (!driver_.Initialize(config_.pins, config_.channel_count, config_.update_rate_hz,
+                          range_.max_us, range_.neutral_us)) {
+    return false;
+  }
+  for (uint8_t i = 0; i < config_.channel_count; ++i) {
+    last_pulse_us_[i] = range_.neutral_us;
+  }
+  return true;
+}
+
+bool OneShotOutput::Write(const ActuatorCommand* commands, uint8_t count) {
+  last_count_ = count > kMaxChannels ? kMaxChannels : count;
+  for (uint8_t i = 0; i < last_count_; ++i) {
+    last_pulse_us_[i] = MapPulseUs(commands[i].value, range_);
+  }
+  driver_.Write(last_pulse_us_, last_count_);
+  return true;
+}
+
+}  // namespace flight::actuators
@@ -0,0 +1,104 @@
+/**
+ * @file pwm_slices.cpp
+ * @brief PWM slice timing and pin planning.
+ */
+
+#include "flight/actuators/pwm_slices.h"
+
+#include <cmath>
+
+namespace flight::actuators {
+
+std::optional<PwmTiming> ComputePwmTiming(uint32_t clock_hz, float update_rate_hz) {
+  if (clock_hz == 0 || update_rate_hz <= 0.0f) {
+    return std::nullopt;
+  }
+  const double period_ticks = static_cast<double>(clock_hz) / update_rate_hz;
+  const double divider = std::ceil(period_ticks / 65536.0);
+  if (divider > 255.0) {
+    return std::nullopt;
+  }
+  PwmTiming timing{};
+  timing.divider = static_cast<uint8_t>(divider < 1.0 ? 1.0 : divider);
+  const double top = std::round(period_ticks / timing.divider) - 1.0;
+  if (top < 1.0) {
+    return std::nullopt;
+  }
+  timing.top = static_cast<uint16_t>(top);
+  timing.tick_us = static_cast<float>(1e6 * timing.divider / clock_hz);
+  timing.period_us = timing.tick_us * (static_cast<float>(timing.top) + 1.0f);
+  return timing;
+}
+
+uint16_t PulseToLevel(float pulse_us, const PwmTiming& timing) {
+  if (pulse_us <= 0.0f || timing.tick_us <= 0.0f) {
+    return 0;
+  }
+  const float level = std::round(pulse_us / timing.tick_us);
+  const float max_level = static_cast<float>(timing.top) + 1.0f;
+  return static_cast<uint16_t>(level > max_level ? max_level : level);
+}
+
+bool PwmSlicePlan::Build(const uint32_t* pins, uint8_t pin_count) {
+  count = 0;
+  slice_mask = 0;
+  if (pin_count > kMaxChannels) {
+    return false;
+  }
+  uint32_t used_outputs = 0;
+  for (uint8_t i = 0; i < pin_count; ++i) {
+    slice[i] = PwmSliceForGpio(pins[i]);
+    channel[i] = PwmChannelForGpio(pins[i]);
+    const uint32_t output_bit = 1u << (slice[i] * 2 + channel[i]);
+    if (used_outputs & output_bit) {
+      return false;
+    }
+    used_outputs |= output_bit;
+    slice_mask |= 1u << slice[i];
+  }
+  count = pin_count;
+  return true;
+}
+
+bool PwmSliceDriver::Initialize(const uint32_t* pins,
+                                uint8_t count,
+                                float update_rate_hz,
+                                float max_pulse_us,
+                                float initial_pulse_us) {
+  ready_ = false;
+  if (!pwm_ || count == 0 || !plan_.Build(pins, count)) {
+    return false;
+  }
+  const auto timing = ComputePwmTiming(pwm_->ClockHz(), update_rate_hz);
+  // The longest pulse must end before the next period starts.
+  if (!timing || timing->period_us <= max_pulse_us) {
+    return false;
+  }
+  timing_ = *timing;
+
+  for (uint8_t slice = 0; slice < kPwmSliceCount; ++slice) {
+    if ((plan_.slice_mask & (1u << slice)) &&
+        !pwm_->ConfigureSlice(slice, timing_.divider, timing_.top)) {
+      return false;
+    }
+  }
+  const uint16_t initial = PulseToLevel(initial_pulse_us, timing_);
+  for (uint8_t i = 0; i < plan_.count; ++i) {
+    pwm_->SetLevel(plan_.slice[i], plan_.channel[i], initial);
+    pwm_->EnablePin(pins[i]);
+  }
+  pwm_->EnableSlices(plan_.slice_mask);
+  ready_ = true;
+  return true;
+}
+
+void PwmSliceDriver::Write(const float* pulse_us, uint8_t count) {
+  if (!ready_) {
+    return;
+  }
+  for (uint8_t i = 0; i < count && i < plan_.count; ++i) {
+    pwm_->SetLevel(plan_.slice[i], plan_.channel[i], PulseToLevel(pulse_us[i], timing_));
+  }
+}
+
+}  // namespace flight::actuators
@@ -0,0 +1,142 @@
+/**
+ * @file thrust_linearizer.cpp
+ * @brief Table-driven thrust linearization.
+ */
+
+#include "flight/actuators/thrust_linearizer.h"
+
+#include <cmath>
+
+namespace flight::actuators {
+
+namespace {
+
+/** @brief Command magnitude giving @p fraction of a direction's maximum thrust. */
+float InverseCurve(float fraction, float exponent, float deadband) {
+  return deadband + (1.0f - deadband) * std::pow(fraction, 1.0f / exponent);
+}
+
+}  // namespace
+
+ThrustLinearizer::ThrustLinearizer() : ThrustLinearizer(Config{}) {}
+
+ThrustLinearizer::ThrustLinearizer(const Config& config) : config_(config) {
+  Build();
+}
+
+ThrustLinearizer::Config ThrustLinearizer::LoadConfig(const config::IConfigStore& store,
+                                                      const Config& defaults) {
+  Config config = defaults;
+  store.Get("thrust.forward_exponent", config.forward_exponent);
+  store.Get("thrust.reverse_exponent", config.reverse_exponent);
+  store.Get("thrust.reverse_max", config.reverse_max);
+  store.Get("thrust.deadband", config.deadband);
+  store.Get("thrust.nominal_voltage", config.nominal_voltage);
+  store.Get("thrust.zero_threshold", config.zero_threshold);
+  return config;
+}
+
+void ThrustLinearizer::Build() {
+  if (config_.forward_exponent <= 0.0f) {
+    config_.forward_exponent = 1.0f;
+  }
+  if (config_.reverse_exponent <= 0.0f) {
+    config_.reverse_exponent = 1.0f;
+  }
+  if (config_.reverse_max <= 0.0f) {
+    config_.reverse_max = 1.0f;
+  }
+  // Table index i is (i / (N - 1))^2 of the direction's maximum thrust, so
+  // breakpoints crowd near zero where the inverse curve is steepest.
+  for (uint8_t i = 0; i < kTableSize; ++i) {
+    const float root = static_cast<float>(i) / (kTableSize - 1);
+    forward_table_[i] = InverseCurve(root * root, config_.forward_exponent, config_.deadband);
+    reverse_table_[i] = InverseCurve(root * root, config_.reverse_exponent, config_.deadband);
+  }
+  reverse_scale_ = 1.0f / config_.reverse_max;
+}
+
+void ThrustLinearizer::SetVoltage(float volts) {
+  if (volts <= 0.0f || config_.nominal_voltage <= 0.0f) {
+    voltage_scale_ = 1.0f;
+    return;
+  }
+  const float ratio = config_.nominal_voltage / volts;
+  voltage_scale_ = ratio * ratio;
+}
+
+void ThrustLinearizer::Apply(const float* thrust, float* command, uint8_t count) const {
+  if (count > kMaxChannels) {
+    count = kMaxChannels;
+  }
+  constexpr float kLastIndex = static_cast<float>(kTableSize - 1);
+  // Branch-free per-lane steps over a fixed-width block so the compiler can
+  // vectorize everything except the table gathers.
+  float magnitude[kMaxChannels];
+  float position[kMaxChannels];
+  for (uint8_t i = 0; i < kMaxChannels; ++i) {
+    const float request = i < count ? thrust[i] : 0.0f;
+    const float scaled = std::fabs(request) * voltage_scale_;
+    magnitude[i] = scaled;
+    // Reverse requests are a fraction of reverse_max and saturate there.
+    const float fraction = scaled * (request < 0.0f ? reverse_scale_ : 1.0f);
+    position[i] = std::sqrt(std::fmin(fraction, 1.0f)) * kLastIndex;
+  }
+  for (uint8_t i = 0; i < count; ++i) {
+    const float* table = thrust[i] < 0.0f ? reverse_table_ : forward_table_;
+    const int index = static_cast<int>(position[i]) < kTableSize - 1 ? static_cast<int>(position[i])
+                                                                      : kTableSize - 2;
+    const float frac = position[i] - static_cast<float>(index);
+    const float value = table[index] + frac * (table[index + 1] - table[index]);
+    const float signed_value = std::copysign(value, thrust[i]);
+    command[i] = magnitude[i] < config_.zero_threshold ? 0.0f : signed_value;
+  }
+}
+
+float ThrustLinearizer::Command(float thrust) const {
+  float command = 0.0f;
+  Apply(&thrust, &command, 1);
+  return command;
+}
+
+float ThrustLinearizer::ModelThrust(float command) const {
+  const float magnitude = std::fabs(command);
+  if (magnitude <= config_.deadband) {
+    return 0.0f;
+  }
+  const float normalized = (magnitude - config_.deadband) / (1.0f - config_.deadband);
+  if (command >= 0.0f) {
+    return std::pow(normalized, config_.forward_exponent);
+  }
+  return -config_.reverse_max * std::pow(normalized, config_.reverse_exponent);
+}
+
+LinearizedOutput::LinearizedOutput(IActuatorOutput* output, const ThrustLinearizer* linearizer)
+    : output_(output), linearizer_(linearizer) {}
+
+bool LinearizedOutput::Initialize() {
+  return output_ && output_->Initialize();
+}
+
+bool LinearizedOutput::Write(const ActuatorCommand* commands, uint8_t count) {
+  if (!output_) {
+    return false;
+  }
+  if (!linearizer_) {
+    return output_->Write(commands, count);
+  }
+  count = count > ThrustLinearizer::kMaxChannels ? ThrustLinearizer::kMaxChannels : count;
+  float thrust[ThrustLinearizer::kMaxChannels] = {};
+  float command[ThrustLinearizer::kMaxChannels];
+  for (uint8_t i = 0; i < count; ++i) {
+    thrust[i] = commands[i].value;
+  }
+  linearizer_->Apply(thrust, command, count);
+  ActuatorCommand linearized[ThrustLinearizer::kMaxChannels];
+  for (uint8_t i = 0; i < count; ++i) {
+    linearized[i].value = command[i];
+  }
+  return output_->Write(linearized, count);
+}
+
+}  // namespace flight::actuators
@@ -0,0 +1,112 @@
+/**
+ * @file cascaded_controller.cpp
+ * @brief Multi-rate cascaded PID controller.
+ */
+
+#include "flight/controllers/cascaded_controller.h"
+
+#include <cmath>
+
+namespace flight::controllers {
+
+namespace {
+
+/** @brief Roll, pitch and yaw of a unit quaternion. */
+core::Vector3f ToEuler(const core::Quaternionf& q) {
+  core::Vector3f rpy;
+  rpy.x = std::atan2(2.0f * (q.w * q.x + q.y * q.z), 1.0f - 2.0f * (q.x * q.x + q.y * q.y));
+  const float sin_pitch = 2.0f * (q.w * q.y - q.z * q.x);
+  rpy.y = std::asin(sin_pitch > 1.0f ? 1.0f : (sin_pitch < -1.0f ? -1.0f : sin_pitch));
+  rpy.z = std::atan2(2.0f * (q.w * q.z + q.x * q.y), 1.0f - 2.0f * (q.y * q.y + q.z * q.z));
+  return rpy;
+}
+
+}  // namespace
+
+CascadedController::CascadedController() : CascadedController(Config{}) {}
+
+CascadedController::CascadedController(const Config& config)
+    : config_(config), allocator_(config.geometry), depth_pid_(config.depth) {
+  for (uint8_t i = 0; i < 3; ++i) {
+    rate_pid_[i] = Pid(config_.rate[i]);
+  }
+  for (uint8_t i = 0; i < 2; ++i) {
+    attitude_pid_[i] = Pid(config_.attitude[i]);
+    velocity_pid_[i] = Pid(config_.velocity[i]);
+  }
+  // Outer levels first so the rate loop always sees this tick's setpoints.
+  scheduler_.AddTask({"velocity", config_.velocity_hz, [this](float dt) { StepVelocity(dt); }});
+  scheduler_.AddTask({"attitude", config_.attitude_hz, [this](float dt) { StepAttitude(dt); }});
+  scheduler_.AddTask({"rate", config_.rate_hz, [this](float dt) { StepRate(dt); }});
+}
+
+bool CascadedController::Initialize() {
+  for (auto& pid : rate_pid_) {
+    pid.Reset();
+  }
+  for (uint8_t i = 0; i < 2; ++i) {
+    attitude_pid_[i].Reset();
+    velocity_pid_[i].Reset();
+  }
+  depth_pid_.Reset();
+  depth_primed_ = false;
+  rate_target_rps_ = {};
+  demand_ = {};
+  scheduler_.Reset();
+  return allocator_.Valid();
+}
+
+ControlOutput CascadedController::Update(const core::Pose& state,
+                                         const ControlSetpoint& setpoint,
+                                         float dt_s) {
+  state_ = state;
+  setpoint_ = setpoint;
+  scheduler_.Tick(dt_s);
+
+  ControlOutput output{};
+  output.motor_count = allocator_.Allocate(demand_, output.motors);
+  return output;
+}
+
+void CascadedController::StepVelocity(float dt_s) {
+  const core::Vector3f rpy = ToEuler(state_.orientation);
+  // World-frame horizontal velocity into the body frame (yaw only).
+  const float c = std::cos(rpy.z);
+  const float s = std::sin(rpy.z);
+  const float surge = c * state_.velocity_mps.x + s * state_.velocity_mps.y;
+  const float sway = -s * state_.velocity_mps.x + c * state_.velocity_mps.y;
+
+  demand_.axis[kSurge] =
+      velocity_pid_[0].Update(setpoint_.velocity_mps.x, surge, dt_s, setpoint_.velocity_mps.x);
+  demand_.axis[kSway] =
+      velocity_pid_[1].Update(setpoint_.velocity_mps.y, sway, dt_s, setpoint_.velocity_mps.y);
+
+  // Depth hold: the climb-rate command moves the target, the PID holds it.
+  if (!depth_primed_) {
+    depth_target_m_ = state_.position_m.z;
+    depth_primed_ = true;
+  }
+  depth_target_m_ += setpoint_.velocity_mps.z * dt_s;
+  demand_.axis[kHeave] =
+      depth_pid_.Update(depth_target_m_, state_.position_m.z, dt_s, setpoint_.velocity_mps.z);
+  ++step_count_[kVelocityLevel];
+}
+
+void CascadedController::StepAttitude(float dt_s) {
+  const core::Vector3f rpy = ToEuler(state_.orientation);
+  rate_target_rps_.x = attitude_pid_[0].Update(setpoint_.attitude_rpy_rad.x, rpy.x, dt_s);
+  rate_target_rps_.y = attitude_pid_[1].Update(setpoint_.attitude_rpy_rad.y, rpy.y, dt_s);
+  ++step_count_[kAttitudeLevel];
+}
+
+void CascadedController::StepRate(float dt_s) {
+  const core::Vector3f& rates = state_.angular_velocity_rps;
+  // Yaw rate comes straight from the stick, without waiting for the attitude level.
+  rate_target_rps_.z = setpoint_.body_rates_rps.z;
+  demand_.axis[kRoll] = rate_pid_[0].Update(rate_target_rps_.x, rates.x, dt_s, rate_target_rps_.x);
+  demand_.axis[kPitch] = rate_pid_[1].Update(rate_target_rps_.y, rates.y, dt_s, rate_target_rps_.y);
+  demand_.axis[kYaw] = rate_pid_[2].Update(rate_target_rps_.z, rates.z, dt_s, rate_target_rps_.z);
+  ++step_count_[kRateLevel];
+}
+
+}  // namespace flight::controllers
@@ -0,0 +1,231 @@
+/**
+ * @file control_allocator.cpp
+ * @brief Pseudo-inverse control allocation with axis priorities.
+ */
+
+#include "flight/controllers/control_allocator.h"
+
+#include <cmath>
+
+namespace flight::controllers {
+
+namespace {
+
+constexpr float kLimit = 1.0f;
+constexpr float kEpsilon = 1e-6f;
+
+/** @brief Largest s in [0, 1] keeping u + s * du inside the command limits. */
+float FitScale(const float* u, const float* du, uint8_t count) {
+  float scale = 1.0f;
+  for (uint8_t i = 0; i < count; ++i) {
+    if (du[i] > kEpsilon) {
+      scale = std::fmin(scale, (kLimit - u[i]) / du[i]);
+    } else if (du[i] < -kEpsilon) {
+      scale = std::fmin(scale, (-kLimit - u[i]) / du[i]);
+    }
+  }
+  return scale < 0.0f ? 0.0f : scale;
+}
+
+}  // namespace
+
+ControlAllocator::Config ControlAllocator::Rov4Config() {
+  Config config{};
+  config.thruster_count = 4;
+  // Each horizontal thruster gives half the surge and yaw authority, each
+  // vertical half the heave; the pseudo-inverse is then the classic mix
+  // m0 = surge + yaw, m1 = surge - yaw, m2 = m3 = heave.
+  config.geometry[kSurge][0] = 0.5f;
+  config.geometry[kSurge][1] = 0.5f;
+  config.geometry[kYaw][0] = 0.5f;
+  config.geometry[kYaw][1] = -0.5f;
+  config.geometry[kHeave][2] = 0.5f;
+  config.geometry[kHeave][3] = 0.5f;
+  return config;
+}
+
+void ControlAllocator::SetThruster(Config& config, uint8_t index, const core::Vector3f& position_m,
+                                   const core::Vector3f& direction, float max_thrust) {
+  if (index >= kMaxThrusters) {
+    return;
+  }
+  const core::Vector3f f{direction.x * max_thrust, direction.y * max_thrust,
+                         direction.z * max_thrust};
+  const core::Vector3f& r = position_m;
+  config.geometry[kSurge][index] = f.x;
+  config.geometry[kSway][index] = f.y;
+  config.geometry[kHeave][index] = f.z;
+  config.geometry[kRoll][index] = r.y * f.z - r.z * f.y;
+  config.geometry[kPitch][index] = r.z * f.x - r.x * f.z;
+  config.geometry[kYaw][index] = r.x * f.y - r.y * f.x;
+  if (config.thruster_count <= index) {
+    config.thruster_count = index + 1;
+  }
+}
+
+ControlAllocator::ControlAllocator() : ControlAllocator(Rov4Config()) {}
+
+ControlAllocator::ControlAllocator(const Config& config) : config_(config) {
+  if (config_.thruster_count > kMaxThrusters) {
+    config_.thruster_count = kMaxThrusters;
+  }
+  full_mask_ = (1u << config_.thruster_count) - 1u;
+  subsets_.resize(full_mask_ + 1u);
+  valid_ = config_.thruster_count > 0 && PseudoInverse(full_mask_, subsets_[full_mask_].inverse);
+  if (!valid_) {
+    return;
+  }
+  // Every subset the saturation loop can fall back to, solved once here.
+  for (uint32_t mask = 1; mask < full_mask_; ++mask) {
+    SubsetInverse& subset = subsets_[mask];
+    if (PseudoInverse(mask, subset.inverse)) {
+      subset.decoupled_axes = DecoupledAxes(subset.inverse);
+    }
+  }
+}
+
+uint8_t ControlAllocator::DecoupledAxes(const InverseMatrix& inverse) const {
+  const uint8_t n = config_.thruster_count;
+  uint8_t axes = 0;
+  for (uint8_t axis = 0; axis < kWrenchAxes; ++axis) {
+    bool decoupled = true;
+    for (uint8_t a = 0; a < kWrenchAxes && decoupled; ++a) {
+      float produced = 0.0f;
+      for (uint8_t t = 0; t < n; ++t) {
+        produced += config_.geometry[a][t] * inverse[t][axis];
+      }
+      const float expected = a == axis ? 1.0f : 0.0f;
+      decoupled = std::fabs(produced - expected) < 1e-3f;
+    }
+    axes = static_cast<uint8_t>(axes | (decoupled ? 1u << axis : 0u));
+  }
+  return axes;
+}
+
+bool ControlAllocator::PseudoInverse(uint32_t thruster_mask, InverseMatrix& out) const {
+  const uint8_t n = config_.thruster_count;
+  // M = B B^T + eps I, inverted in place by Gauss-Jordan with partial pivoting.
+  float m[kWrenchAxes][2 * kWrenchAxes] = {};
+  for (uint8_t r = 0; r < kWrenchAxes; ++r) {
+    for (uint8_t c = 0; c < kWrenchAxes; ++c) {
+      float sum = r == c ? config_.regularization : 0.0f;
+      for (uint8_t t = 0; t < n; ++t) {
+        if (thruster_mask & (1u << t)) {
+          sum += config_.geometry[r][t] * config_.geometry[c][t];
+        }
+      }
+      m[r][c] = sum;
+    }
+    m[r][kWrenchAxes + r] = 1.0f;
+  }
+  for (uint8_t col = 0; col < kWrenchAxes; ++col) {
+    uint8_t pivot = col;
+    for (uint8_t r = col + 1; r < kWrenchAxes; ++r) {
+      if (std::fabs(m[r][col]) > std::fabs(m[pivot][col])) {
+        pivot = r;
+      }
+    }
+    if (std::fabs(m[pivot][col]) < 1e-12f) {
+      return false;
+    }
+    if (pivot != col) {
+      for (uint8_t c = 0; c < 2 * kWrenchAxes; ++c) {
+        const float tmp = m[col][c];
+        m[col][c] = m[pivot][c];
+        m[pivot][c] = tmp;
+      }
+    }
+    const float inv_pivot = 1.0f / m[col][col];
+    for (uint8_t c = 0; c < 2 * kWrenchAxes; ++c) {
+      m[col][c] *= inv_pivot;
+    }
+    for (uint8_t r = 0; r < kWrenchAxes; ++r) {
+      if (r == col || m[r][col] == 0.0f) {
+        continue;
+      }
+      const float factor = m[r][col];
+      for (uint8_t c = 0; c < 2 * kWrenchAxes; ++c) {
+        m[r][c] -= factor * m[col][c];
+      }
+    }
+  }
+  // out = B^T M^-1, zero for masked-out thrusters.
+  for (uint8_t t = 0; t < kMaxThrusters; ++t) {
+    for (uint8_t a = 0; a < kWrenchAxes; ++a) {
+      float sum = 0.0f;
+      if (t < n && (thruster_mask & (1u << t))) {
+        for (uint8_t k = 0; k < kWrenchAxes; ++k) {
+          sum += config_.geometry[k][t] * m[k][kWrenchAxes + a];
+        }
+      }
+      out[t][a] = sum;
+    }
+  }
+  return true;
+}
+
+uint8_t ControlAllocator::Allocate(const Wrench& wrench, float* commands) {
+  const uint8_t n = config_.thruster_count;
+  float u[kMaxThrusters] = {};
+  float du[kMaxThrusters] = {};
+  if (!valid_) {
+    achieved_ = {};
+    for (uint8_t t = 0; t < n; ++t) {
+      commands[t] = 0.0f;
+    }
+    return n;
+  }
+
+  for (uint8_t p = 0; p < kWrenchAxes; ++p) {
+    const uint8_t axis = config_.priority[p];
+    if (axis >= kWrenchAxes) {
+      continue;
+    }
+    float remaining = wrench.axis[axis];
+    uint32_t free_mask = full_mask_;
+    const InverseMatrix* inverse = &subsets_[full_mask_].inverse;
+    for (uint8_t iteration = 0; iteration < kMaxIterations && std::fabs(remaining) > kEpsilon;
+         ++iteration) {
+      for (uint8_t t = 0; t < n; ++t) {
+        du[t] = (*inverse)[t][axis] * remaining;
+      }
+      const float scale = FitScale(u, du, n);
+      for (uint8_t t = 0; t < n; ++t) {
+        u[t] += scale * du[t];
+      }
+      remaining -= scale * remaining;
+      if (scale >= 1.0f) {
+        break;
+      }
+
+      // Freeze thrusters pinned at a limit and retry with the rest, as long
+      // as they can still produce this axis without disturbing the others.
+      uint32_t next_mask = free_mask;
+      for (uint8_t t = 0; t < n; ++t) {
+        if (std::fabs(u[t]) >= kLimit - 1e-5f) {
+          next_mask &= ~(1u << t);
+        }
+      }
+      if (next_mask == free_mask || next_mask == 0 ||
+          (subsets_[next_mask].decoupled_axes & (1u << axis)) == 0) {
+        break;
+      }
+      free_mask = next_mask;
+      inverse = &subsets_[next_mask].inverse;
+    }
+  }
+
+  for (uint8_t a = 0; a < kWrenchAxes; ++a) {
+    float sum = 0.0f;
+    for (uint8_t t = 0; t < n; ++t) {
+      sum += config_.geometry[a][t] * u[t];
+    }
+    achieved_.axis[a] = sum;
+  }
+  for (uint8_t t = 0; t < n; ++t) {
+    commands[t] = u[t];
+  }
+  return n;
+}
+
+}  // namespace flight::controllers
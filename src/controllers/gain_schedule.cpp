@@ -0,0 +1,94 @@
+/**
+ * @file gain_schedule.cpp
+ * @brief Interpolated, double-buffered gain scheduling.
+ */
+
+#include "flight/controllers/gain_schedule.h"
+
+namespace flight::controllers {
+
+namespace {
+
+/** @brief Segment index and blend weight of @p value on @p points. */
+void Locate(const float* points, uint8_t count, float value, uint8_t& index, float& weight) {
+  index = 0;
+  weight = 0.0f;
+  if (count < 2 || value <= points[0]) {
+    return;
+  }
+  if (value >= points[count - 1]) {
+    index = count - 2;
+    weight = 1.0f;
+    return;
+  }
+  while (index + 2 < count && value >= points[index + 1]) {
+    ++index;
+  }
+  weight = (value - points[index]) / (points[index + 1] - points[index]);
+}
+
+}  // namespace
+
+bool GainTable::Valid() const {
+  if (x_count == 0 || x_count > kMaxBreakpoints || y_count == 0 || y_count > kMaxBreakpoints ||
+      gain_count > kMaxGains) {
+    return false;
+  }
+  for (uint8_t i = 1; i < x_count; ++i) {
+    if (!(x[i] > x[i - 1])) {
+      return false;
+    }
+  }
+  for (uint8_t i = 1; i < y_count; ++i) {
+    if (!(y[i] > y[i - 1])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+GainSchedule::GainSchedule() = default;
+
+GainSchedule::GainSchedule(const GainTable& table) {
+  if (table.Valid()) {
+    tables_[0] = table;
+    generation_.store(1, std::memory_order_release);
+  }
+}
+
+bool GainSchedule::Update(const GainTable& table) {
+  const uint8_t active = active_.load(std::memory_order_acquire);
+  if (!table.Valid() || in_use_.load(std::memory_order_acquire) != active) {
+    return false;
+  }
+  const uint8_t spare = active ^ 1u;
+  tables_[spare] = table;
+  active_.store(spare, std::memory_order_release);
+  generation_.fetch_add(1, std::memory_order_acq_rel);
+  return true;
+}
+
+uint8_t GainSchedule::Evaluate(float x, float y, float* gains_out) {
+  const uint8_t index = active_.load(std::memory_order_acquire);
+  in_use_.store(index, std::memory_order_release);
+  const GainTable& table = tables_[index];
+
+  uint8_t ix = 0;
+  uint8_t iy = 0;
+  float wx = 0.0f;
+  float wy = 0.0f;
+  Locate(table.x, table.x_count, x, ix, wx);
+  Locate(table.y, table.y_count, y, iy, wy);
+  const uint8_t ix1 = table.x_count > 1 ? ix + 1 : ix;
+  const uint8_t iy1 = table.y_count > 1 ? iy + 1 : iy;
+
+  for (uint8_t g = 0; g < table.gain_count; ++g) {
+    const float low = table.gains[ix][iy][g] + wx * (table.gains[ix1][iy][g] - table.gains[ix][iy][g]);
+    const float high =
+        table.gains[ix][iy1][g] + wx * (table.gains[ix1][iy1][g] - table.gains[ix][iy1][g]);
+    gains_out[g] = low + wy * (high - low);
+  }
+  return table.gain_count;
+}
+
+}  // namespace flight::controllers
@@ -0,0 +1,106 @@
+/**
+ * @file lqr_controller.cpp
+ * @brief Gain-table LQR station keeping.
+ */
+
+#include "flight/controllers/lqr_controller.h"
+
+#include <cmath>
+
+namespace flight::controllers {
+
+namespace {
+
+constexpr float kPi = 3.14159265358979f;
+
+float WrapPi(float angle) {
+  while (angle > kPi) {
+    angle -= 2.0f * kPi;
+  }
+  while (angle < -kPi) {
+    angle += 2.0f * kPi;
+  }
+  return angle;
+}
+
+float Yaw(const core::Quaternionf& q) {
+  return std::atan2(2.0f * (q.w * q.z + q.x * q.y), 1.0f - 2.0f * (q.y * q.y + q.z * q.z));
+}
+
+}  // namespace
+
+LqrGainTable DefaultLqrTable() {
+  return {lqr_tables::kRegions, lqr_tables::kRegionSpeed, lqr_tables::kGains,
+          lqr_tables::kSampleTimeS};
+}
+
+LqrController::LqrController() : LqrController(Config{}) {}
+
+LqrController::LqrController(const Config& config)
+    : config_(config), allocator_(config.geometry) {}
+
+bool LqrController::Initialize() {
+  region_ = 0;
+  demand_ = {};
+  rate_mismatches_ = 0;
+  return allocator_.Valid() && config_.table.region_count > 0 && config_.table.gains &&
+         config_.table.region_speed;
+}
+
+uint8_t LqrController::Region(float surge_speed_mps) const {
+  const float speed = std::fabs(surge_speed_mps);
+  const uint8_t last = config_.table.region_count - 1;
+  for (uint8_t r = 0; r < last; ++r) {
+    if (speed < config_.table.region_speed[r]) {
+      return r;
+    }
+  }
+  return last;
+}
+
+ControlOutput LqrController::Update(const core::Pose& state,
+                                    const ControlSetpoint& setpoint,
+                                    float dt_s) {
+  ControlOutput output{};
+  if (config_.table.region_count == 0 || !config_.table.gains) {
+    return output;
+  }
+  // The gains were discretized for one sample time; other rates are flagged, not rescaled.
+  if (std::fabs(dt_s - config_.table.sample_time_s) > 0.1f * config_.table.sample_time_s) {
+    ++rate_mismatches_;
+  }
+
+  const float yaw = Yaw(state.orientation);
+  const float c = std::cos(yaw);
+  const float s = std::sin(yaw);
+  const float dx = state.position_m.x - setpoint.position_m.x;
+  const float dy = state.position_m.y - setpoint.position_m.y;
+  const float u = c * state.velocity_mps.x + s * state.velocity_mps.y;
+  const float v = -s * state.velocity_mps.x + c * state.velocity_mps.y;
+
+  error_[0] = c * dx + s * dy;
+  error_[1] = -s * dx + c * dy;
+  error_[2] = state.position_m.z - setpoint.position_m.z;
+  error_[3] = WrapPi(yaw - setpoint.attitude_rpy_rad.z);
+  error_[4] = u - setpoint.velocity_mps.x;
+  error_[5] = v - setpoint.velocity_mps.y;
+  error_[6] = state.velocity_mps.z - setpoint.velocity_mps.z;
+  error_[7] = state.angular_velocity_rps.z - setpoint.body_rates_rps.z;
+
+  region_ = Region(u);
+  const auto& gains = config_.table.gains[region_];
+  constexpr uint8_t kAxis[kInputs] = {kSurge, kSway, kHeave, kYaw};
+  demand_ = {};
+  for (uint8_t i = 0; i < kInputs; ++i) {
+    float sum = 0.0f;
+    for (uint8_t k = 0; k < kStates; ++k) {
+      sum += gains[i][k] * error_[k];
+    }
+    demand_.axis[kAxis[i]] = -sum;
+  }
+
+  output.motor_count = allocator_.Allocate(demand_, output.motors);
+  return output;
+}
+
+}  // namespace flight::controllers
@@ -0,0 +1,67 @@
+/**
+ * @file pid.cpp
+ * @brief PID block with filtered derivative and anti-windup.
+ */
+
+#include "flight/controllers/pid.h"
+
+namespace flight::controllers {
+
+namespace {
+
+constexpr float kTwoPi = 6.28318530718f;
+
+float Clamp(float value, float limit) {
+  if (value > limit) {
+    return limit;
+  }
+  if (value < -limit) {
+    return -limit;
+  }
+  return value;
+}
+
+}  // namespace
+
+Pid::Pid() : Pid(Config{}) {}
+
+Pid::Pid(const Config& config) : config_(config) {}
+
+void Pid::Reset() {
+  integral_ = 0.0f;
+  derivative_ = 0.0f;
+  primed_ = false;
+}
+
+float Pid::Update(float setpoint, float measurement, float dt_s, float feedforward) {
+  if (dt_s <= 0.0f) {
+    return 0.0f;
+  }
+  const float error = setpoint - measurement;
+
+  if (primed_ && config_.kd != 0.0f) {
+    const float raw = -(measurement - last_measurement_) / dt_s;
+    if (config_.d_cutoff_hz > 0.0f) {
+      const float rc = 1.0f / (kTwoPi * config_.d_cutoff_hz);
+      derivative_ += (dt_s / (rc + dt_s)) * (raw - derivative_);
+    } else {
+      derivative_ = raw;
+    }
+  }
+  last_measurement_ = measurement;
+  primed_ = true;
+
+  const float unlimited = config_.kp * error + integral_ + config_.kd * derivative_ +
+                          config_.kff * feedforward;
+  const float output = Clamp(unlimited, config_.output_limit);
+
+  // Only integrate when it does not push further into saturation.
+  const float step = config_.ki * error * dt_s;
+  const bool saturated = unlimited != output;
+  if (!saturated || (step > 0.0f) != (unlimited > 0.0f)) {
+    integral_ = Clamp(integral_ + step, config_.integral_limit);
+  }
+  return output;
+}
+
+}  // namespace flight::controllers
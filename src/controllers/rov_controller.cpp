@@ -1,46 +1,44 @@
 /**
  * @file rov_controller.cpp
- * @brief ROV mixer implementation for 4 thrusters.
+ * @brief ROV mixer implementation on top of the control allocator.
  */
 
 #include "flight/controllers/rov_controller.h"
 
-namespace flight::controllers {
-
-namespace {
+#include <cmath>
 
-/** @brief Clamp helper. */
-float Clamp(float value, float min_value, float max_value) {
-  if (value < min_value) {
-    return min_value;
-  }
-  if (value > max_value) {
-    return max_value;
-  }
-  return value;
-}
+namespace flight::controllers {
 
-}  // namespace
+/** @brief Construct with mixer configuration and the 4-thruster geometry. */
+RovController::RovController(const RovMixConfig& config)
+    : RovController(config, ControlAllocator::Rov4Config()) {}
 
-/** @brief Construct with mixer configuration. */
-RovController::RovController(const RovMixConfig& config) : config_(config) {}
+/** @brief Construct with mixer configuration and a custom geometry. */
+RovController::RovController(const RovMixConfig& config, const ControlAllocator::Config& geometry)
+    : config_(config), allocator_(geometry) {}
 
-/** @brief Mix surge/yaw/heave into thruster commands. */
-ControlOutput RovController::Update(const core::Pose&,
+/** @brief Allocate surge/yaw/heave into thruster commands. */
+ControlOutput RovController::Update(const core::Pose& state,
                                     const ControlSetpoint& setpoint,
                                     float) {
-  ControlOutput output{};
-  output.motor_count = 4;
-
-  const float surge = setpoint.velocity_mps.x * config_.surge_gain;
-  const float yaw = setpoint.body_rates_rps.z * config_.yaw_gain;
-  const float heave = setpoint.velocity_mps.z * config_.heave_gain;
+  float gains[GainTable::kMaxGains] = {config_.surge_gain, config_.yaw_gain, config_.heave_gain};
+  if (schedule_) {
+    float scheduled[GainTable::kMaxGains];
+    const float speed = std::hypot(state.velocity_mps.x, state.velocity_mps.y);
+    if (schedule_->Evaluate(speed, -state.position_m.z, scheduled) > kRovHeaveGain) {
+      for (uint8_t i = 0; i <= kRovHeaveGain; ++i) {
+        gains[i] = scheduled[i];
+      }
+    }
+  }
 
-  output.motors[0] = Clamp(surge + yaw, -1.0f, 1.0f);  // horizontal left
-  output.motors[1] = Clamp(surge - yaw, -1.0f, 1.0f);  // horizontal right
-  output.motors[2] = Clamp(heave, -1.0f, 1.0f);        // vertical front
-  output.motors[3] = Clamp(heave, -1.0f, 1.0f);        // vertical rear
+  Wrench wrench{};
+  wrench.axis[kSurge] = setpoint.velocity_mps.x * gains[kRovSurgeGain];
+  wrench.axis[kYaw] = setpoint.body_rates_rps.z * gains[kRovYawGain];
+  wrench.axis[kHeave] = setpoint.velocity_mps.z * gains[kRovHeaveGain];
 
+  ControlOutput output{};
+  output.motor_count = allocator_.Allocate(wrench, output.motors);
   return output;
 }
 
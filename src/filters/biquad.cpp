@@ -0,0 +1,35 @@
+/**
+ * @file biquad.cpp
+ * @brief Biquad coefficient helpers.
+ */
+
+#include "flight/filters/biquad.h"
+
+#include <cmath>
+
+namespace flight::filters {
+
+namespace {
+
+constexpr float kPi = 3.14159265f;
+
+}  // namespace
+
+/** @brief RBJ cookbook notch with unity gain away from the center. */
+BiquadCoefficients MakeNotchCoefficients(float center_hz, float q, float sample_rate_hz) {
+  const float omega = 2.0f * kPi * center_hz / sample_rate_hz;
+  const float sn = std::sin(omega);
+  const float cs = std::cos(omega);
+  const float alpha = sn / (2.0f * q);
+  const float a0_inv = 1.0f / (1.0f + alpha);
+
+  BiquadCoefficients c{};
+  c.b0 = a0_inv;
+  c.b1 = -2.0f * cs * a0_inv;
+  c.b2 = a0_inv;
+  c.a1 = c.b1;
+  c.a2 = (1.0f - alpha) * a0_inv;
+  return c;
+}
+
+}  // namespace flight::filters
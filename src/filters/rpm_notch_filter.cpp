@@ -0,0 +1,206 @@
+/**
+ * @file rpm_notch_filter.cpp
+ * @brief RPM-tracking gyro notch filter bank.
+ */
+
+#include "flight/filters/rpm_notch_filter.h"
+
+#include <cmath>
+
+namespace flight::filters {
+
+namespace {
+
+/** @brief Upper notch limit as a fraction of the sample rate (below Nyquist). */
+constexpr float kMaxNyquistFraction = 0.48f;
+/** @brief Center shift below which a notch is not recomputed. */
+constexpr float kRetuneThresholdHz = 0.5f;
+
+}  // namespace
+
+/** @brief Construct with filter configuration. */
+RpmNotchFilter::RpmNotchFilter(const Config& config) : config_(config) {}
+
+/** @brief Reset all notches and clamp config to supported sizes. */
+bool RpmNotchFilter::Initialize() {
+  if (config_.sample_rate_hz <= 0.0f || config_.q <= 0.0f || config_.motor_pole_count < 2) {
+    return false;
+  }
+  if (config_.motor_count > kMaxMotors) {
+    config_.motor_count = kMaxMotors;
+  }
+  if (config_.harmonics > kMaxHarmonics) {
+    config_.harmonics = kMaxHarmonics;
+  }
+  if (config_.spectrum_notches > kMaxSpectrumNotches) {
+    config_.spectrum_notches = kMaxSpectrumNotches;
+  }
+  notch_count_ = static_cast<uint8_t>(config_.motor_count * config_.harmonics);
+  slot_count_ = static_cast<uint8_t>(notch_count_ + 3 * config_.spectrum_notches);
+  for (auto& notch : notches_) {
+    notch = Notch{};
+  }
+  for (uint8_t axis = 0; axis < 3; ++axis) {
+    for (uint8_t i = 0; i < kMaxSpectrumNotches; ++i) {
+      spectrum_notches_[axis][i] = Notch{};
+      spectrum_hz_[axis][i] = 0.0f;
+    }
+  }
+  for (auto& hz : motor_hz_) {
+    hz = 0.0f;
+  }
+  retune_cursor_ = 0;
+  last_retunes_ = 0;
+  return true;
+}
+
+/** @brief Update a motor frequency from a telemetry frame. */
+void RpmNotchFilter::UpdateTelemetry(const actuators::DshotTelemetryFrame& frame) {
+  if (!frame.crc_ok) {
+    return;
+  }
+  SetMotorErpm(frame.channel, actuators::ErpmFromPeriodCode(frame.data));
+}
+
+/** @brief Convert eRPM to mechanical rotation frequency. */
+void RpmNotchFilter::SetMotorErpm(uint8_t motor, uint32_t erpm) {
+  if (motor >= config_.motor_count) {
+    return;
+  }
+  const float pole_pairs = static_cast<float>(config_.motor_pole_count / 2);
+  motor_hz_[motor] = static_cast<float>(erpm) / (pole_pairs * 60.0f);
+}
+
+/**
+ * @brief Record analyzer peaks; coefficients follow on the next retunes.
+ *
+ * Peaks already inside the bandwidth (f / q) of an RPM harmonic are skipped,
+ * so the slots go to the strongest resonances the RPM bank does not cover.
+ */
+void RpmNotchFilter::SetSpectrumPeaks(uint8_t axis, const float* hz, uint8_t count) {
+  if (axis >= 3) {
+    return;
+  }
+  uint8_t used = 0;
+  for (uint8_t i = 0; i < count && used < config_.spectrum_notches; ++i) {
+    if (hz[i] > 0.0f && !CoveredByRpmNotch(hz[i])) {
+      spectrum_hz_[axis][used++] = hz[i];
+    }
+  }
+  for (; used < config_.spectrum_notches; ++used) {
+    spectrum_hz_[axis][used] = 0.0f;
+  }
+}
+
+bool RpmNotchFilter::CoveredByRpmNotch(float hz) const {
+  for (uint8_t motor = 0; motor < config_.motor_count; ++motor) {
+    for (uint8_t harmonic = 0; harmonic < config_.harmonics; ++harmonic) {
+      const float center_hz = motor_hz_[motor] * static_cast<float>(harmonic + 1);
+      if (center_hz >= config_.min_hz && std::fabs(hz - center_hz) <= center_hz / config_.q) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+float RpmNotchFilter::NotchHz(uint8_t motor, uint8_t harmonic) const {
+  if (motor >= config_.motor_count || harmonic >= config_.harmonics) {
+    return 0.0f;
+  }
+  const Notch& notch = notches_[motor * config_.harmonics + harmonic];
+  return notch.active ? notch.center_hz : 0.0f;
+}
+
+float RpmNotchFilter::SpectrumNotchHz(uint8_t axis, uint8_t index) const {
+  if (axis >= 3 || index >= config_.spectrum_notches) {
+    return 0.0f;
+  }
+  const Notch& notch = spectrum_notches_[axis][index];
+  return notch.active ? notch.center_hz : 0.0f;
+}
+
+/** @brief Move one notch to its target; returns true if coefficients changed. */
+bool RpmNotchFilter::RetuneNotch(Notch& notch, float target_hz, float q, float max_hz) {
+  if (target_hz < config_.min_hz || target_hz > max_hz) {
+    notch.active = false;
+    return false;
+  }
+  if (notch.active && std::fabs(target_hz - notch.center_hz) < kRetuneThresholdHz) {
+    return false;
+  }
+  if (!notch.active) {
+    for (auto& state : notch.state) {
+      state.Reset();
+    }
+  }
+  notch.coeffs = MakeNotchCoefficients(target_hz, q, config_.sample_rate_hz);
+  notch.center_hz = target_hz;
+  notch.active = true;
+  return true;
+}
+
+/**
+ * @brief Walk the bank round-robin and recompute stale notches.
+ *
+ * Every slot is checked each tick, but only up to max_retunes_per_tick
+ * coefficient sets (the trig-heavy part) are rebuilt.
+ */
+void RpmNotchFilter::Retune() {
+  last_retunes_ = 0;
+  if (slot_count_ == 0) {
+    return;
+  }
+  const float max_hz = config_.sample_rate_hz * kMaxNyquistFraction;
+  for (uint8_t visited = 0; visited < slot_count_; ++visited) {
+    if (last_retunes_ >= config_.max_retunes_per_tick) {
+      break;
+    }
+    const uint8_t index = retune_cursor_;
+    retune_cursor_ = static_cast<uint8_t>((retune_cursor_ + 1) % slot_count_);
+
+    bool changed = false;
+    if (index < notch_count_) {
+      const uint8_t motor = static_cast<uint8_t>(index / config_.harmonics);
+      const uint8_t harmonic = static_cast<uint8_t>(index % config_.harmonics);
+      const float target_hz = motor_hz_[motor] * static_cast<float>(harmonic + 1);
+      changed = RetuneNotch(notches_[index], target_hz, config_.q, max_hz);
+    } else {
+      const uint8_t slot = static_cast<uint8_t>(index - notch_count_);
+      const uint8_t axis = static_cast<uint8_t>(slot / config_.spectrum_notches);
+      const uint8_t i = static_cast<uint8_t>(slot % config_.spectrum_notches);
+      changed = RetuneNotch(spectrum_notches_[axis][i], spectrum_hz_[axis][i],
+                            config_.spectrum_q, max_hz);
+    }
+    if (changed) {
+      ++last_retunes_;
+    }
+  }
+}
+
+/** @brief Run the active notches over each gyro axis. */
+core::Vector3f RpmNotchFilter::Apply(const core::Vector3f& gyro) {
+  Retune();
+
+  float axes[3] = {gyro.x, gyro.y, gyro.z};
+  for (uint8_t i = 0; i < notch_count_; ++i) {
+    Notch& notch = notches_[i];
+    if (!notch.active) {
+      continue;
+    }
+    for (uint8_t axis = 0; axis < 3; ++axis) {
+      axes[axis] = notch.state[axis].Apply(notch.coeffs, axes[axis]);
+    }
+  }
+  for (uint8_t axis = 0; axis < 3; ++axis) {
+    for (uint8_t i = 0; i < config_.spectrum_notches; ++i) {
+      Notch& notch = spectrum_notches_[axis][i];
+      if (notch.active) {
+        axes[axis] = notch.state[0].Apply(notch.coeffs, axes[axis]);
+      }
+    }
+  }
+  return {axes[0], axes[1], axes[2]};
+}
+
+}  // namespace flight::filters
@@ -0,0 +1,155 @@
+/**
+ * @file spectrum_analyzer.cpp
+ * @brief Sliding-DFT gyro spectrum analyzer.
+ */
+
+#include "flight/filters/spectrum_analyzer.h"
+
+#include <cmath>
+
+namespace flight::filters {
+
+namespace {
+
+constexpr float kPi = 3.14159265f;
+/** @brief Per-sample damping that keeps the recursive DFT numerically stable. */
+constexpr float kDamping = 0.9999f;
+
+}  // namespace
+
+/** @brief Construct with analyzer configuration. */
+SpectrumAnalyzer::SpectrumAnalyzer(const Config& config) : config_(config) {}
+
+/** @brief Resolve the tracked bin range and precompute twiddles. */
+bool SpectrumAnalyzer::Initialize() {
+  if (config_.sample_rate_hz <= 0.0f || config_.max_hz <= config_.min_hz) {
+    return false;
+  }
+  const float bin_hz = BinHz();
+  int first = static_cast<int>(std::floor(config_.min_hz / bin_hz));
+  int last = static_cast<int>(std::ceil(config_.max_hz / bin_hz));
+  // Keep one neighbour bin on each side for the Hann kernel.
+  first = first < 1 ? 1 : first;
+  last = last > kMaxBins - 1 ? kMaxBins - 1 : last;
+  if (last <= first) {
+    return false;
+  }
+  first_bin_ = static_cast<uint8_t>(first);
+  last_bin_ = static_cast<uint8_t>(last);
+
+  for (uint8_t k = 0; k <= kMaxBins; ++k) {
+    const float omega = 2.0f * kPi * static_cast<float>(k) / static_cast<float>(kWindowSize);
+    twiddle_re_[k] = kDamping * std::cos(omega);
+    twiddle_im_[k] = kDamping * std::sin(omega);
+  }
+  damping_n_ = std::pow(kDamping, static_cast<float>(kWindowSize));
+
+  for (uint8_t axis = 0; axis < 3; ++axis) {
+    for (uint8_t k = 0; k <= kMaxBins; ++k) {
+      bin_re_[axis][k] = 0.0f;
+      bin_im_[axis][k] = 0.0f;
+    }
+    for (auto& sample : history_[axis]) {
+      sample = 0.0f;
+    }
+    for (auto& peak : peaks_[axis]) {
+      peak = Peak{};
+    }
+  }
+  head_ = 0;
+  filled_ = 0;
+  peak_axis_ = 0;
+  return true;
+}
+
+/** @brief Slide the window by one sample on every axis. */
+void SpectrumAnalyzer::Push(const core::Vector3f& gyro) {
+  const float input[3] = {gyro.x, gyro.y, gyro.z};
+  const uint8_t lo = static_cast<uint8_t>(first_bin_ - 1);
+  const uint8_t hi = static_cast<uint8_t>(last_bin_ + 1);
+
+  for (uint8_t axis = 0; axis < 3; ++axis) {
+    const float delta = input[axis] - damping_n_ * history_[axis][head_];
+    history_[axis][head_] = input[axis];
+    float* re = bin_re_[axis];
+    float* im = bin_im_[axis];
+    for (uint8_t k = lo; k <= hi; ++k) {
+      const float r = re[k] + delta;
+      const float i = im[k];
+      re[k] = r * twiddle_re_[k] - i * twiddle_im_[k];
+      im[k] = r * twiddle_im_[k] + i * twiddle_re_[k];
+    }
+  }
+  head_ = static_cast<uint16_t>((head_ + 1) % kWindowSize);
+  if (filled_ < kWindowSize) {
+    ++filled_;
+    return;
+  }
+
+  UpdatePeaks(peak_axis_);
+  peak_axis_ = static_cast<uint8_t>((peak_axis_ + 1) % 3);
+}
+
+void SpectrumAnalyzer::UpdateAllPeaks() {
+  for (uint8_t axis = 0; axis < 3; ++axis) {
+    UpdatePeaks(axis);
+  }
+}
+
+/** @brief Hann-windowed magnitude, scaled to sine amplitude. */
+float SpectrumAnalyzer::BinMagnitude(uint8_t axis, uint8_t bin) const {
+  if (bin == 0 || bin >= kMaxBins) {
+    return 0.0f;
+  }
+  const float* re = bin_re_[axis];
+  const float* im = bin_im_[axis];
+  const float wr = 0.5f * re[bin] - 0.25f * (re[bin - 1] + re[bin + 1]);
+  const float wi = 0.5f * im[bin] - 0.25f * (im[bin - 1] + im[bin + 1]);
+  return std::sqrt(wr * wr + wi * wi) * (4.0f / static_cast<float>(kWindowSize));
+}
+
+/** @brief Find the strongest local maxima and refine them by interpolation. */
+void SpectrumAnalyzer::UpdatePeaks(uint8_t axis) {
+  float magnitude[kMaxBins + 1] = {};
+  float sum = 0.0f;
+  for (uint8_t k = first_bin_; k <= last_bin_; ++k) {
+    magnitude[k] = BinMagnitude(axis, k);
+    sum += magnitude[k];
+  }
+  const float mean = sum / static_cast<float>(last_bin_ - first_bin_ + 1);
+  const float threshold = mean * config_.peak_ratio;
+
+  Peak found[kMaxPeaks]{};
+  for (uint8_t k = first_bin_; k <= last_bin_; ++k) {
+    const float m = magnitude[k];
+    const bool interior = k > first_bin_ && k < last_bin_;
+    const float left = k > first_bin_ ? magnitude[k - 1] : 0.0f;
+    const float right = k < last_bin_ ? magnitude[k + 1] : 0.0f;
+    if (m <= threshold || m < left || m <= right) {
+      continue;
+    }
+
+    float offset = 0.0f;
+    const float denom = left - 2.0f * m + right;
+    if (interior && denom < 0.0f) {
+      offset = 0.5f * (left - right) / denom;
+      offset = offset > 0.5f ? 0.5f : (offset < -0.5f ? -0.5f : offset);
+    }
+    const Peak peak{(static_cast<float>(k) + offset) * BinHz(), m};
+
+    for (uint8_t slot = 0; slot < kMaxPeaks; ++slot) {
+      if (peak.magnitude > found[slot].magnitude) {
+        for (uint8_t j = kMaxPeaks - 1; j > slot; --j) {
+          found[j] = found[j - 1];
+        }
+        found[slot] = peak;
+        break;
+      }
+    }
+  }
+  for (uint8_t slot = 0; slot < kMaxPeaks; ++slot) {
+    peaks_[axis][slot] = found[slot];
+  }
+}
+
+}  // namespace flight::filters
@@ -0,0 +1,55 @@
+/**
+ * @file linux_hal.cpp
+ * @brief Linux host HAL implementations.
+ */
+
+#include "flight/hal/linux_hal.h"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
+namespace flight::hal {
+
+/** @brief CLOCK_MONOTONIC in microseconds (0 off Linux). */
+uint64_t LinuxTime::NowUs() const {
+#if defined(__linux__)
+  timespec now{};
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<uint64_t>(now.tv_sec) * 1000000u + static_cast<uint64_t>(now.tv_nsec) / 1000u;
+#else
+  return 0;
+#endif
+}
+
+/** @brief Sleep on CLOCK_MONOTONIC, resuming after signals. */
+void LinuxTime::SleepUs(uint64_t duration_us) {
+#if defined(__linux__)
+  timespec remaining{static_cast<time_t>(duration_us / 1000000u),
+                     static_cast<long>(duration_us % 1000000u) * 1000};
+  while (clock_nanosleep(CLOCK_MONOTONIC, 0, &remaining, &remaining) != 0) {
+  }
+#else
+  (void)duration_us;
+#endif
+}
+
+/** @brief Set the CPU affinity of a running std::thread. */
+bool PinThreadToCpu(std::thread& thread, int cpu) {
+  if (cpu < 0) {
+    return true;
+  }
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) == 0;
+#else
+  (void)thread;
+  return false;
+#endif
+}
+
+}  // namespace flight::hal
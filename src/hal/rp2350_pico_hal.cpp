@@ -5,7 +5,9 @@
 
 #include "flight/hal/rp2350_pico_hal.h"
 
+#include <hardware/clocks.h>
 #include <hardware/i2c.h>
+#include <hardware/pwm.h>
 #include <pico/stdlib.h>
 
 namespace flight::hal {
@@ -58,4 +60,33 @@ bool Rp2350I2c::WriteRead(uint8_t address,
   return read == static_cast<int>(out_length);
 }
 
+uint32_t Rp2350Pwm::ClockHz() const {
+  return clock_get_hz(clk_sys);
+}
+
+bool Rp2350Pwm::ConfigureSlice(uint8_t slice, uint8_t divider, uint16_t top) {
+  if (divider == 0) {
+    return false;
+  }
+  pwm_set_enabled(slice, false);
+  pwm_set_phase_correct(slice, false);
+  pwm_set_clkdiv_int_frac(slice, divider, 0);
+  pwm_set_wrap(slice, top);
+  pwm_set_counter(slice, 0);
+  return true;
+}
+
+void Rp2350Pwm::EnablePin(uint32_t gpio) {
+  gpio_set_function(gpio, GPIO_FUNC_PWM);
+}
+
+void Rp2350Pwm::SetLevel(uint8_t slice, uint8_t channel, uint16_t level) {
+  // CC is double-buffered in hardware and latches on the next wrap.
+  pwm_set_chan_level(slice, channel, level);
+}
+
+void Rp2350Pwm::EnableSlices(uint32_t slice_mask) {
+  pwm_set_mask_enabled(slice_mask);
+}
+
 }  // namespace flight::hal
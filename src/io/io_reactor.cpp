@@ -0,0 +1,118 @@
+/**
+ * @file io_reactor.cpp
+ * @brief epoll-based I/O thread.
+ */
+
+#include "flight/io/io_reactor.h"
+
+#include "flight/hal/linux_hal.h"
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+namespace flight::io {
+
+IoReactor::IoReactor() : IoReactor(Config{}) {}
+
+IoReactor::IoReactor(const Config& config) : config_(config) {}
+
+IoReactor::~IoReactor() {
+  Stop();
+}
+
+bool IoReactor::Add(IIoEndpoint* endpoint) {
+  if (!endpoint || Running() || endpoint_count_ == kMaxEndpoints) {
+    return false;
+  }
+  endpoints_[endpoint_count_++] = endpoint;
+  return true;
+}
+
+bool IoReactor::Start() {
+#if defined(__linux__)
+  if (Running()) {
+    return false;
+  }
+  epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+  stop_fd_ = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (epoll_fd_ < 0 || stop_fd_ < 0) {
+    Stop();
+    return false;
+  }
+  epoll_event event{};
+  event.events = EPOLLIN;
+  event.data.u64 = kMaxEndpoints;
+  if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, stop_fd_, &event) < 0) {
+    Stop();
+    return false;
+  }
+  for (size_t i = 0; i < endpoint_count_; ++i) {
+    const int fd = endpoints_[i]->ReadableFd();
+    if (fd < 0) {
+      continue;
+    }
+    event.data.u64 = i;
+    if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) < 0) {
+      Stop();
+      return false;
+    }
+  }
+
+  running_.store(true, std::memory_order_release);
+  thread_ = std::thread([this] { Run(); });
+  hal::PinThreadToCpu(thread_, config_.cpu);
+  return true;
+#else
+  return false;
+#endif
+}
+
+void IoReactor::Stop() {
+#if defined(__linux__)
+  if (thread_.joinable()) {
+    const uint64_t one = 1;
+    (void)!::write(stop_fd_, &one, sizeof(one));
+    thread_.join();
+  }
+  running_.store(false, std::memory_order_release);
+  if (epoll_fd_ >= 0) {
+    ::close(epoll_fd_);
+    epoll_fd_ = -1;
+  }
+  if (stop_fd_ >= 0) {
+    ::close(stop_fd_);
+    stop_fd_ = -1;
+  }
+#endif
+}
+
+void IoReactor::Run() {
+#if defined(__linux__)
+  const int timeout_ms = static_cast<int>((config_.wake_interval_us + 999) / 1000);
+  epoll_event events[kMaxEndpoints + 1];
+  for (;;) {
+    const int ready = ::epoll_wait(epoll_fd_, events, kMaxEndpoints + 1, timeout_ms);
+    bool stop = false;
+    for (int i = 0; i < ready; ++i) {
+      const uint64_t index = events[i].data.u64;
+      if (index == kMaxEndpoints) {
+        stop = true;
+        continue;
+      }
+      endpoints_[index]->OnReadable();
+    }
+    for (size_t i = 0; i < endpoint_count_; ++i) {
+      endpoints_[i]->OnWake();
+    }
+    wakeups_.fetch_add(1, std::memory_order_relaxed);
+    if (stop) {
+      return;
+    }
+  }
+#endif
+}
+
+}  // namespace flight::io
@@ -0,0 +1,39 @@
+/**
+ * @file reactor_endpoints.cpp
+ * @brief Command receiver and telemetry sink adapters for IoReactor.
+ */
+
+#include "flight/io/reactor_endpoints.h"
+
+namespace flight::io {
+
+ReactorCommandReceiver::ReactorCommandReceiver(receiver::UdpReceiver& udp) : udp_(udp) {}
+
+bool ReactorCommandReceiver::Initialize() {
+  return udp_.Initialize();
+}
+
+std::optional<receiver::CommandFrame> ReactorCommandReceiver::Read() {
+  receiver::CommandFrame frame{};
+  if (!mailbox_.Read(frame)) {
+    return std::nullopt;
+  }
+  return frame;
+}
+
+size_t ReactorCommandReceiver::ReadBatch(receiver::CommandFrame* out, size_t capacity) {
+  return capacity > 0 && mailbox_.Read(out[0]) ? 1 : 0;
+}
+
+void ReactorCommandReceiver::OnReadable() {
+  receiver::CommandFrame frame{};
+  if (udp_.ReadBatch(&frame, 1) == 1) {
+    mailbox_.Write(frame);
+    published_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+ReactorTelemetrySink::ReactorTelemetrySink(telemetry::ITelemetrySink& sink, core::DropPolicy drop)
+    : async_(sink, {0, -1, drop}) {}
+
+}  // namespace flight::io
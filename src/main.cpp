@@ -4,17 +4,25 @@
  */
 
 #include "flight/actuators/biheli_pwm_output.h"
+#include "flight/actuators/thrust_linearizer.h"
 #include "flight/controllers/rov_controller.h"
 #include "flight/estimators/madgwick.h"
+#include "flight/hal/linux_hal.h"
 #include "flight/receiver/udp_receiver.h"
 #include "flight/telemetry/udp_telemetry.h"
 #include "flight/vehicle/vehicle.h"
 
 int main() {
+  flight::hal::LinuxTime time;
   flight::estimators::MadgwickEstimator estimator;
   flight::controllers::RovController controller(flight::controllers::RovMixConfig{});
-  flight::actuators::BiheliPwmOutput actuators(flight::actuators::BiheliPwmOutput::Config{});
-  flight::receiver::UdpReceiver receiver(flight::receiver::UdpReceiver::Config{});
+  flight::actuators::BiheliPwmOutput pwm(flight::actuators::BiheliPwmOutput::Config{});
+  flight::actuators::ThrustLinearizer linearizer;
+  flight::actuators::LinearizedOutput actuators(&pwm, &linearizer);
+  // One clock for received_us and the actuator write time.
+  flight::receiver::UdpReceiver::Config receiver_config;
+  receiver_config.time = &time;
+  flight::receiver::UdpReceiver receiver(receiver_config);
   flight::telemetry::UdpTelemetrySender telemetry(flight::telemetry::UdpTelemetrySender::Config{});
 
   flight::vehicle::VehicleDependencies deps;
@@ -23,6 +31,7 @@ int main() {
   deps.actuators = &actuators;
   deps.receiver = &receiver;
   deps.telemetry_sink = &telemetry;
+  deps.time = &time;
 
   flight::vehicle::VehicleRegistry registry;
   auto vehicle = registry.Create(flight::vehicle::VehicleType::kRov4Thruster, deps);
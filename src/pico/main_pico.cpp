@@ -10,7 +10,7 @@
 #include "flight/hal/pico_config.h"
 #include "flight/hal/rp2350_pico_hal.h"
 #include "flight/actuators/rp2350_dshot_pio_output.h"
-#include "flight/actuators/rp2350_dshot_telemetry.h"
+#include "flight/actuators/rp2350_dshot_sliced_telemetry.h"
 #include "flight/sensors/mpu6050.h"
 
 int main() {
@@ -42,6 +42,8 @@ int main() {
   }
   dshot_cfg.speed = flight::actuators::Rp2350DshotPioOutput::DshotSpeed::k300;
   dshot_cfg.enable_telemetry = true;
+  // The telemetry receiver below samples the same pins.
+  dshot_cfg.bidirectional = true;
 
   flight::actuators::Rp2350DshotPioOutput dshot(dshot_cfg);
   if (!dshot.Initialize()) {
@@ -50,7 +52,7 @@ int main() {
     printf("DShot init ok (DShot300)\n");
   }
 
-  flight::actuators::Rp2350DshotTelemetryReceiver::Config telem_cfg{};
+  flight::actuators::Rp2350DshotSlicedTelemetryReceiver::Config telem_cfg{};
   telem_cfg.channel_count = flight::hal::PicoConfig::kDshotChannelCount;
   for (uint32_t i = 0; i < flight::hal::PicoConfig::kDshotChannelCount; ++i) {
     telem_cfg.pins[i] = flight::hal::PicoConfig::kDshotPins[i];
@@ -60,7 +62,7 @@ int main() {
   telem_cfg.dshot_khz = 300;
   telem_cfg.samples_per_bit = 10;
 
-  flight::actuators::Rp2350DshotTelemetryReceiver telemetry(telem_cfg);
+  flight::actuators::Rp2350DshotSlicedTelemetryReceiver telemetry(telem_cfg);
   telemetry.Initialize();
 
   uint32_t last_print_us = time_us_32();
@@ -92,13 +94,14 @@ int main() {
       throttle = throttle > 1.0f ? 1.0f : -1.0f;
     }
 
-    const auto frame = telemetry.Read();
-    if (frame) {
-      printf("dshot telem ch%u data=%u raw=%u crc=%u\n",
-             frame->channel,
-             frame->data,
-             frame->raw,
-             frame->crc_ok ? 1 : 0);
+    const auto& table = telemetry.ReadTable();
+    for (uint8_t ch = 0; ch < flight::hal::PicoConfig::kDshotChannelCount; ++ch) {
+      if (table.updated_mask & (1u << ch)) {
+        printf("dshot telem ch%u rpm=%lu crc=%u\n",
+               ch,
+               static_cast<unsigned long>(telemetry.Decoder().Rpm(ch)),
+               table.frames[ch].crc_ok ? 1 : 0);
+      }
     }
 
     sleep_ms(20);
@@ -1,136 +1,159 @@
 /**
  * @file rp2350_dshot_pio_output.cpp
- * @brief RP2350 PIO-based DShot output scaffold.
+ * @brief RP2350 PIO-based DShot output with DMA-fed FIFOs.
  */
 
 #include "flight/actuators/rp2350_dshot_pio_output.h"
 
-#include <algorithm>
 #include <hardware/clocks.h>
+#include <hardware/dma.h>
 #include <hardware/pio.h>
 #include <pico/stdlib.h>
 
 #include "dshot_tx.pio.h"
-#include "flight/actuators/dshot_output.h"
 
 namespace flight::actuators {
 
+Rp2350DshotPioOutput::Rp2350DshotPioOutput() = default;
+
+Rp2350DshotPioOutput::Rp2350DshotPioOutput(const Config& config)
+    : config_(config),
+      encoder_({config.speed, config.min_throttle, config.max_throttle, config.enable_telemetry,
+                config.bidirectional}) {}
+
+static_assert(Rp2350DshotPioOutput::kFrameTicks == kDshotParallelWords * 4,
+              "serial and parallel frames must span the same tick window");
+
 namespace {
 
-constexpr uint8_t kSymbolTicksPerBit = 3;
-constexpr uint8_t kInterFrameTicks = 6;
+const pio_program_t* TxProgram(bool parallel, bool bidirectional) {
+  if (bidirectional) {
+    return parallel ? &dshot_tx_bidir_parallel_program : &dshot_tx_bidir_program;
+  }
+  return parallel ? &dshot_tx_parallel_program : &dshot_tx_program;
+}
 
-inline float Clamp(float value, float min_value, float max_value) {
-  return std::max(min_value, std::min(value, max_value));
+pio_sm_config TxDefaultConfig(bool parallel, bool bidirectional, uint offset) {
+  if (bidirectional) {
+    return parallel ? dshot_tx_bidir_parallel_program_get_default_config(offset)
+                    : dshot_tx_bidir_program_get_default_config(offset);
+  }
+  return parallel ? dshot_tx_parallel_program_get_default_config(offset)
+                  : dshot_tx_program_get_default_config(offset);
 }
 
 }  // namespace
 
-Rp2350DshotPioOutput::Rp2350DshotPioOutput() = default;
-
-Rp2350DshotPioOutput::Rp2350DshotPioOutput(const Config& config) : config_(config) {}
-
 bool Rp2350DshotPioOutput::Initialize() {
-  // TODO: Load PIO program and configure state machine timings for DShot.
-  // This implementation outputs DShot300-compatible waveforms using a simple
-  // 3-tick symbol encoding (110 for '1', 100 for '0').
-  if (config_.channel_count == 0 || config_.channel_count > kMaxChannels) {
+  // Each DShot bit is three PIO ticks (110 for '1', 100 for '0'); the clock
+  // divider sets the tick rate for the configured speed.
+  const uint8_t limit = config_.parallel ? kMaxChannels : kMaxSerialChannels;
+  if (config_.channel_count == 0 || config_.channel_count > limit) {
     return false;
   }
 
   PIO pio = (config_.pio_index == 0) ? pio0 : pio1;
-  const uint offset = pio_add_program(pio, &dshot_tx_program);
-
-  const uint32_t sys_hz = clock_get_hz(clk_sys);
-  const float target_hz = static_cast<float>(static_cast<uint32_t>(config_.speed)) *
-                          static_cast<float>(kSymbolTicksPerBit);
-  const float clkdiv = static_cast<float>(sys_hz) / target_hz;
+  // The bidirectional programs spend two cycles per tick (out + jmp).
+  const float clkdiv = DshotEncoder::ClockDivider(clock_get_hz(clk_sys), config_.speed) /
+                       (config_.bidirectional ? 2.0f : 1.0f);
   if (clkdiv < 1.0f) {
     return false;
   }
 
-  for (uint8_t i = 0; i < config_.channel_count; ++i) {
+  const uint8_t sm_count = config_.parallel ? 1 : config_.channel_count;
+  if (config_.state_machine + sm_count > 4) {
+    return false;
+  }
+  const uint offset = pio_add_program(pio, TxProgram(config_.parallel, config_.bidirectional));
+
+  for (uint8_t i = 0; i < sm_count; ++i) {
     const uint8_t sm = static_cast<uint8_t>(config_.state_machine + i);
-    if (sm >= 4) {
-      return false;
-    }
     active_sms_[i] = sm;
 
+    const uint8_t pin_count = config_.parallel ? config_.channel_count : 1;
     pio_sm_claim(pio, sm);
-    pio_sm_set_consecutive_pindirs(pio, sm, config_.pins[i], 1, true);
+    for (uint8_t p = 0; p < pin_count; ++p) {
+      pio_gpio_init(pio, config_.pins[i] + p);
+      if (config_.bidirectional) {
+        gpio_set_outover(config_.pins[i] + p, GPIO_OVERRIDE_INVERT);
+        gpio_pull_up(config_.pins[i] + p);
+      }
+    }
+    // Bidirectional pins start released; the program drives them per frame.
+    pio_sm_set_consecutive_pindirs(pio, sm, config_.pins[i], pin_count, !config_.bidirectional);
 
-    pio_sm_config cfg = dshot_tx_program_get_default_config(offset);
-    sm_config_set_out_pins(&cfg, config_.pins[i], 1);
+    pio_sm_config cfg = TxDefaultConfig(config_.parallel, config_.bidirectional, offset);
+    sm_config_set_out_pins(&cfg, config_.pins[i], pin_count);
     sm_config_set_out_shift(&cfg, true, true, 32);
     sm_config_set_fifo_join(&cfg, PIO_FIFO_JOIN_TX);
     sm_config_set_clkdiv(&cfg, clkdiv);
-
     pio_sm_init(pio, sm, offset, &cfg);
-    pio_sm_set_enabled(pio, sm, true);
-  }
-
-  return true;
-}
-
-uint16_t Rp2350DshotPioOutput::ValueToThrottle(float value) const {
-  const float clamped = Clamp(value, -1.0f, 1.0f);
-  const float normalized = (clamped + 1.0f) * 0.5f;
-  const float range = static_cast<float>(config_.max_throttle - config_.min_throttle);
-  const float mapped = static_cast<float>(config_.min_throttle) + (normalized * range);
-  return static_cast<uint16_t>(Clamp(mapped,
-                                     static_cast<float>(config_.min_throttle),
-                                     static_cast<float>(config_.max_throttle)));
-}
+    if (config_.bidirectional) {
+      // Park the tick count in ISR, then empty OSR so the first frame word is pulled fresh.
+      pio_sm_put(pio, sm, kFrameTicks - 1);
+      pio_sm_exec(pio, sm, pio_encode_pull(false, true));
+      pio_sm_exec(pio, sm, pio_encode_mov(pio_isr, pio_osr));
+      pio_sm_exec(pio, sm, pio_encode_out(pio_null, 32));
+    }
 
-void Rp2350DshotPioOutput::BuildSymbolWords(uint16_t packet,
-                                            uint32_t* words,
-                                            uint8_t& word_count) const {
-  const uint16_t bits = 16;
-  const uint16_t total_ticks = bits * kSymbolTicksPerBit + kInterFrameTicks;
-  word_count = static_cast<uint8_t>((total_ticks + 31) / 32);
-  for (uint8_t i = 0; i < word_count; ++i) {
-    words[i] = 0;
+    // One DMA channel per state machine, paced by its TX DREQ.
+    const int channel = dma_claim_unused_channel(false);
+    if (channel < 0) {
+      return false;
+    }
+    dma_channels_[i] = channel;
+    dma_mask_ |= 1u << channel;
+
+    dma_channel_config dma_cfg = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&dma_cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&dma_cfg, true);
+    channel_config_set_write_increment(&dma_cfg, false);
+    channel_config_set_dreq(&dma_cfg, pio_get_dreq(pio, sm, true));
+    dma_channel_configure(channel, &dma_cfg, &pio->txf[sm], frame_.words, 0, false);
   }
 
-  uint16_t tick_index = 0;
-  for (int bit = 15; bit >= 0; --bit) {
-    const bool bit_set = (packet >> bit) & 0x1;
-    const uint8_t symbol = bit_set ? 0b110 : 0b100;
-    for (uint8_t s = 0; s < kSymbolTicksPerBit; ++s) {
-      const uint8_t symbol_bit = (symbol >> (kSymbolTicksPerBit - 1 - s)) & 0x1;
-      const uint16_t word = tick_index / 32;
-      const uint16_t bit_in_word = tick_index % 32;
-      if (symbol_bit) {
-        words[word] |= (1u << bit_in_word);
-      }
-      ++tick_index;
-    }
+  uint32_t sm_mask = 0;
+  for (uint8_t i = 0; i < sm_count; ++i) {
+    sm_mask |= 1u << active_sms_[i];
   }
-  // Remaining ticks are already zero to create inter-frame low gap.
+  pio_set_sm_mask_enabled(pio, sm_mask, true);
+  return true;
 }
 
 bool Rp2350DshotPioOutput::Write(const ActuatorCommand* commands, uint8_t count) {
   last_count_ = count > config_.channel_count ? config_.channel_count : count;
-  if (last_count_ == 0) {
-    return true;
+  if (last_count_ == 0 || dma_mask_ == 0) {
+    return last_count_ == 0;
   }
 
-  PIO pio = (config_.pio_index == 0) ? pio0 : pio1;
+  // The frame buffer is only rewritten once DMA has drained the last one.
+  for (uint8_t i = 0; i < kMaxSerialChannels; ++i) {
+    if (dma_channels_[i] >= 0 && dma_channel_is_busy(static_cast<uint>(dma_channels_[i]))) {
+      ++overruns_;
+      return false;
+    }
+  }
 
-  for (uint8_t i = 0; i < last_count_; ++i) {
-    const uint16_t throttle = ValueToThrottle(commands[i].value);
-    const uint16_t packet =
-        DshotOutput::PackCommand(throttle, config_.enable_telemetry);
+  uint16_t packets[kMaxChannels] = {};
+  encoder_.PackAll(commands, last_count_, packets);
+  commands_.Apply(packets, last_count_, config_.bidirectional);
 
-    uint32_t words[2] = {0, 0};
-    uint8_t word_count = 0;
-    BuildSymbolWords(packet, words, word_count);
+  const bool built = config_.parallel
+                         ? frame_.BuildParallel(packets, last_count_, active_sms_[0])
+                         : frame_.BuildSerial(packets, last_count_, active_sms_);
+  if (!built) {
+    return false;
+  }
 
-    const uint8_t sm = active_sms_[i];
-    for (uint8_t w = 0; w < word_count; ++w) {
-      pio_sm_put_blocking(pio, sm, words[w]);
-    }
+  uint32_t start_mask = 0;
+  for (uint8_t t = 0; t < frame_.transfer_count; ++t) {
+    const DshotDmaTransfer& transfer = frame_.transfers[t];
+    const uint channel = static_cast<uint>(dma_channels_[t]);
+    dma_channel_set_read_addr(channel, &frame_.words[transfer.word_offset], false);
+    dma_channel_set_trans_count(channel, transfer.word_count, false);
+    start_mask |= 1u << channel;
   }
+  dma_start_channel_mask(start_mask);
   return true;
 }
 
@@ -0,0 +1,176 @@
+/**
+ * @file rp2350_dshot_sliced_telemetry.cpp
+ * @brief RP2350 all-channel DShot telemetry capture with DMA ring.
+ */
+
+#include "flight/actuators/rp2350_dshot_sliced_telemetry.h"
+
+#include <cstdint>
+
+#include <hardware/clocks.h>
+#include <hardware/dma.h>
+#include <hardware/pio.h>
+#include <pico/stdlib.h>
+
+#include "dshot_telem_rx.pio.h"
+
+namespace flight::actuators {
+
+namespace {
+
+/** @brief Bytes the decoder keeps clear of the DMA writer when judging a lap. */
+constexpr uint32_t kLapMarginBytes = DshotSlicedDecoder::kWindowSamples;
+
+uint32_t BasePin(const uint32_t* pins, uint8_t count) {
+  uint32_t base = pins[0];
+  for (uint8_t i = 1; i < count; ++i) {
+    base = pins[i] < base ? pins[i] : base;
+  }
+  return base;
+}
+
+DshotSlicedDecoder::Config MakeDecoderConfig(const Rp2350DshotSlicedTelemetryReceiver::Config& config) {
+  DshotSlicedDecoder::Config decoder{};
+  decoder.samples_per_bit = config.samples_per_bit;
+  decoder.motor_pole_count = config.motor_pole_count;
+  decoder.channel_count = config.channel_count;
+  if (config.channel_count == 0 || config.channel_count > DshotSlicedDecoder::kLanes) {
+    return decoder;
+  }
+  const uint32_t base = BasePin(config.pins, config.channel_count);
+  for (uint8_t i = 0; i < config.channel_count; ++i) {
+    decoder.lanes[i] = static_cast<uint8_t>(config.pins[i] - base);
+  }
+  return decoder;
+}
+
+}  // namespace
+
+Rp2350DshotSlicedTelemetryReceiver::Rp2350DshotSlicedTelemetryReceiver() = default;
+
+Rp2350DshotSlicedTelemetryReceiver::Rp2350DshotSlicedTelemetryReceiver(const Config& config)
+    : config_(config), decoder_(MakeDecoderConfig(config)) {}
+
+bool Rp2350DshotSlicedTelemetryReceiver::Initialize() {
+  if (config_.channel_count == 0 || config_.channel_count > kMaxChannels) {
+    return false;
+  }
+  if (config_.dshot_khz == 0 || config_.samples_per_bit < 6) {
+    return false;
+  }
+  const uint32_t base = BasePin(config_.pins, config_.channel_count);
+  for (uint8_t i = 0; i < config_.channel_count; ++i) {
+    if (config_.pins[i] - base >= kMaxChannels) {
+      return false;
+    }
+  }
+  // A response plus inter-ESC skew must fit one decode window.
+  const uint32_t response_samples = kDshotResponseBits * 4u * config_.samples_per_bit / 5u;
+  if (response_samples >= DshotSlicedDecoder::kWindowSamples) {
+    return false;
+  }
+
+  PIO pio = (config_.pio_index == 0) ? pio0 : pio1;
+  const uint32_t sample_hz =
+      config_.dshot_khz * 1000u * static_cast<uint32_t>(config_.samples_per_bit);
+  const float clkdiv = static_cast<float>(clock_get_hz(clk_sys)) / static_cast<float>(sample_hz);
+  if (clkdiv < 1.0f || config_.state_machine >= 4) {
+    return false;
+  }
+
+  const uint offset = pio_add_program(pio, &dshot_telem_rx_parallel_program);
+  const uint sm = config_.state_machine;
+  pio_sm_claim(pio, sm);
+  // Only the DShot pins are touched; other pins in the window keep their function.
+  for (uint8_t i = 0; i < config_.channel_count; ++i) {
+    pio_sm_set_consecutive_pindirs(pio, sm, config_.pins[i], 1, false);
+  }
+
+  pio_sm_config cfg = dshot_telem_rx_parallel_program_get_default_config(offset);
+  sm_config_set_in_pins(&cfg, base);
+  sm_config_set_in_shift(&cfg, true, true, 32);
+  sm_config_set_fifo_join(&cfg, PIO_FIFO_JOIN_RX);
+  sm_config_set_clkdiv(&cfg, clkdiv);
+  pio_sm_init(pio, sm, offset, &cfg);
+
+  dma_channel_ = dma_claim_unused_channel(false);
+  if (dma_channel_ < 0) {
+    return false;
+  }
+  dma_channel_config dma_cfg = dma_channel_get_default_config(static_cast<uint>(dma_channel_));
+  channel_config_set_transfer_data_size(&dma_cfg, DMA_SIZE_32);
+  channel_config_set_read_increment(&dma_cfg, false);
+  channel_config_set_write_increment(&dma_cfg, true);
+  channel_config_set_ring(&dma_cfg, true, kRingBits);
+  channel_config_set_dreq(&dma_cfg, pio_get_dreq(pio, sm, false));
+  dma_channel_configure(static_cast<uint>(dma_channel_), &dma_cfg, ring_, &pio->rxf[sm],
+                        dma_encode_endless_transfer_count(), true);
+
+  pio_sm_set_enabled(pio, sm, true);
+  read_index_ = 0;
+  last_write_index_ = 0;
+  last_refresh_us_ = time_us_64();
+  sample_hz_ = sample_hz;
+  initialized_ = true;
+  return true;
+}
+
+void Rp2350DshotSlicedTelemetryReceiver::Refresh() {
+  const uintptr_t write_addr = dma_channel_hw_addr(static_cast<uint>(dma_channel_))->write_addr;
+  const uint16_t write_index =
+      static_cast<uint16_t>((write_addr - reinterpret_cast<uintptr_t>(ring_)) & (kRingBytes - 1));
+  const uint64_t now_us = time_us_64();
+  const uint32_t backlog = static_cast<uint32_t>((last_write_index_ - read_index_) & (kRingBytes - 1));
+  const uint64_t written = (now_us - last_refresh_us_) * sample_hz_ / 1000000u;
+  last_refresh_us_ = now_us;
+  last_write_index_ = write_index;
+  if (backlog + written + kLapMarginBytes >= kRingBytes) {
+    // The writer lapped the unread samples; keep only the newest half ring,
+    // which it will not reach again for another half period.
+    read_index_ = static_cast<uint16_t>((write_index - kRingBytes / 2) & (kRingBytes - 1));
+    decoder_.Resync();
+    ++overruns_;
+  }
+  table_.updated_mask = 0;
+  read_index_ = decoder_.Process(ring_, kRingBytes, read_index_, write_index, table_);
+  pending_mask_ = static_cast<uint8_t>(pending_mask_ | table_.updated_mask);
+}
+
+const DshotTelemetryTable& Rp2350DshotSlicedTelemetryReceiver::ReadTable() {
+  if (initialized_) {
+    Refresh();
+    pending_mask_ = 0;
+  }
+  return table_;
+}
+
+std::optional<DshotTelemetryFrame> Rp2350DshotSlicedTelemetryReceiver::Read() {
+  if (!initialized_) {
+    return std::nullopt;
+  }
+  if (pending_mask_ == 0) {
+    Refresh();
+  }
+  if (pending_mask_ == 0) {
+    return std::nullopt;
+  }
+  const uint8_t channel = static_cast<uint8_t>(__builtin_ctz(pending_mask_));
+  pending_mask_ = static_cast<uint8_t>(pending_mask_ & (pending_mask_ - 1));
+  return table_.frames[channel];
+}
+
+size_t Rp2350DshotSlicedTelemetryReceiver::ReadBatch(DshotTelemetryFrame* out, size_t capacity) {
+  if (!initialized_) {
+    return 0;
+  }
+  Refresh();
+  size_t count = 0;
+  while (pending_mask_ != 0 && count < capacity) {
+    const uint8_t channel = static_cast<uint8_t>(__builtin_ctz(pending_mask_));
+    pending_mask_ = static_cast<uint8_t>(pending_mask_ & (pending_mask_ - 1));
+    out[count++] = table_.frames[channel];
+  }
+  return count;
+}
+
+}  // namespace flight::actuators
@@ -1,6 +1,6 @@
 /**
  * @file rp2350_dshot_telemetry.cpp
- * @brief RP2350 DShot telemetry receiver scaffold.
+ * @brief RP2350 bidirectional DShot telemetry receiver.
  */
 
 #include "flight/actuators/rp2350_dshot_telemetry.h"
@@ -16,7 +16,7 @@ namespace flight::actuators {
 Rp2350DshotTelemetryReceiver::Rp2350DshotTelemetryReceiver() = default;
 
 Rp2350DshotTelemetryReceiver::Rp2350DshotTelemetryReceiver(const Config& config)
-    : config_(config) {}
+    : config_(config), decoder_({config.samples_per_bit, config.motor_pole_count}) {}
 
 bool Rp2350DshotTelemetryReceiver::Initialize() {
   if (config_.channel_count == 0 || config_.channel_count > 4) {
@@ -25,6 +25,17 @@ bool Rp2350DshotTelemetryReceiver::Initialize() {
   if (config_.dshot_khz == 0 || config_.samples_per_bit < 6) {
     return false;
   }
+  // A response must fit in the capture buffer after up to one word of idle.
+  const uint32_t response_samples = kDshotResponseBits * 4u * config_.samples_per_bit / 5u;
+  if (response_samples + 32u > kCaptureWords * 32u) {
+    return false;
+  }
+
+  // The 16-bit command frame can start anywhere in its first word.
+  const uint32_t command_samples = 16u * config_.samples_per_bit;
+  command_words_ = static_cast<uint8_t>((command_samples + 62u) / 32u);
+  const uint32_t timeout_samples = static_cast<uint32_t>(config_.response_timeout_bits) * config_.samples_per_bit;
+  timeout_words_ = static_cast<uint8_t>((timeout_samples + 31u) / 32u);
 
   PIO pio = (config_.pio_index == 0) ? pio0 : pio1;
   const uint offset = pio_add_program(pio, &dshot_telem_rx_program);
@@ -58,10 +69,7 @@ bool Rp2350DshotTelemetryReceiver::Initialize() {
   }
 
   for (uint8_t i = 0; i < config_.channel_count; ++i) {
-    sample_count_[i] = 0;
-    for (uint8_t w = 0; w < 6; ++w) {
-      sample_words_[i][w] = 0;
-    }
+    ResetChannel(i);
   }
 
   initialized_ = true;
@@ -73,70 +81,79 @@ std::optional<DshotTelemetryFrame> Rp2350DshotTelemetryReceiver::Read() {
     return std::nullopt;
   }
 
-  PIO pio = (config_.pio_index == 0) ? pio0 : pio1;
   for (uint8_t i = 0; i < config_.channel_count; ++i) {
-    const uint8_t sm = active_sms_[i];
-    while (!pio_sm_is_rx_fifo_empty(pio, sm)) {
-      const uint32_t sample = pio_sm_get_blocking(pio, sm);
-      const uint8_t word_index = static_cast<uint8_t>(sample_count_[i] / 32);
-      if (word_index < 6) {
-        sample_words_[i][word_index] = sample;
-      }
-      sample_count_[i] += 32;
-      const uint16_t needed_samples =
-          static_cast<uint16_t>(16u * config_.samples_per_bit);
-      if (sample_count_[i] >= needed_samples) {
-        DshotTelemetryFrame frame{};
-        if (DecodeFrame(i, frame)) {
-          sample_count_[i] = 0;
-          for (uint8_t w = 0; w < 6; ++w) {
-            sample_words_[i][w] = 0;
-          }
-          return frame;
-        }
-        sample_count_[i] = 0;
-        for (uint8_t w = 0; w < 6; ++w) {
-          sample_words_[i][w] = 0;
-        }
-        break;
-      }
+    DshotTelemetryFrame frame{};
+    if (PollChannel(i, frame)) {
+      return frame;
     }
   }
   return std::nullopt;
 }
 
-bool Rp2350DshotTelemetryReceiver::DecodeFrame(uint8_t channel,
-                                               DshotTelemetryFrame& frame) {
-  const uint8_t samples_per_bit = config_.samples_per_bit;
-  const uint16_t bits = 16;
-  const uint16_t total_samples = bits * samples_per_bit;
-  if (total_samples > 192) {
-    return false;
+size_t Rp2350DshotTelemetryReceiver::ReadBatch(DshotTelemetryFrame* out, size_t capacity) {
+  if (!initialized_) {
+    return 0;
   }
 
-  uint16_t raw = 0;
-  for (uint16_t bit = 0; bit < bits; ++bit) {
-    uint16_t ones = 0;
-    for (uint8_t s = 0; s < samples_per_bit; ++s) {
-      const uint16_t sample_index = bit * samples_per_bit + s;
-      const uint16_t word = sample_index / 32;
-      const uint16_t bit_in_word = sample_index % 32;
-      const bool sample = (sample_words_[channel][word] >> bit_in_word) & 0x1;
-      ones += sample ? 1 : 0;
+  size_t count = 0;
+  for (uint8_t i = 0; i < config_.channel_count && count < capacity; ++i) {
+    if (PollChannel(i, out[count])) {
+      ++count;
     }
-    const bool bit_set = ones >= (samples_per_bit / 2 + 1);
-    raw = static_cast<uint16_t>((raw << 1) | (bit_set ? 1 : 0));
   }
+  return count;
+}
 
-  frame.channel = channel;
-  frame.raw = raw;
-  const uint16_t data = static_cast<uint16_t>(raw >> 4);
-  const uint16_t crc = static_cast<uint16_t>(raw & 0xF);
-  const uint16_t expected_crc =
-      static_cast<uint16_t>((data ^ (data >> 4) ^ (data >> 8)) & 0xF);
-  frame.data = data;
-  frame.crc_ok = crc == expected_crc;
-  return true;
+void Rp2350DshotTelemetryReceiver::ResetChannel(uint8_t channel) {
+  sample_count_[channel] = 0;
+  gate_[channel] = Gate::kAwaitCommand;
+  gate_words_[channel] = 0;
+  for (uint8_t w = 0; w < kCaptureWords; ++w) {
+    sample_words_[channel][w] = 0;
+  }
+}
+
+/** @brief Drain one channel's RX FIFO; true once a full response is decoded. */
+bool Rp2350DshotTelemetryReceiver::PollChannel(uint8_t channel, DshotTelemetryFrame& frame) {
+  PIO pio = (config_.pio_index == 0) ? pio0 : pio1;
+  const uint8_t sm = active_sms_[channel];
+  while (!pio_sm_is_rx_fifo_empty(pio, sm)) {
+    const uint32_t sample = pio_sm_get_blocking(pio, sm);
+    const bool idle = sample == 0xFFFFFFFFu;
+    if (gate_[channel] == Gate::kAwaitCommand) {
+      // The host's own command frame comes first; skip all of it.
+      if (!idle) {
+        gate_[channel] = Gate::kSkipCommand;
+        gate_words_[channel] = 1;
+      }
+      continue;
+    }
+    if (gate_[channel] == Gate::kSkipCommand) {
+      if (++gate_words_[channel] >= command_words_) {
+        gate_[channel] = Gate::kAwaitResponse;
+        gate_words_[channel] = 0;
+      }
+      continue;
+    }
+    // Idle line words are dropped until the start bit shows up.
+    if (sample_count_[channel] == 0 && idle) {
+      if (++gate_words_[channel] >= timeout_words_) {
+        // No answer to this command; not a decode error.
+        ++missed_responses_;
+        ResetChannel(channel);
+      }
+      continue;
+    }
+    sample_words_[channel][sample_count_[channel] / 32] = sample;
+    sample_count_[channel] = static_cast<uint16_t>(sample_count_[channel] + 32);
+    if (sample_count_[channel] >= kCaptureWords * 32) {
+      const bool decoded =
+          decoder_.Decode(channel, sample_words_[channel], sample_count_[channel], frame);
+      ResetChannel(channel);
+      return decoded;
+    }
+  }
+  return false;
 }
 
 }  // namespace flight::actuators
@@ -0,0 +1,156 @@
+/**
+ * @file arbitrated_receiver.cpp
+ * @brief Multi-link command arbitration.
+ */
+
+#include "flight/receiver/arbitrated_receiver.h"
+
+namespace flight::receiver {
+
+/** @brief Construct with configuration. */
+ArbitratedReceiver::ArbitratedReceiver(const Config& config) : config_(config) {
+  if (config_.link_count > kMaxLinks) {
+    config_.link_count = kMaxLinks;
+  }
+}
+
+bool ArbitratedReceiver::Initialize() {
+  bool any = false;
+  for (size_t i = 0; i < config_.link_count; ++i) {
+    status_[i] = LinkStatus{};
+    status_[i].initialized = config_.links[i] && config_.links[i]->Initialize();
+    any = any || status_[i].initialized;
+  }
+  active_ = -1;
+  any_frame_ = false;
+  switches_ = 0;
+  return any && config_.time != nullptr;
+}
+
+/** @brief Drain one link and update its freshness, interval and quality. */
+void ArbitratedReceiver::Poll(size_t link, uint64_t now_us, bool& updated) {
+  LinkStatus& status = status_[link];
+  updated = false;
+  if (!status.initialized) {
+    return;
+  }
+  CommandFrame frames[kPollBatch];
+  const size_t count = config_.links[link]->ReadBatch(frames, kPollBatch);
+  // Links stamp received_us on their own clocks, so arrival is the poll time
+  // on Config::time. Frames since the previous poll share one interval sample.
+  const bool had_frame = status.has_frame;
+  uint32_t intervals = 0;
+  for (size_t i = 0; i < count; ++i) {
+    const CommandFrame& frame = frames[i];
+    uint32_t gap = 1;
+    if (status.has_frame) {
+      const uint32_t delta = frame.sequence - status.last.sequence;
+      // Sequences of 0 (unknown) and reorders count as no gap.
+      gap = frame.sequence != 0 && delta > 0 && delta < 0x8000u ? delta : 1;
+      status.lost += gap - 1;
+      intervals += gap;
+    }
+    status.quality += config_.alpha * (1.0f / static_cast<float>(gap) - status.quality);
+    status.has_frame = true;
+    status.last = frame;
+    ++status.frames;
+    ++status.streak;
+    updated = true;
+  }
+  if (updated) {
+    if (had_frame && intervals > 0) {
+      // Dividing by the sequence span keeps drops and batching from skewing the estimate.
+      const float interval =
+          static_cast<float>(now_us - status.last_us) / static_cast<float>(intervals);
+      status.interval_us = status.interval_us == 0.0f
+                               ? interval
+                               : status.interval_us + config_.alpha * (interval - status.interval_us);
+    }
+    status.last_us = now_us;
+  }
+
+  if (!status.has_frame) {
+    status.fresh = false;
+    return;
+  }
+  float limit_us = static_cast<float>(config_.timeout_us);
+  if (status.interval_us > 0.0f && status.interval_us * config_.missed_frames < limit_us) {
+    limit_us = status.interval_us * config_.missed_frames;
+  }
+  status.fresh = static_cast<float>(now_us - status.last_us) <= limit_us;
+  if (!status.fresh) {
+    status.streak = 0;
+  }
+}
+
+bool ArbitratedReceiver::Usable(size_t link, bool require_quality) const {
+  const LinkStatus& status = status_[link];
+  if (!status.fresh || status.last.failsafe) {
+    return false;
+  }
+  if (require_quality && status.quality < config_.min_quality) {
+    return false;
+  }
+  // A link coming back must prove itself before it takes over again.
+  return static_cast<int>(link) == active_ || active_ < 0 ||
+         status.streak >= config_.recovery_frames || !Usable(static_cast<size_t>(active_), false);
+}
+
+int ArbitratedReceiver::Select() const {
+  for (size_t i = 0; i < config_.link_count; ++i) {
+    if (Usable(i, true)) {
+      return static_cast<int>(i);
+    }
+  }
+  for (size_t i = 0; i < config_.link_count; ++i) {
+    if (Usable(i, false)) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+std::optional<CommandFrame> ArbitratedReceiver::Read() {
+  if (!config_.time) {
+    return std::nullopt;
+  }
+  const uint64_t now_us = config_.time->NowUs();
+  bool updated[kMaxLinks] = {false};
+  for (size_t i = 0; i < config_.link_count; ++i) {
+    Poll(i, now_us, updated[i]);
+    any_frame_ = any_frame_ || status_[i].has_frame;
+  }
+
+  const int selected = Select();
+  const bool switched = selected != active_;
+  if (switched) {
+    ++switches_;
+    active_ = selected;
+  }
+  if (selected < 0) {
+    if (!any_frame_) {
+      return std::nullopt;
+    }
+    CommandFrame failsafe{};
+    failsafe.failsafe = true;
+    return failsafe;
+  }
+  if (!switched && !updated[selected]) {
+    return std::nullopt;
+  }
+  return status_[selected].last;
+}
+
+size_t ArbitratedReceiver::ReadBatch(CommandFrame* out, size_t capacity) {
+  if (capacity == 0) {
+    return 0;
+  }
+  auto frame = Read();
+  if (!frame) {
+    return 0;
+  }
+  out[0] = *frame;
+  return 1;
+}
+
+}  // namespace flight::receiver
@@ -0,0 +1,216 @@
+/**
+ * @file command_protocol.cpp
+ * @brief Command packet versions and the clock-offset exchange.
+ */
+
+#include "flight/receiver/command_protocol.h"
+
+#include <cstring>
+
+namespace flight::receiver {
+
+namespace {
+
+constexpr size_t kHeaderBytes = 6;
+constexpr float kChannelScale = 32767.0f;
+
+struct Crc16Table {
+  uint16_t entry[256];
+};
+
+constexpr Crc16Table MakeCrc16Table() {
+  Crc16Table table{};
+  for (uint32_t i = 0; i < 256; ++i) {
+    uint32_t crc = i << 8;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc & 0x8000u) ? (crc << 1) ^ 0x1021u : crc << 1;
+    }
+    table.entry[i] = static_cast<uint16_t>(crc);
+  }
+  return table;
+}
+
+constexpr Crc16Table kCrc16Table = MakeCrc16Table();
+
+uint32_t BitCount(uint32_t mask) {
+  uint32_t count = 0;
+  for (uint32_t i = 0; i < 16; ++i) {
+    count += (mask >> i) & 1u;
+  }
+  return count;
+}
+
+template <typename Packet>
+void CopyChannels(const Packet& packet, CommandFrame& frame) {
+  frame.channel_count = packet.channel_count > 16 ? 16 : packet.channel_count;
+  for (uint8_t i = 0; i < frame.channel_count; ++i) {
+    frame.channels[i] = packet.channels[i];
+  }
+}
+
+/** @brief v3: validate length, mask and CRC, then expand the sent channels. */
+bool DecodeCompact(const uint8_t* bytes, size_t length, CommandFrame& frame) {
+  if (length < kCompactHeaderBytes + 2 || length > kMaxCompactCommandPacket) {
+    return false;
+  }
+  CompactCommandHeader header{};
+  std::memcpy(static_cast<void*>(&header), bytes, kCompactHeaderBytes);
+  if (header.channel_count > 16) {
+    return false;
+  }
+  const uint32_t allowed = (1u << header.channel_count) - 1u;
+  const uint32_t sent = BitCount(header.channel_mask);
+  if ((header.channel_mask & ~allowed) != 0 ||
+      length != kCompactHeaderBytes + sent * sizeof(int16_t) + 2) {
+    return false;
+  }
+  uint16_t crc = 0;
+  std::memcpy(&crc, bytes + length - 2, sizeof(crc));
+  if (crc != Crc16Ccitt(bytes, length - 2)) {
+    return false;
+  }
+
+  // One spare zero slot so the unconditional load below stays in bounds.
+  int16_t values[17] = {0};
+  std::memcpy(values, bytes + kCompactHeaderBytes, sent * sizeof(int16_t));
+  frame = CommandFrame{};
+  frame.channel_count = header.channel_count;
+  frame.sequence = header.sequence;
+  frame.sent_us = header.sent_us;
+  uint32_t next = 0;
+  for (uint32_t i = 0; i < 16; ++i) {
+    const uint32_t present = (header.channel_mask >> i) & 1u;
+    const float value = static_cast<float>(values[next]) * (1.0f / kChannelScale);
+    frame.channels[i] = present ? value : 0.0f;
+    next += present;
+  }
+  return true;
+}
+
+}  // namespace
+
+bool DecodeCommandPacket(const void* data, size_t length, CommandFrame& frame) {
+  if (length < kHeaderBytes) {
+    return false;
+  }
+  uint32_t magic = 0;
+  std::memcpy(&magic, data, sizeof(magic));
+  const uint8_t version = static_cast<const uint8_t*>(data)[4];
+  if (magic != kCommandMagic) {
+    return false;
+  }
+
+  if (version == 1) {
+    CommandPacketV1 packet{};
+    if (length < offsetof(CommandPacketV1, channels)) {
+      return false;
+    }
+    std::memcpy(&packet, data, length < sizeof(packet) ? length : sizeof(packet));
+    frame = CommandFrame{};
+    CopyChannels(packet, frame);
+    return true;
+  }
+  if (version == 2) {
+    CommandPacketV2 packet{};
+    if (length < offsetof(CommandPacketV2, channels)) {
+      return false;
+    }
+    std::memcpy(&packet, data, length < sizeof(packet) ? length : sizeof(packet));
+    frame = CommandFrame{};
+    CopyChannels(packet, frame);
+    frame.sequence = packet.sequence;
+    frame.sent_us = packet.sent_us;
+    return true;
+  }
+  if (version == 3) {
+    return DecodeCompact(static_cast<const uint8_t*>(data), length, frame);
+  }
+  return false;
+}
+
+CommandPacketV2 EncodeCommandPacket(const CommandFrame& frame) {
+  CommandPacketV2 packet{};
+  packet.channel_count = frame.channel_count > 16 ? 16 : frame.channel_count;
+  packet.sequence = frame.sequence;
+  packet.sent_us = frame.sent_us;
+  for (uint8_t i = 0; i < packet.channel_count; ++i) {
+    packet.channels[i] = frame.channels[i];
+  }
+  return packet;
+}
+
+size_t EncodeCompactCommandPacket(const CommandFrame& frame, void* out, size_t capacity) {
+  CompactCommandHeader header{};
+  header.channel_count = frame.channel_count > 16 ? 16 : frame.channel_count;
+  header.sequence = frame.sequence;
+  header.sent_us = frame.sent_us;
+
+  int16_t values[16] = {0};
+  uint32_t sent = 0;
+  for (uint8_t i = 0; i < header.channel_count; ++i) {
+    const int16_t value = QuantizeChannel(frame.channels[i]);
+    if (value != 0) {
+      header.channel_mask = static_cast<uint16_t>(header.channel_mask | (1u << i));
+      values[sent++] = value;
+    }
+  }
+
+  const size_t length = kCompactHeaderBytes + sent * sizeof(int16_t) + 2;
+  if (capacity < length) {
+    return 0;
+  }
+  uint8_t* bytes = static_cast<uint8_t*>(out);
+  std::memcpy(bytes, &header, kCompactHeaderBytes);
+  std::memcpy(bytes + kCompactHeaderBytes, values, sent * sizeof(int16_t));
+  const uint16_t crc = Crc16Ccitt(bytes, length - 2);
+  std::memcpy(bytes + length - 2, &crc, sizeof(crc));
+  return length;
+}
+
+int16_t QuantizeChannel(float value) {
+  if (!(value == value)) {
+    return 0;
+  }
+  const float clamped = value > 1.0f ? 1.0f : (value < -1.0f ? -1.0f : value);
+  const float scaled = clamped * kChannelScale;
+  return static_cast<int16_t>(scaled + (scaled >= 0.0f ? 0.5f : -0.5f));
+}
+
+uint16_t Crc16Ccitt(const void* data, size_t length) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < length; ++i) {
+    crc = static_cast<uint16_t>((crc << 8) ^ kCrc16Table.entry[((crc >> 8) ^ bytes[i]) & 0xFF]);
+  }
+  return crc;
+}
+
+bool DecodeTimeSyncRequest(const void* data, size_t length, TimeSyncPacket& request) {
+  if (length < sizeof(TimeSyncPacket)) {
+    return false;
+  }
+  std::memcpy(&request, data, sizeof(request));
+  return request.magic == kTimeSyncMagic && request.version == 1 &&
+         request.kind == TimeSyncPacket::kRequest;
+}
+
+TimeSyncPacket MakeTimeSyncReply(const TimeSyncPacket& request, uint64_t t1_us, uint64_t t2_us) {
+  TimeSyncPacket reply = request;
+  reply.kind = TimeSyncPacket::kReply;
+  reply.t1_us = t1_us;
+  reply.t2_us = t2_us;
+  return reply;
+}
+
+ClockOffsetSample EstimateClockOffset(const TimeSyncPacket& reply, uint64_t t3_us) {
+  const int64_t t0 = static_cast<int64_t>(reply.t0_us);
+  const int64_t t1 = static_cast<int64_t>(reply.t1_us);
+  const int64_t t2 = static_cast<int64_t>(reply.t2_us);
+  const int64_t t3 = static_cast<int64_t>(t3_us);
+  ClockOffsetSample sample;
+  sample.offset_us = ((t1 - t0) + (t2 - t3)) / 2;
+  sample.round_trip_us = (t3 - t0) - (t2 - t1);
+  return sample;
+}
+
+}  // namespace flight::receiver
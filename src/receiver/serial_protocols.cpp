@@ -0,0 +1,158 @@
+/**
+ * @file serial_protocols.cpp
+ * @brief CRSF and SBUS byte-stream parsers.
+ */
+
+#include "flight/receiver/serial_protocols.h"
+
+namespace flight::receiver {
+
+namespace {
+
+constexpr size_t kPackedChannelBytes = 22;
+constexpr uint8_t kCrsfSyncFc = 0xC8;
+constexpr uint8_t kCrsfSyncRadio = 0xEA;
+constexpr uint8_t kCrsfSyncReceiver = 0xEC;
+constexpr uint8_t kCrsfSyncTransmitter = 0xEE;
+
+struct Crc8Table {
+  uint8_t entry[256];
+};
+
+constexpr Crc8Table MakeCrc8Table() {
+  Crc8Table table{};
+  for (uint32_t i = 0; i < 256; ++i) {
+    uint32_t crc = i;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc & 0x80u) ? (crc << 1) ^ 0xD5u : crc << 1;
+    }
+    table.entry[i] = static_cast<uint8_t>(crc);
+  }
+  return table;
+}
+
+constexpr Crc8Table kCrc8Table = MakeCrc8Table();
+
+bool IsCrsfSync(uint8_t byte) {
+  return byte == kCrsfSyncFc || byte == kCrsfSyncRadio || byte == kCrsfSyncReceiver ||
+         byte == kCrsfSyncTransmitter;
+}
+
+void FillChannels(const uint8_t* packed, CommandFrame& frame) {
+  uint16_t raw[16];
+  UnpackRcChannels(packed, raw);
+  frame = CommandFrame{};
+  frame.channel_count = 16;
+  for (size_t i = 0; i < 16; ++i) {
+    frame.channels[i] = NormalizeRcChannel(raw[i]);
+  }
+}
+
+}  // namespace
+
+uint8_t Crc8DvbS2(const uint8_t* data, size_t length) {
+  uint8_t crc = 0;
+  for (size_t i = 0; i < length; ++i) {
+    crc = kCrc8Table.entry[crc ^ data[i]];
+  }
+  return crc;
+}
+
+void UnpackRcChannels(const uint8_t* packed, uint16_t* raw) {
+  uint32_t bits = 0;
+  uint32_t available = 0;
+  size_t next = 0;
+  for (size_t i = 0; i < 16; ++i) {
+    while (available < 11) {
+      bits |= static_cast<uint32_t>(packed[next++]) << available;
+      available += 8;
+    }
+    raw[i] = static_cast<uint16_t>(bits & 0x7FFu);
+    bits >>= 11;
+    available -= 11;
+  }
+}
+
+float NormalizeRcChannel(uint16_t raw) {
+  const float value = (static_cast<float>(raw) - 992.0f) * (1.0f / 819.5f);
+  return value > 1.0f ? 1.0f : (value < -1.0f ? -1.0f : value);
+}
+
+bool CrsfParser::Push(uint8_t byte, CommandFrame& frame) {
+  ring_.Push(byte);
+  for (;;) {
+    if (ring_.Size() == 0) {
+      return false;
+    }
+    if (!IsCrsfSync(ring_[0])) {
+      ++stats_.discarded_bytes;
+      ring_.Drop(1);
+      continue;
+    }
+    if (ring_.Size() < 2) {
+      return false;
+    }
+    const size_t declared = ring_[1];
+    if (declared < 2 || declared > kMaxFrame - 2) {
+      ++stats_.discarded_bytes;
+      ring_.Drop(1);
+      continue;
+    }
+    const size_t total = declared + 2;
+    if (ring_.Size() < total) {
+      return false;
+    }
+    uint8_t bytes[kMaxFrame];
+    ring_.Copy(0, total, bytes);
+    if (Crc8DvbS2(bytes + 2, declared - 1) != bytes[total - 1]) {
+      ++stats_.errors;
+      ring_.Drop(1);
+      continue;
+    }
+    const bool channels = bytes[2] == kRcChannelsPacked && declared == kPackedChannelBytes + 2;
+    if (channels) {
+      FillChannels(bytes + 3, frame);
+      ++stats_.frames;
+    } else {
+      ++stats_.other_frames;
+    }
+    ring_.Drop(total);
+    if (channels) {
+      return true;
+    }
+  }
+}
+
+bool SbusParser::Push(uint8_t byte, CommandFrame& frame) {
+  ring_.Push(byte);
+  for (;;) {
+    if (ring_.Size() == 0) {
+      return false;
+    }
+    if (ring_[0] != kHeader) {
+      ++stats_.discarded_bytes;
+      ring_.Drop(1);
+      continue;
+    }
+    if (ring_.Size() < kFrameBytes) {
+      return false;
+    }
+    const uint8_t end = ring_[kFrameBytes - 1];
+    if (end != 0x00 && (end & 0x0F) != 0x04) {
+      ++stats_.errors;
+      ring_.Drop(1);
+      continue;
+    }
+    uint8_t bytes[kFrameBytes];
+    ring_.Copy(0, kFrameBytes, bytes);
+    const uint8_t flags = bytes[kFrameBytes - 2];
+    FillChannels(bytes + 1, frame);
+    frame.failsafe = (flags & kFlagFailsafe) != 0;
+    lost_frames_ += (flags & kFlagFrameLost) ? 1 : 0;
+    ++stats_.frames;
+    ring_.Drop(kFrameBytes);
+    return true;
+  }
+}
+
+}  // namespace flight::receiver
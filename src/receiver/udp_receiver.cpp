@@ -5,13 +5,19 @@
 
 #include "flight/receiver/udp_receiver.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstring>
 
+#include "flight/hal/linux_hal.h"
+#include "flight/receiver/command_protocol.h"
+
 #if defined(__linux__)
 #include <arpa/inet.h>
 #include <fcntl.h>
 #include <netinet/in.h>
 #include <sys/socket.h>
+#include <time.h>
 #include <unistd.h>
 #endif
 
@@ -19,13 +25,25 @@ namespace flight::receiver {
 
 namespace {
 
-/** @brief Packed UDP command payload. */
-struct UdpPacket {
-  uint32_t magic = 0x4D465454;  // "MFTT"
-  uint8_t version = 1;
-  uint8_t channel_count = 0;
-  float channels[16] = {0};
-};
+#if defined(__linux__)
+int64_t ClockNs(clockid_t clock) {
+  timespec now{};
+  clock_gettime(clock, &now);
+  return static_cast<int64_t>(now.tv_sec) * 1000000000 + now.tv_nsec;
+}
+
+/** @brief Kernel receive time (CLOCK_REALTIME) from SO_TIMESTAMPNS, or 0 if absent. */
+int64_t ReceiveTimeNs(msghdr& header) {
+  for (cmsghdr* cmsg = CMSG_FIRSTHDR(&header); cmsg; cmsg = CMSG_NXTHDR(&header, cmsg)) {
+    if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS) {
+      timespec stamp{};
+      std::memcpy(&stamp, CMSG_DATA(cmsg), sizeof(stamp));
+      return static_cast<int64_t>(stamp.tv_sec) * 1000000000 + stamp.tv_nsec;
+    }
+  }
+  return 0;
+}
+#endif
 
 }  // namespace
 
@@ -53,37 +71,140 @@ bool UdpReceiver::Initialize() {
 
   int flags = fcntl(socket_fd_, F_GETFL, 0);
   fcntl(socket_fd_, F_SETFL, flags | O_NONBLOCK);
+  // Kernel receive timestamps give the age of each command.
+  const int enable = 1;
+  setsockopt(socket_fd_, SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable));
+  have_sequence_ = false;
+  last_sequence_ = 0;
+  last_accept_us_ = 0;
+  last_drain_ = {};
+  total_dropped_ = 0;
   return true;
 #else
   return false;
 #endif
 }
 
-/** @brief Read next command frame if available. */
-std::optional<CommandFrame> UdpReceiver::Read() {
-#if defined(__linux__)
-  if (socket_fd_ < 0) {
-    return std::nullopt;
+/** @brief Vehicle clock: the configured ITime, else hal::LinuxTime. */
+uint64_t UdpReceiver::NowUs() const {
+  if (config_.time) {
+    return config_.time->NowUs();
   }
+  return hal::LinuxTime{}.NowUs();
+}
 
-  UdpPacket packet{};
-  ssize_t received = ::recv(socket_fd_, &packet, sizeof(packet), 0);
-  if (received <= 0) {
-    return std::nullopt;
+/** @brief Newer sequences pass; older ones only after a restart-sized jump or a stale link. */
+bool UdpReceiver::AcceptSequence(uint32_t sequence, uint64_t now_us) {
+  if (!have_sequence_ || IsNewerSequence(sequence, last_sequence_)) {
+    return true;
   }
-  if (packet.magic != 0x4D465454 || packet.version != 1) {
-    return std::nullopt;
+  const bool restarted = last_sequence_ - sequence > kSequenceResyncWindow;
+  const bool stale = now_us - last_accept_us_ > config_.resync_timeout_us;
+  if (restarted || stale) {
+    ++last_drain_.resyncs;
+    return true;
   }
+  ++last_drain_.out_of_order;
+  return false;
+}
 
+/** @brief Drain the socket and return the newest frame. */
+std::optional<CommandFrame> UdpReceiver::Read() {
   CommandFrame frame{};
-  frame.channel_count = packet.channel_count > 16 ? 16 : packet.channel_count;
-  for (uint8_t i = 0; i < frame.channel_count; ++i) {
-    frame.channels[i] = packet.channels[i];
+  if (ReadBatch(&frame, 1) == 0) {
+    return std::nullopt;
   }
-  frame.failsafe = false;
   return frame;
+}
+
+/** @brief Drain the socket with recvmmsg(), keeping the newest @p capacity frames. */
+size_t UdpReceiver::ReadBatch(CommandFrame* out, size_t capacity) {
+  last_drain_ = {};
+#if defined(__linux__)
+  if (socket_fd_ < 0 || capacity == 0) {
+    return 0;
+  }
+
+  alignas(8) uint8_t buffers[kBatch][kMaxCommandDatagram];
+  sockaddr_in sources[kBatch];
+  iovec iov[kBatch];
+  mmsghdr messages[kBatch];
+  alignas(cmsghdr) char control[kBatch][CMSG_SPACE(sizeof(timespec))];
+
+  // `out` is used as a ring of the newest frames and put in order at the end.
+  size_t stored = 0;
+  size_t head = 0;
+  uint32_t valid = 0;
+  for (;;) {
+    for (size_t i = 0; i < kBatch; ++i) {
+      iov[i] = {buffers[i], sizeof(buffers[i])};
+      messages[i] = {};
+      messages[i].msg_hdr.msg_name = &sources[i];
+      messages[i].msg_hdr.msg_namelen = sizeof(sources[i]);
+      messages[i].msg_hdr.msg_iov = &iov[i];
+      messages[i].msg_hdr.msg_iovlen = 1;
+      messages[i].msg_hdr.msg_control = control[i];
+      messages[i].msg_hdr.msg_controllen = sizeof(control[i]);
+    }
+    const int received = ::recvmmsg(socket_fd_, messages, kBatch, MSG_DONTWAIT, nullptr);
+    if (received <= 0) {
+      break;
+    }
+    const int64_t now_ns = ClockNs(CLOCK_REALTIME);
+    const uint64_t now_us = NowUs();
+    for (int i = 0; i < received; ++i) {
+      ++last_drain_.datagrams;
+      const int64_t rx_ns = ReceiveTimeNs(messages[i].msg_hdr);
+      const uint32_t age_us =
+          rx_ns > 0 && now_ns > rx_ns ? static_cast<uint32_t>((now_ns - rx_ns) / 1000) : 0;
+
+      TimeSyncPacket request{};
+      if (DecodeTimeSyncRequest(buffers[i], messages[i].msg_len, request)) {
+        const TimeSyncPacket reply = MakeTimeSyncReply(request, now_us - age_us, NowUs());
+        ::sendto(socket_fd_, &reply, sizeof(reply), 0,
+                 reinterpret_cast<sockaddr*>(&sources[i]), messages[i].msg_hdr.msg_namelen);
+        ++last_drain_.time_sync;
+        continue;
+      }
+
+      CommandFrame frame{};
+      const uint8_t version = messages[i].msg_len > 4 ? buffers[i][4] : 0;
+      if (!DecodeCommandPacket(buffers[i], messages[i].msg_len, frame)) {
+        ++last_drain_.invalid;
+        continue;
+      }
+      if (version == 1) {
+        // v1 carries no sequence; arrival order stands in for it.
+        frame.sequence = have_sequence_ ? last_sequence_ + 1 : 0;
+      } else if (!AcceptSequence(frame.sequence, now_us)) {
+        continue;
+      }
+      have_sequence_ = true;
+      last_sequence_ = frame.sequence;
+      last_accept_us_ = now_us;
+      frame.age_us = age_us;
+      frame.received_us = now_us - age_us;
+      out[head] = frame;
+      ++valid;
+      head = head + 1 == capacity ? 0 : head + 1;
+      stored = std::min(stored + 1, capacity);
+    }
+    if (static_cast<size_t>(received) < kBatch) {
+      break;
+    }
+  }
+
+  if (stored == capacity && head != 0) {
+    std::rotate(out, out + head, out + capacity);
+  }
+  last_drain_.dropped = valid - static_cast<uint32_t>(stored);
+  last_drain_.age_us = stored > 0 ? out[stored - 1].age_us : 0;
+  total_dropped_ += last_drain_.dropped + last_drain_.out_of_order;
+  return stored;
 #else
-  return std::nullopt;
+  (void)out;
+  (void)capacity;
+  return 0;
 #endif
 }
 
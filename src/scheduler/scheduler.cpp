@@ -19,12 +19,27 @@ void Scheduler::Tick(float dt_s) {
       continue;
     }
     task.accumulator_s += dt_s;
+    task.elapsed_s += dt_s;
     const float period_s = 1.0f / static_cast<float>(task.rate_hz);
-    while (task.accumulator_s + 1e-6f >= period_s) {
-      task.callback(period_s);
-      task.accumulator_s -= period_s;
+    if (task.accumulator_s + 1e-6f < period_s) {
+      continue;
+    }
+    task.callback(task.elapsed_s);
+    task.elapsed_s = 0.0f;
+    task.accumulator_s -= period_s;
+    // Periods missed by a slow tick are dropped, not replayed.
+    if (task.accumulator_s + 1e-6f >= period_s) {
+      task.accumulator_s = 0.0f;
     }
   }
 }
 
+/** @brief Clear accumulated time so no task is due immediately. */
+void Scheduler::Reset() {
+  for (auto& task : tasks_) {
+    task.accumulator_s = 0.0f;
+    task.elapsed_s = 0.0f;
+  }
+}
+
 }  // namespace flight::scheduler
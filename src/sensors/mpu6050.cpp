@@ -64,4 +64,17 @@ std::optional<ImuSample> Mpu6050Imu::Read() {
   return sample;
 }
 
+/** @brief Registers always hold a sample, so a batch is the current one. */
+size_t Mpu6050Imu::ReadBatch(ImuSample* out, size_t capacity) {
+  if (capacity == 0) {
+    return 0;
+  }
+  const auto sample = Read();
+  if (!sample) {
+    return 0;
+  }
+  out[0] = *sample;
+  return 1;
+}
+
 }  // namespace flight::sensors
@@ -0,0 +1,71 @@
+/**
+ * @file async_telemetry.cpp
+ * @brief Telemetry sink decorator with an off-loop consumer.
+ */
+
+#include "flight/telemetry/async_telemetry.h"
+
+#include <chrono>
+
+#include "flight/hal/linux_hal.h"
+
+namespace flight::telemetry {
+
+AsyncTelemetrySink::AsyncTelemetrySink(ITelemetrySink& sink) : AsyncTelemetrySink(sink, Config{}) {}
+
+AsyncTelemetrySink::AsyncTelemetrySink(ITelemetrySink& sink, const Config& config)
+    : sink_(sink), config_(config), queue_(config.drop) {}
+
+AsyncTelemetrySink::~AsyncTelemetrySink() {
+  Stop();
+}
+
+bool AsyncTelemetrySink::Initialize() {
+  return sink_.Initialize();
+}
+
+void AsyncTelemetrySink::Publish(const TelemetrySnapshot& snapshot) {
+  queue_.Push(snapshot);
+}
+
+size_t AsyncTelemetrySink::Drain() {
+  TelemetrySnapshot snapshot{};
+  size_t count = 0;
+  while (queue_.Pop(snapshot)) {
+    sink_.Publish(snapshot);
+    ++count;
+  }
+  forwarded_.fetch_add(count, std::memory_order_relaxed);
+  return count;
+}
+
+bool AsyncTelemetrySink::Start() {
+#if defined(__linux__)
+  if (Running()) {
+    return false;
+  }
+  running_.store(true, std::memory_order_release);
+  thread_ = std::thread([this] { Run(); });
+  hal::PinThreadToCpu(thread_, config_.cpu);
+  return true;
+#else
+  return false;
+#endif
+}
+
+void AsyncTelemetrySink::Stop() {
+  running_.store(false, std::memory_order_release);
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void AsyncTelemetrySink::Run() {
+  while (Running()) {
+    Drain();
+    std::this_thread::sleep_for(std::chrono::microseconds(config_.poll_interval_us));
+  }
+  Drain();
+}
+
+}  // namespace flight::telemetry
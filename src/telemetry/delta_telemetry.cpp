@@ -0,0 +1,246 @@
+/**
+ * @file delta_telemetry.cpp
+ * @brief Quantized, delta-encoded telemetry batches.
+ */
+
+#include "flight/telemetry/delta_telemetry.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace flight::telemetry {
+
+namespace {
+
+constexpr size_t kMaskBytes = (QuantizedTelemetry::kFields + 7) / 8;
+constexpr size_t kMaxVarint = 10;
+
+int64_t Fixed(float value, float scale) {
+  const float scaled = value * scale;
+  // Keep NaN and absurd values from turning into undefined conversions.
+  if (!(std::fabs(scaled) < 1e15f)) {
+    return 0;
+  }
+  return std::llround(scaled);
+}
+
+float Float(int64_t value, float scale) {
+  return static_cast<float>(value) / scale;
+}
+
+uint64_t ZigZag(int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t UnZigZag(uint64_t value) {
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+size_t PutVarint(uint64_t value, uint8_t* out) {
+  size_t n = 0;
+  while (value >= 0x80) {
+    out[n++] = static_cast<uint8_t>(value | 0x80);
+    value >>= 7;
+  }
+  out[n++] = static_cast<uint8_t>(value);
+  return n;
+}
+
+bool GetVarint(const uint8_t* data, size_t length, size_t& pos, uint64_t& value) {
+  value = 0;
+  for (size_t shift = 0; shift < 64; shift += 7) {
+    if (pos >= length) {
+      return false;
+    }
+    const uint8_t byte = data[pos++];
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/** @brief Sequential field writer/reader so both directions share one order. */
+struct Fields {
+  int64_t* q;
+  size_t i = 0;
+  void Put(float value, float scale) { q[i++] = Fixed(value, scale); }
+  void Put(int64_t value) { q[i++] = value; }
+  float GetFloat(float scale) { return Float(q[i++], scale); }
+  int64_t Get() { return q[i++]; }
+};
+
+constexpr float kQuat = 1e4f;
+constexpr float kMilli = 1e3f;
+constexpr float kDeci = 10.0f;
+
+}  // namespace
+
+QuantizedTelemetry QuantizeSnapshot(const TelemetrySnapshot& s) {
+  QuantizedTelemetry quantized;
+  Fields f{quantized.field};
+  f.Put(s.output.motor_count);
+  f.Put(static_cast<int64_t>(s.timestamp_us));
+  const core::Quaternionf& q = s.pose.orientation;
+  for (float v : {q.w, q.x, q.y, q.z}) {
+    f.Put(v, kQuat);
+  }
+  for (const core::Vector3f* vec : {&s.pose.angular_velocity_rps, &s.pose.position_m,
+                                    &s.pose.velocity_mps, &s.setpoint.velocity_mps,
+                                    &s.setpoint.body_rates_rps}) {
+    f.Put(vec->x, kMilli);
+    f.Put(vec->y, kMilli);
+    f.Put(vec->z, kMilli);
+  }
+  f.Put(s.setpoint.thrust, kMilli);
+  for (float motor : s.output.motors) {
+    f.Put(motor, kMilli);
+  }
+  const bool esc = s.esc_telemetry.has_value();
+  f.Put(esc ? s.esc_telemetry->channel : 0);
+  f.Put(esc ? s.esc_telemetry->data : 0);
+  f.Put(esc ? s.esc_telemetry->raw : 0);
+  f.Put(esc && s.esc_telemetry->crc_ok ? 1 : 0);
+  f.Put(esc ? 1 : 0);
+  f.Put(s.armed ? 1 : 0);
+  f.Put(s.gyro_peak_hz.x, kDeci);
+  f.Put(s.gyro_peak_hz.y, kDeci);
+  f.Put(s.gyro_peak_hz.z, kDeci);
+  f.Put(s.command_sequence);
+  f.Put(static_cast<int64_t>(s.command_sent_us));
+  f.Put(static_cast<int64_t>(s.command_received_us));
+  f.Put(static_cast<int64_t>(s.actuator_write_us));
+  return quantized;
+}
+
+TelemetrySnapshot DequantizeSnapshot(const QuantizedTelemetry& quantized) {
+  TelemetrySnapshot s;
+  QuantizedTelemetry copy = quantized;
+  Fields f{copy.field};
+  s.output.motor_count = static_cast<uint8_t>(f.Get());
+  s.timestamp_us = static_cast<core::TimestampUs>(f.Get());
+  s.pose.orientation.w = f.GetFloat(kQuat);
+  s.pose.orientation.x = f.GetFloat(kQuat);
+  s.pose.orientation.y = f.GetFloat(kQuat);
+  s.pose.orientation.z = f.GetFloat(kQuat);
+  for (core::Vector3f* vec : {&s.pose.angular_velocity_rps, &s.pose.position_m,
+                              &s.pose.velocity_mps, &s.setpoint.velocity_mps,
+                              &s.setpoint.body_rates_rps}) {
+    vec->x = f.GetFloat(kMilli);
+    vec->y = f.GetFloat(kMilli);
+    vec->z = f.GetFloat(kMilli);
+  }
+  s.setpoint.thrust = f.GetFloat(kMilli);
+  for (float& motor : s.output.motors) {
+    motor = f.GetFloat(kMilli);
+  }
+  actuators::DshotTelemetryFrame esc;
+  esc.channel = static_cast<uint8_t>(f.Get());
+  esc.data = static_cast<uint16_t>(f.Get());
+  esc.raw = static_cast<uint16_t>(f.Get());
+  esc.crc_ok = f.Get() != 0;
+  if (f.Get() != 0) {
+    s.esc_telemetry = esc;
+  }
+  s.armed = f.Get() != 0;
+  s.gyro_peak_hz.x = f.GetFloat(kDeci);
+  s.gyro_peak_hz.y = f.GetFloat(kDeci);
+  s.gyro_peak_hz.z = f.GetFloat(kDeci);
+  s.command_sequence = static_cast<uint32_t>(f.Get());
+  s.command_sent_us = static_cast<uint64_t>(f.Get());
+  s.command_received_us = static_cast<uint64_t>(f.Get());
+  s.actuator_write_us = static_cast<uint64_t>(f.Get());
+  return s;
+}
+
+void DeltaTelemetryEncoder::Reset() {
+  std::memcpy(data_, &kTelemetryMagic, sizeof(kTelemetryMagic));
+  data_[4] = kVersion;
+  data_[5] = 0;
+  data_[6] = 0;
+  data_[7] = 0;
+  size_ = kHeaderBytes;
+}
+
+bool DeltaTelemetryEncoder::Append(const TelemetrySnapshot& snapshot) {
+  if (FrameCount() == 255) {
+    return false;
+  }
+  const QuantizedTelemetry current = QuantizeSnapshot(snapshot);
+  uint8_t frame[kMaskBytes + QuantizedTelemetry::kFields * kMaxVarint];
+  size_t n = 0;
+  if (FrameCount() == 0) {
+    for (int64_t value : current.field) {
+      n += PutVarint(ZigZag(value), frame + n);
+    }
+  } else {
+    uint8_t* mask = frame;
+    std::memset(mask, 0, kMaskBytes);
+    n = kMaskBytes;
+    for (size_t i = 0; i < QuantizedTelemetry::kFields; ++i) {
+      const int64_t delta = static_cast<int64_t>(static_cast<uint64_t>(current.field[i]) -
+                                                 static_cast<uint64_t>(previous_.field[i]));
+      if (delta != 0) {
+        mask[i / 8] = static_cast<uint8_t>(mask[i / 8] | (1u << (i % 8)));
+        n += PutVarint(ZigZag(delta), frame + n);
+      }
+    }
+  }
+  if (size_ + n > kMaxDatagram) {
+    return false;
+  }
+  std::memcpy(data_ + size_, frame, n);
+  size_ += n;
+  ++data_[5];
+  previous_ = current;
+  return true;
+}
+
+size_t DecodeDeltaTelemetry(const uint8_t* data, size_t length, TelemetrySnapshot* out,
+                            size_t capacity) {
+  if (length < DeltaTelemetryEncoder::kHeaderBytes) {
+    return 0;
+  }
+  uint32_t magic = 0;
+  std::memcpy(&magic, data, sizeof(magic));
+  if (magic != kTelemetryMagic || data[4] != DeltaTelemetryEncoder::kVersion) {
+    return 0;
+  }
+  const size_t frames = data[5];
+  size_t pos = DeltaTelemetryEncoder::kHeaderBytes;
+  QuantizedTelemetry current;
+  size_t count = 0;
+  for (size_t frame = 0; frame < frames; ++frame) {
+    uint64_t raw = 0;
+    if (frame == 0) {
+      for (int64_t& value : current.field) {
+        if (!GetVarint(data, length, pos, raw)) {
+          return 0;
+        }
+        value = UnZigZag(raw);
+      }
+    } else {
+      if (pos + kMaskBytes > length) {
+        return 0;
+      }
+      const uint8_t* mask = data + pos;
+      pos += kMaskBytes;
+      for (size_t i = 0; i < QuantizedTelemetry::kFields; ++i) {
+        if ((mask[i / 8] >> (i % 8)) & 1u) {
+          if (!GetVarint(data, length, pos, raw)) {
+            return 0;
+          }
+          current.field[i] = static_cast<int64_t>(static_cast<uint64_t>(current.field[i]) +
+                                                  static_cast<uint64_t>(UnZigZag(raw)));
+        }
+      }
+    }
+    if (count < capacity) {
+      out[count++] = DequantizeSnapshot(current);
+    }
+  }
+  return pos == length ? count : 0;
+}
+
+}  // namespace flight::telemetry
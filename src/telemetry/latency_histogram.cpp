@@ -0,0 +1,40 @@
+/**
+ * @file latency_histogram.cpp
+ * @brief Log2 latency histogram.
+ */
+
+#include "flight/telemetry/latency_histogram.h"
+
+namespace flight::telemetry {
+
+void LatencyHistogram::Add(uint64_t latency_us) {
+  uint8_t bucket = 0;
+  while (bucket + 1 < kBuckets && latency_us >= (1ull << bucket)) {
+    ++bucket;
+  }
+  ++buckets_[bucket];
+  ++count_;
+  sum_us_ += latency_us;
+  max_us_ = latency_us > max_us_ ? latency_us : max_us_;
+}
+
+void LatencyHistogram::Reset() {
+  *this = LatencyHistogram{};
+}
+
+uint64_t LatencyHistogram::PercentileUs(float p) const {
+  if (count_ == 0) {
+    return 0;
+  }
+  const uint64_t target = static_cast<uint64_t>(p * static_cast<float>(count_) + 0.5f);
+  uint64_t seen = 0;
+  for (uint8_t b = 0; b < kBuckets; ++b) {
+    seen += buckets_[b];
+    if (seen >= target && buckets_[b] > 0) {
+      return b + 1 < kBuckets ? (1ull << b) : max_us_;
+    }
+  }
+  return max_us_;
+}
+
+}  // namespace flight::telemetry
@@ -0,0 +1,303 @@
+/**
+ * @file stream_telemetry.cpp
+ * @brief Schema-generated stream packets and the per-stream rate sender.
+ */
+
+#include "flight/telemetry/stream_telemetry.h"
+
+#include <cstring>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace flight::telemetry {
+
+namespace {
+
+struct StreamInfo {
+  const char* name;
+  uint16_t rate_hz;
+};
+
+constexpr StreamInfo kStreams[] = {
+#define FLIGHT_STREAM_INFO(id, name, rate) {name, rate},
+    FLIGHT_TELEMETRY_STREAMS(FLIGHT_STREAM_INFO)
+#undef FLIGHT_STREAM_INFO
+};
+
+struct PayloadTable {
+  size_t bytes[kTelemetryStreamCount];
+};
+
+constexpr PayloadTable MakePayloadTable() {
+  PayloadTable table{};
+#define FLIGHT_FIELD_BYTES(stream, name, type, member) \
+  table.bytes[static_cast<size_t>(TelemetryStream::stream)] += sizeof(type);
+  FLIGHT_TELEMETRY_FIELDS(FLIGHT_FIELD_BYTES)
+#undef FLIGHT_FIELD_BYTES
+  return table;
+}
+
+constexpr PayloadTable kPayload = MakePayloadTable();
+
+/** @brief Append the fields of @p stream in schema order. */
+uint8_t* WriteStream(TelemetryStream stream, const TelemetrySnapshot& snapshot, uint8_t* out) {
+#define FLIGHT_FIELD_WRITE(id, name, type, member)          \
+  if (stream == TelemetryStream::id) {                      \
+    const type value = static_cast<type>(snapshot.member);  \
+    std::memcpy(out, &value, sizeof(value));                \
+    out += sizeof(value);                                   \
+  }
+  FLIGHT_TELEMETRY_FIELDS(FLIGHT_FIELD_WRITE)
+#undef FLIGHT_FIELD_WRITE
+  return out;
+}
+
+const uint8_t* ReadStream(TelemetryStream stream, const uint8_t* in, TelemetrySnapshot& snapshot) {
+  if (stream == TelemetryStream::kEsc) {
+    snapshot.esc_telemetry.emplace();
+  }
+#define FLIGHT_FIELD_READ(id, name, type, member)                                         \
+  if (stream == TelemetryStream::id) {                                                    \
+    type value{};                                                                         \
+    std::memcpy(&value, in, sizeof(value));                                               \
+    in += sizeof(value);                                                                  \
+    snapshot.member = static_cast<std::remove_reference_t<decltype(snapshot.member)>>(value); \
+  }
+  FLIGHT_TELEMETRY_FIELDS(FLIGHT_FIELD_READ)
+#undef FLIGHT_FIELD_READ
+  return in;
+}
+
+}  // namespace
+
+const char* StreamName(TelemetryStream stream) {
+  const size_t index = static_cast<size_t>(stream);
+  return index < kTelemetryStreamCount ? kStreams[index].name : "";
+}
+
+uint16_t DefaultStreamRate(TelemetryStream stream) {
+  const size_t index = static_cast<size_t>(stream);
+  return index < kTelemetryStreamCount ? kStreams[index].rate_hz : 0;
+}
+
+size_t StreamPayloadBytes(TelemetryStream stream) {
+  const size_t index = static_cast<size_t>(stream);
+  return index < kTelemetryStreamCount ? kPayload.bytes[index] : 0;
+}
+
+size_t EncodeStreamPacket(const TelemetrySnapshot& snapshot, uint16_t mask, void* out, size_t capacity) {
+  if (!snapshot.esc_telemetry) {
+    mask = static_cast<uint16_t>(mask & ~(1u << static_cast<size_t>(TelemetryStream::kEsc)));
+  }
+  mask = static_cast<uint16_t>(mask & ((1u << kTelemetryStreamCount) - 1u));
+  size_t length = sizeof(StreamPacketHeader);
+  for (size_t i = 0; i < kTelemetryStreamCount; ++i) {
+    length += ((mask >> i) & 1u) ? kPayload.bytes[i] : 0;
+  }
+  if (capacity < length) {
+    return 0;
+  }
+
+  StreamPacketHeader header{};
+  header.stream_mask = mask;
+  header.timestamp_us = snapshot.timestamp_us;
+  uint8_t* bytes = static_cast<uint8_t*>(out);
+  std::memcpy(bytes, &header, sizeof(header));
+  uint8_t* cursor = bytes + sizeof(header);
+  for (size_t i = 0; i < kTelemetryStreamCount; ++i) {
+    if ((mask >> i) & 1u) {
+      cursor = WriteStream(static_cast<TelemetryStream>(i), snapshot, cursor);
+    }
+  }
+  return length;
+}
+
+bool DecodeStreamPacket(const void* data, size_t length, TelemetrySnapshot& snapshot, uint16_t& mask) {
+  if (length < sizeof(StreamPacketHeader)) {
+    return false;
+  }
+  StreamPacketHeader header{};
+  std::memcpy(&header, data, sizeof(header));
+  if (header.magic != kStreamTelemetryMagic || header.version != 1 ||
+      (header.stream_mask >> kTelemetryStreamCount) != 0) {
+    return false;
+  }
+  size_t expected = sizeof(header);
+  for (size_t i = 0; i < kTelemetryStreamCount; ++i) {
+    expected += ((header.stream_mask >> i) & 1u) ? kPayload.bytes[i] : 0;
+  }
+  if (length != expected) {
+    return false;
+  }
+
+  snapshot.timestamp_us = header.timestamp_us;
+  const uint8_t* cursor = static_cast<const uint8_t*>(data) + sizeof(header);
+  for (size_t i = 0; i < kTelemetryStreamCount; ++i) {
+    if ((header.stream_mask >> i) & 1u) {
+      cursor = ReadStream(static_cast<TelemetryStream>(i), cursor, snapshot);
+    }
+  }
+  mask = header.stream_mask;
+  return true;
+}
+
+size_t EncodeSubscription(const StreamRate* rates, size_t count, void* out, size_t capacity) {
+  const size_t length = kSubscribeHeaderBytes + count * sizeof(StreamRate);
+  if (count > 255 || capacity < length) {
+    return 0;
+  }
+  uint8_t* bytes = static_cast<uint8_t*>(out);
+  std::memcpy(bytes, &kStreamSubscribeMagic, sizeof(kStreamSubscribeMagic));
+  bytes[4] = 1;
+  bytes[5] = static_cast<uint8_t>(count);
+  std::memcpy(bytes + kSubscribeHeaderBytes, rates, count * sizeof(StreamRate));
+  return length;
+}
+
+size_t DecodeSubscription(const void* data, size_t length, StreamRate* out, size_t capacity) {
+  if (length < kSubscribeHeaderBytes) {
+    return 0;
+  }
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  uint32_t magic = 0;
+  std::memcpy(&magic, bytes, sizeof(magic));
+  const size_t count = bytes[5];
+  if (magic != kStreamSubscribeMagic || bytes[4] != 1 || count > capacity ||
+      length != kSubscribeHeaderBytes + count * sizeof(StreamRate)) {
+    return 0;
+  }
+  std::memcpy(static_cast<void*>(out), bytes + kSubscribeHeaderBytes, count * sizeof(StreamRate));
+  return count;
+}
+
+StreamTelemetrySender::StreamTelemetrySender(const Config& config) : config_(config) {
+  for (size_t i = 0; i < kTelemetryStreamCount; ++i) {
+    rate_hz_[i] = kStreams[i].rate_hz;
+  }
+}
+
+StreamTelemetrySender::~StreamTelemetrySender() {
+#if defined(__linux__)
+  if (socket_fd_ >= 0) {
+    ::close(socket_fd_);
+  }
+#endif
+}
+
+/** @brief Bind the subscription port and connect to the ground station. */
+bool StreamTelemetrySender::Initialize() {
+#if defined(__linux__)
+  socket_fd_ = ::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+  if (socket_fd_ < 0) {
+    return false;
+  }
+  const int reuse = 1;
+  ::setsockopt(socket_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  sockaddr_in local{};
+  local.sin_family = AF_INET;
+  local.sin_port = htons(config_.local_port);
+  local.sin_addr.s_addr = htonl(INADDR_ANY);
+  sockaddr_in remote{};
+  remote.sin_family = AF_INET;
+  remote.sin_port = htons(config_.port);
+  if (::bind(socket_fd_, reinterpret_cast<sockaddr*>(&local), sizeof(local)) < 0 ||
+      ::inet_pton(AF_INET, config_.address.c_str(), &remote.sin_addr) != 1 ||
+      ::connect(socket_fd_, reinterpret_cast<sockaddr*>(&remote), sizeof(remote)) < 0) {
+    ::close(socket_fd_);
+    socket_fd_ = -1;
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+void StreamTelemetrySender::Publish(const TelemetrySnapshot& snapshot) {
+#if defined(__linux__)
+  if (socket_fd_ < 0) {
+    return;
+  }
+  const uint64_t now_us = snapshot.timestamp_us;
+  if (now_us >= next_poll_us_) {
+    PollSubscriptions(now_us);
+  }
+
+  uint16_t mask = 0;
+  for (size_t i = 0; i < kTelemetryStreamCount; ++i) {
+    if (rate_hz_[i] == 0 || now_us < next_due_us_[i]) {
+      continue;
+    }
+    mask = static_cast<uint16_t>(mask | (1u << i));
+    // Keep the phase when on time; resynchronize after a gap.
+    const uint64_t period_us = 1000000ull / rate_hz_[i];
+    next_due_us_[i] += period_us;
+    if (next_due_us_[i] <= now_us) {
+      next_due_us_[i] = now_us + period_us;
+    }
+  }
+  if (mask == 0) {
+    return;
+  }
+
+  uint8_t packet[kMaxPacket];
+  const size_t length = EncodeStreamPacket(snapshot, mask, packet, sizeof(packet));
+  // Only the ESC stream can drop out, and only when no ESC frame is present.
+  if (length <= sizeof(StreamPacketHeader)) {
+    return;
+  }
+  if (::send(socket_fd_, packet, length, 0) > 0) {
+    ++packets_sent_;
+    bytes_sent_ += length;
+  }
+#else
+  (void)snapshot;
+#endif
+}
+
+void StreamTelemetrySender::SetRate(TelemetryStream stream, uint16_t rate_hz) {
+  const size_t index = static_cast<size_t>(stream);
+  if (index < kTelemetryStreamCount) {
+    rate_hz_[index] = rate_hz;
+    next_due_us_[index] = 0;
+  }
+}
+
+uint16_t StreamTelemetrySender::Rate(TelemetryStream stream) const {
+  const size_t index = static_cast<size_t>(stream);
+  return index < kTelemetryStreamCount ? rate_hz_[index] : 0;
+}
+
+bool StreamTelemetrySender::ApplySubscription(const void* data, size_t length) {
+  StreamRate rates[kTelemetryStreamCount];
+  const size_t count = DecodeSubscription(data, length, rates, kTelemetryStreamCount);
+  if (count == 0) {
+    return false;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    SetRate(static_cast<TelemetryStream>(rates[i].stream), rates[i].rate_hz);
+  }
+  return true;
+}
+
+/** @brief Apply every queued request (connected socket: ground station only). */
+void StreamTelemetrySender::PollSubscriptions(uint64_t now_us) {
+#if defined(__linux__)
+  next_poll_us_ = now_us + config_.subscription_poll_us;
+  uint8_t request[kSubscribeHeaderBytes + 255 * sizeof(StreamRate)];
+  ssize_t received = 0;
+  while ((received = ::recv(socket_fd_, request, sizeof(request), 0)) > 0) {
+    ApplySubscription(request, static_cast<size_t>(received));
+  }
+#else
+  (void)now_us;
+#endif
+}
+
+}  // namespace flight::telemetry
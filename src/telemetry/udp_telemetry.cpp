@@ -5,6 +5,7 @@
 
 #include "flight/telemetry/udp_telemetry.h"
 
+#include <algorithm>
 #include <cstring>
 
 #if defined(__linux__)
@@ -20,8 +21,8 @@ namespace {
 
 #pragma pack(push, 1)
 struct UdpTelemetryPacket {
-  uint32_t magic = 0x4D46544C;  // "MFTL"
-  uint8_t version = 1;
+  uint32_t magic = kTelemetryMagic;
+  uint8_t version = 3;
   uint8_t motor_count = 0;
   uint16_t reserved = 0;
   uint64_t timestamp_us = 0;
@@ -39,17 +40,53 @@ struct UdpTelemetryPacket {
   uint8_t esc_crc_ok = 0;
   uint8_t esc_present = 0;
   uint8_t armed = 0;
+  flight::core::Vector3f gyro_peak_hz{};
+  // Version 3: command echo for end-to-end latency.
+  uint32_t command_sequence = 0;
+  uint64_t command_sent_us = 0;
+  uint64_t command_received_us = 0;
+  uint64_t actuator_write_us = 0;
 };
 #pragma pack(pop)
 
 }  // namespace
 
-UdpTelemetrySender::UdpTelemetrySender(const Config& config) : config_(config) {}
+UdpTelemetrySender::UdpTelemetrySender(const Config& config) : config_(config) {
+  config_.flush_datagrams = static_cast<uint8_t>(
+      std::clamp<size_t>(config_.flush_datagrams, 1, kMaxPending));
+}
+
+UdpTelemetrySender::~UdpTelemetrySender() {
+#if defined(__linux__)
+  if (socket_fd_ >= 0) {
+    Flush();
+    ::close(socket_fd_);
+  }
+#endif
+}
 
+/** @brief Open and connect the socket once, so sends skip address handling. */
 bool UdpTelemetrySender::Initialize() {
 #if defined(__linux__)
+  if (socket_fd_ >= 0) {
+    ::close(socket_fd_);
+  }
   socket_fd_ = ::socket(AF_INET, SOCK_DGRAM, 0);
-  return socket_fd_ >= 0;
+  if (socket_fd_ < 0) {
+    return false;
+  }
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(config_.port);
+  if (::inet_pton(AF_INET, config_.address.c_str(), &addr.sin_addr) != 1 ||
+      ::connect(socket_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+    ::close(socket_fd_);
+    socket_fd_ = -1;
+    return false;
+  }
+  encoder_.Reset();
+  pending_count_ = 0;
+  return true;
 #else
   return false;
 #endif
@@ -67,6 +104,29 @@ void UdpTelemetrySender::Publish(const TelemetrySnapshot& snapshot) {
     }
   }
 
+  last_send_us_ = snapshot.timestamp_us;
+
+  if (config_.batch_frames > 0) {
+    if (encoder_.FrameCount() == 0 && pending_count_ == 0) {
+      oldest_queued_us_ = snapshot.timestamp_us;
+    }
+    if (!encoder_.Append(snapshot)) {
+      CloseDatagram();
+      encoder_.Append(snapshot);
+    }
+    if (encoder_.FrameCount() >= config_.batch_frames) {
+      CloseDatagram();
+    }
+    if (pending_count_ >= config_.flush_datagrams) {
+      SendPending();
+    } else if (config_.max_age_us > 0 &&
+               snapshot.timestamp_us - oldest_queued_us_ >= config_.max_age_us) {
+      // At low rates a full batch takes too long; do not let samples go stale.
+      Flush();
+    }
+    return;
+  }
+
   UdpTelemetryPacket packet{};
   packet.timestamp_us = snapshot.timestamp_us;
   packet.orientation = snapshot.pose.orientation;
@@ -89,22 +149,62 @@ void UdpTelemetrySender::Publish(const TelemetrySnapshot& snapshot) {
     packet.esc_crc_ok = snapshot.esc_telemetry->crc_ok ? 1 : 0;
   }
   packet.armed = snapshot.armed ? 1 : 0;
+  packet.gyro_peak_hz = snapshot.gyro_peak_hz;
+  packet.command_sequence = snapshot.command_sequence;
+  packet.command_sent_us = snapshot.command_sent_us;
+  packet.command_received_us = snapshot.command_received_us;
+  packet.actuator_write_us = snapshot.actuator_write_us;
+
+  if (::send(socket_fd_, &packet, sizeof(packet), 0) > 0) {
+    bytes_sent_ += sizeof(packet);
+  }
+  ++syscalls_;
+#else
+  (void)snapshot;
+#endif
+}
 
-  sockaddr_in addr{};
-  addr.sin_family = AF_INET;
-  addr.sin_port = htons(config_.port);
-  addr.sin_addr.s_addr = inet_addr(config_.address.c_str());
+/** @brief Move the encoder's datagram to the send queue (flushing if the queue is full). */
+void UdpTelemetrySender::CloseDatagram() {
+  if (encoder_.FrameCount() == 0) {
+    return;
+  }
+  if (pending_count_ == kMaxPending) {
+    SendPending();
+  }
+  std::memcpy(pending_[pending_count_], encoder_.Data(), encoder_.Size());
+  pending_size_[pending_count_] = encoder_.Size();
+  ++pending_count_;
+  encoder_.Reset();
+}
 
-  ::sendto(socket_fd_,
-           reinterpret_cast<const void*>(&packet),
-           sizeof(packet),
-           0,
-           reinterpret_cast<sockaddr*>(&addr),
-           sizeof(addr));
+void UdpTelemetrySender::Flush() {
+  CloseDatagram();
+  SendPending();
+}
 
-  last_send_us_ = snapshot.timestamp_us;
-#else
-  (void)snapshot;
+/** @brief One sendmmsg() for every queued datagram. */
+void UdpTelemetrySender::SendPending() {
+#if defined(__linux__)
+  if (socket_fd_ < 0 || pending_count_ == 0) {
+    pending_count_ = 0;
+    return;
+  }
+  iovec iov[kMaxPending];
+  mmsghdr messages[kMaxPending];
+  for (size_t i = 0; i < pending_count_; ++i) {
+    iov[i] = {pending_[i], pending_size_[i]};
+    messages[i] = {};
+    messages[i].msg_hdr.msg_iov = &iov[i];
+    messages[i].msg_hdr.msg_iovlen = 1;
+  }
+  const int sent = ::sendmmsg(socket_fd_, messages, static_cast<unsigned>(pending_count_), 0);
+  ++syscalls_;
+  for (int i = 0; i < sent; ++i) {
+    bytes_sent_ += pending_size_[i];
+  }
+  // Telemetry is lossy by design: whatever the kernel refused is dropped.
+  pending_count_ = 0;
 #endif
 }
 
@@ -6,16 +6,12 @@
 #include "flight/vehicle/rov4_vehicle.h"
 #include "flight/telemetry/telemetry.h"
 
-#include <cmath>
-
 namespace flight::vehicle {
 
 namespace {
 
-constexpr float kArmYawThreshold = 0.9f;
-constexpr float kDisarmYawThreshold = -0.9f;
-constexpr float kNeutralThreshold = 0.1f;
-constexpr float kHoldTimeS = 1.0f;
+/** @brief Upper bound of items drained from each input per tick. */
+constexpr size_t kMaxBatch = 8;
 
 }  // namespace
 
@@ -24,6 +20,7 @@ Rov4Vehicle::Rov4Vehicle(const VehicleDependencies& deps) : deps_(deps) {}
 
 /** @brief Initialize vehicle dependencies. */
 bool Rov4Vehicle::Initialize() {
+  arming_.Reset();
   bool ok = true;
   if (deps_.estimator) {
     ok = deps_.estimator->Initialize() && ok;
@@ -37,6 +34,15 @@ bool Rov4Vehicle::Initialize() {
   if (deps_.receiver) {
     ok = deps_.receiver->Initialize() && ok;
   }
+  if (deps_.imu) {
+    ok = deps_.imu->Initialize() && ok;
+  }
+  if (deps_.gyro_filter) {
+    ok = deps_.gyro_filter->Initialize() && ok;
+  }
+  if (deps_.gyro_spectrum) {
+    ok = deps_.gyro_spectrum->Initialize() && ok;
+  }
   return ok;
 }
 
@@ -48,47 +54,77 @@ void Rov4Vehicle::Update(float dt_s) {
 
   estimators::EstimatorInput input;
   if (deps_.telemetry) {
-    input.esc_telemetry = deps_.telemetry->Read();
+    actuators::DshotTelemetryFrame frames[kMaxBatch];
+    const size_t count = deps_.telemetry->ReadBatch(frames, kMaxBatch);
+    for (size_t i = 0; i < count && deps_.gyro_filter; ++i) {
+      deps_.gyro_filter->UpdateTelemetry(frames[i]);
+    }
+    if (count > 0) {
+      input.esc_telemetry = frames[count - 1];
+    }
+  }
+
+  // Every pending IMU sample goes through the filters and the estimator so
+  // none are dropped when the loop runs slower than the sensor.
+  sensors::ImuSample imu_samples[kMaxBatch];
+  const size_t imu_count = deps_.imu ? deps_.imu->ReadBatch(imu_samples, kMaxBatch) : 0;
+  estimators::EstimatorOutput estimate{};
+  if (imu_count == 0) {
+    estimate = deps_.estimator->Update(input);
+  }
+  for (size_t i = 0; i < imu_count; ++i) {
+    ConditionImu(imu_samples[i]);
+    input.imu = imu_samples[i];
+    estimate = deps_.estimator->Update(input);
   }
-  const auto estimate = deps_.estimator->Update(input);
 
   controllers::ControlSetpoint setpoint{};
   bool has_frame = false;
   receiver::CommandFrame frame{};
   if (deps_.receiver) {
-    const auto received = deps_.receiver->Read();
-    if (received && received->channel_count >= 3) {
-      frame = *received;
-      has_frame = true;
-      setpoint.velocity_mps.x = frame.channels[0];
-      setpoint.body_rates_rps.z = frame.channels[1];
-      setpoint.velocity_mps.z = frame.channels[2];
+    receiver::CommandFrame frames[kMaxBatch];
+    const size_t count = deps_.receiver->ReadBatch(frames, kMaxBatch);
+    for (size_t i = count; i > 0; --i) {
+      // A failsafe frame means the link is down: hold a neutral setpoint
+      // rather than falling back to an older command.
+      if (frames[i - 1].failsafe) {
+        break;
+      }
+      if (RovSetpointFromFrame(frames[i - 1], setpoint)) {
+        frame = frames[i - 1];
+        has_frame = true;
+        break;
+      }
     }
   }
 
   if (has_frame) {
-    UpdateArming(frame, dt_s);
+    arming_.Update(frame, dt_s);
   } else {
-    arm_hold_s_ = 0.0f;
-    disarm_hold_s_ = 0.0f;
+    arming_.NoFrame();
   }
 
   controllers::ControlOutput output{};
-  output.motor_count = 4;
-  if (arm_state_ == ArmState::kArmed) {
+  if (arming_.Armed()) {
     output = deps_.controller->Update(estimate.pose, setpoint, dt_s);
-    output.motor_count = 4;
-  } else {
-    for (uint8_t i = 0; i < output.motor_count; ++i) {
-      output.motors[i] = 0.0f;
+    if (output.motor_count != kRovThrusterCount) {
+      arming_.Fault();
     }
   }
+  if (!arming_.Armed()) {
+    output = {};
+    output.motor_count = kRovThrusterCount;
+  }
 
-  actuators::ActuatorCommand commands[4];
-  for (uint8_t i = 0; i < 4; ++i) {
+  actuators::ActuatorCommand commands[kRovThrusterCount];
+  for (uint8_t i = 0; i < kRovThrusterCount; ++i) {
     commands[i].value = output.motors[i];
   }
-  deps_.actuators->Write(commands, 4);
+  deps_.actuators->Write(commands, kRovThrusterCount);
+  const uint64_t write_us = deps_.time ? deps_.time->NowUs() : 0;
+  if (has_frame && deps_.time) {
+    latency_.Record(frame, write_us);
+  }
 
   if (deps_.telemetry_sink) {
     telemetry::TelemetrySnapshot snapshot{};
@@ -97,35 +133,44 @@ void Rov4Vehicle::Update(float dt_s) {
     snapshot.setpoint = setpoint;
     snapshot.output = output;
     snapshot.esc_telemetry = input.esc_telemetry;
-    snapshot.armed = arm_state_ == ArmState::kArmed;
+    snapshot.armed = arming_.Armed();
+    if (has_frame) {
+      snapshot.command_sequence = frame.sequence;
+      snapshot.command_sent_us = frame.sent_us;
+      snapshot.command_received_us = frame.received_us;
+    }
+    snapshot.actuator_write_us = write_us;
+    if (deps_.gyro_spectrum) {
+      snapshot.gyro_peak_hz = {deps_.gyro_spectrum->DominantHz(0),
+                               deps_.gyro_spectrum->DominantHz(1),
+                               deps_.gyro_spectrum->DominantHz(2)};
+    }
     deps_.telemetry_sink->Publish(snapshot);
   }
 }
 
-void Rov4Vehicle::UpdateArming(const receiver::CommandFrame& frame, float dt_s) {
-  const float surge = frame.channels[0];
-  const float yaw = frame.channels[1];
-  const float heave = frame.channels[2];
-
-  const bool neutral = std::abs(surge) < kNeutralThreshold &&
-                       std::abs(heave) < kNeutralThreshold;
-
-  if (neutral && yaw > kArmYawThreshold) {
-    arm_hold_s_ += dt_s;
-    disarm_hold_s_ = 0.0f;
-  } else if (neutral && yaw < kDisarmYawThreshold) {
-    disarm_hold_s_ += dt_s;
-    arm_hold_s_ = 0.0f;
-  } else {
-    arm_hold_s_ = 0.0f;
-    disarm_hold_s_ = 0.0f;
+/** @brief Run spectrum analysis, notch filtering and history on one sample. */
+void Rov4Vehicle::ConditionImu(sensors::ImuSample& sample) {
+  if (deps_.gyro_spectrum) {
+    // Analyze the unfiltered gyro so telemetry reports every peak; the filter
+    // ignores those its RPM notches already cover.
+    deps_.gyro_spectrum->Push(sample.gyro_rps);
+    if (deps_.gyro_filter) {
+      for (uint8_t axis = 0; axis < 3; ++axis) {
+        const auto* peaks = deps_.gyro_spectrum->Peaks(axis);
+        float peak_hz[filters::SpectrumAnalyzer::kMaxPeaks];
+        for (uint8_t i = 0; i < filters::SpectrumAnalyzer::kMaxPeaks; ++i) {
+          peak_hz[i] = peaks[i].hz;
+        }
+        deps_.gyro_filter->SetSpectrumPeaks(axis, peak_hz, filters::SpectrumAnalyzer::kMaxPeaks);
+      }
+    }
   }
-
-  if (arm_hold_s_ >= kHoldTimeS) {
-    arm_state_ = ArmState::kArmed;
+  if (deps_.gyro_filter) {
+    sample.gyro_rps = deps_.gyro_filter->Apply(sample.gyro_rps);
   }
-  if (disarm_hold_s_ >= kHoldTimeS) {
-    arm_state_ = ArmState::kDisarmed;
+  if (deps_.imu_history) {
+    deps_.imu_history->Push(sample);
   }
 }
 
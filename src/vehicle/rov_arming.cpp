@@ -0,0 +1,92 @@
+/**
+ * @file rov_arming.cpp
+ * @brief ROV stick arming, channel mapping and command latency shared by both vehicle paths.
+ */
+
+#include "flight/vehicle/rov_arming.h"
+
+#include <cmath>
+
+namespace flight::vehicle {
+
+namespace {
+
+constexpr float kArmYawThreshold = 0.9f;
+constexpr float kDisarmYawThreshold = -0.9f;
+constexpr float kNeutralThreshold = 0.1f;
+constexpr float kHoldTimeS = 1.0f;
+
+}  // namespace
+
+bool RovArming::Update(const receiver::CommandFrame& frame, float dt_s) {
+  const float surge = frame.channels[0];
+  const float yaw = frame.channels[1];
+  const float heave = frame.channels[2];
+
+  const bool neutral = std::abs(surge) < kNeutralThreshold &&
+                       std::abs(heave) < kNeutralThreshold;
+
+  if (neutral && yaw > kArmYawThreshold) {
+    arm_hold_s_ += dt_s;
+    disarm_hold_s_ = 0.0f;
+  } else if (neutral && yaw < kDisarmYawThreshold) {
+    disarm_hold_s_ += dt_s;
+    arm_hold_s_ = 0.0f;
+  } else {
+    arm_hold_s_ = 0.0f;
+    disarm_hold_s_ = 0.0f;
+  }
+
+  if (arm_hold_s_ >= kHoldTimeS && !faulted_) {
+    armed_ = true;
+  }
+  if (disarm_hold_s_ >= kHoldTimeS) {
+    armed_ = false;
+  }
+  return armed_;
+}
+
+void RovArming::NoFrame() {
+  arm_hold_s_ = 0.0f;
+  disarm_hold_s_ = 0.0f;
+}
+
+void RovArming::Fault() {
+  faulted_ = true;
+  armed_ = false;
+  NoFrame();
+}
+
+void RovArming::Reset() {
+  *this = RovArming{};
+}
+
+void CommandLatency::Record(const receiver::CommandFrame& frame, uint64_t write_us) {
+  if (have_sequence_ && frame.sequence == last_sequence_) {
+    return;
+  }
+  have_sequence_ = true;
+  last_sequence_ = frame.sequence;
+  if (frame.received_us == 0) {
+    return;
+  }
+  if (frame.sent_us != 0 && frame.received_us >= frame.sent_us) {
+    uplink_.Add(frame.received_us - frame.sent_us);
+  }
+  if (write_us >= frame.received_us) {
+    pipeline_.Add(write_us - frame.received_us);
+  }
+}
+
+bool RovSetpointFromFrame(const receiver::CommandFrame& frame,
+                          controllers::ControlSetpoint& setpoint) {
+  if (frame.channel_count < 3) {
+    return false;
+  }
+  setpoint.velocity_mps.x = frame.channels[0];
+  setpoint.body_rates_rps.z = frame.channels[1];
+  setpoint.velocity_mps.z = frame.channels[2];
+  return true;
+}
+
+}  // namespace flight::vehicle
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+
+#include "flight/hal/hal.h"
+
+namespace flight::test {
+
+/** @brief Fake PWM register file with double-buffered compare levels. */
+class FakePwm final : public flight::hal::IPwm {
+ public:
+  struct Slice {
+    uint8_t divider = 0;
+    uint16_t top = 0;
+    uint16_t pending[2] = {};
+    uint16_t active[2] = {};
+    uint16_t counter = 0;
+    bool enabled = false;
+  };
+
+  uint32_t ClockHz() const override { return 150000000; }
+  bool ConfigureSlice(uint8_t slice, uint8_t divider, uint16_t top) override {
+    slices[slice].divider = divider;
+    slices[slice].top = top;
+    ++configure_calls;
+    return true;
+  }
+  void EnablePin(uint32_t gpio) override { pin_mask |= 1ull << gpio; }
+  void SetLevel(uint8_t slice, uint8_t channel, uint16_t level) override {
+    slices[slice].pending[channel] = level;
+  }
+  void EnableSlices(uint32_t slice_mask) override {
+    enable_masks[enable_calls++] = slice_mask;
+    for (uint8_t i = 0; i < 12; ++i) {
+      if (slice_mask & (1u << i)) {
+        slices[i].enabled = true;
+      }
+    }
+  }
+  /** @brief Simulate the counters wrapping at the end of a frame. */
+  void Wrap() {
+    for (auto& slice : slices) {
+      slice.active[0] = slice.pending[0];
+      slice.active[1] = slice.pending[1];
+    }
+  }
+  /** @brief Advance every enabled counter one tick; levels latch when it wraps. */
+  void Step() {
+    for (auto& slice : slices) {
+      if (!slice.enabled) {
+        continue;
+      }
+      if (slice.counter >= slice.top) {
+        slice.counter = 0;
+        slice.active[0] = slice.pending[0];
+        slice.active[1] = slice.pending[1];
+      } else {
+        ++slice.counter;
+      }
+    }
+  }
+  /** @brief Pin level: high while the counter is below the active compare level. */
+  bool High(uint8_t slice, uint8_t channel) const {
+    return slices[slice].counter < slices[slice].active[channel];
+  }
+
+  Slice slices[12];
+  uint64_t pin_mask = 0;
+  uint32_t enable_masks[4] = {};
+  int enable_calls = 0;
+  int configure_calls = 0;
+};
+
+}  // namespace flight::test
@@ -0,0 +1,287 @@
+#include <doctest/doctest.h>
+
+#include <deque>
+
+#include "flight/controllers/rov_controller.h"
+#include "flight/receiver/arbitrated_receiver.h"
+#include "flight/vehicle/rov4_vehicle.h"
+#include "test_fakes.h"
+
+namespace rx = flight::receiver;
+using flight::test::ManualTime;
+
+namespace {
+
+/** @brief Link that emits a frame every `period_us` while `up`, tagged with `id` on ch3. */
+class SimulatedLink final : public rx::ICommandReceiver {
+ public:
+  SimulatedLink(const ManualTime& time, float id, uint64_t period_us)
+      : time_(time), id_(id), period_us_(period_us), next_us_(period_us) {}
+
+  bool Initialize() override { return true; }
+  std::optional<rx::CommandFrame> Read() override {
+    if (pending.empty()) {
+      return std::nullopt;
+    }
+    auto frame = pending.front();
+    pending.pop_front();
+    return frame;
+  }
+
+  /** @brief Generate the frames due by now. */
+  void Advance() {
+    while (next_us_ <= time_.NowUs()) {
+      ++sequence_;
+      if (up && sequence_ % keep_every == 0) {
+        rx::CommandFrame frame{};
+        frame.channel_count = 4;
+        frame.channels[3] = id_;
+        frame.sequence = sequence_;
+        frame.received_us = next_us_ + clock_offset_us;
+        frame.failsafe = failsafe;
+        pending.push_back(frame);
+        last_sent_us = next_us_;
+      }
+      next_us_ += period_us_;
+    }
+  }
+
+  bool up = true;
+  bool failsafe = false;
+  /** @brief Deliver only one of every `keep_every` frames. */
+  uint32_t keep_every = 1;
+  /** @brief Offset of the link's own received_us clock from the arbitrator's. */
+  uint64_t clock_offset_us = 0;
+  uint64_t last_sent_us = 0;
+  std::deque<rx::CommandFrame> pending;
+
+ private:
+  const ManualTime& time_;
+  float id_;
+  uint64_t period_us_;
+  uint64_t next_us_;
+  uint32_t sequence_ = 0;
+};
+
+struct Rig {
+  explicit Rig(float missed_frames = 3.0f, float min_quality = 0.5f) {
+    rx::ArbitratedReceiver::Config config;
+    config.links[0] = &tether;
+    config.links[1] = &radio;
+    config.link_count = 2;
+    config.time = &time;
+    config.missed_frames = missed_frames;
+    config.min_quality = min_quality;
+    receiver.emplace(config);
+  }
+
+  /** @brief Run one 1 kHz control tick. */
+  std::optional<rx::CommandFrame> Tick() {
+    time.now_us += 1000;
+    tether.Advance();
+    radio.Advance();
+    return receiver->Read();
+  }
+
+  /** @brief Ticks until the radio is selected; returns the first frame it served. */
+  rx::CommandFrame RunUntilRadio() {
+    for (int i = 0; i < 1000; ++i) {
+      auto frame = Tick();
+      if (frame && receiver->ActiveLink() == 1) {
+        return *frame;
+      }
+    }
+    return {};
+  }
+
+  ManualTime time;
+  SimulatedLink tether{time, 1.0f, 2000};  // 500 Hz
+  SimulatedLink radio{time, 2.0f, 4000};   // 250 Hz
+  std::optional<rx::ArbitratedReceiver> receiver;
+};
+
+}  // namespace
+
+TEST_CASE("Arbitrated receiver fails over within a few frame intervals") {
+  Rig rig;
+  REQUIRE(rig.receiver->Initialize());
+  CHECK_FALSE(rig.receiver->Read().has_value());
+
+  for (int i = 0; i < 100; ++i) {
+    auto frame = rig.Tick();
+    if (frame) {
+      CHECK(frame->channels[3] == 1.0f);
+    }
+  }
+  CHECK(rig.receiver->ActiveLink() == 0);
+  CHECK(rig.receiver->Status(0).interval_us == doctest::Approx(2000.0f));
+
+  rig.tether.up = false;
+  const rx::CommandFrame first = rig.RunUntilRadio();
+  const uint64_t failover_us = rig.time.now_us - rig.tether.last_sent_us;
+  MESSAGE("failover after " << failover_us << " us");
+  // Three missed 2 ms frames plus at most one tick.
+  CHECK(failover_us <= 3 * 2000 + 1000);
+  CHECK(first.channels[3] == 2.0f);
+  CHECK_FALSE(first.failsafe);
+  CHECK(rig.receiver->Switches() == 2);  // none -> tether -> radio
+}
+
+TEST_CASE("Links stamping their own clocks are judged on the arbitrator's clock") {
+  Rig rig;
+  rig.tether.clock_offset_us = 5000000;
+  REQUIRE(rig.receiver->Initialize());
+  for (int i = 0; i < 100; ++i) {
+    rig.Tick();
+  }
+  CHECK(rig.receiver->ActiveLink() == 0);
+  CHECK(rig.receiver->Status(0).fresh);
+  CHECK(rig.receiver->Status(0).interval_us == doctest::Approx(2000.0f));
+
+  rig.tether.up = false;
+  rig.RunUntilRadio();
+  CHECK(rig.time.now_us - rig.tether.last_sent_us <= 3 * 2000 + 1000);
+}
+
+TEST_CASE("Timeout-only staleness fails over much later") {
+  Rig rig(1000.0f);
+  REQUIRE(rig.receiver->Initialize());
+  for (int i = 0; i < 100; ++i) {
+    rig.Tick();
+  }
+  rig.tether.up = false;
+  rig.RunUntilRadio();
+  CHECK(rig.time.now_us - rig.tether.last_sent_us > 90000);
+}
+
+TEST_CASE("Recovered link takes over again only after a streak of frames") {
+  Rig rig;
+  REQUIRE(rig.receiver->Initialize());
+  for (int i = 0; i < 50; ++i) {
+    rig.Tick();
+  }
+  rig.tether.up = false;
+  rig.RunUntilRadio();
+
+  rig.tether.up = true;
+  const uint64_t restored_us = rig.time.now_us;
+  int ticks = 0;
+  while (rig.receiver->ActiveLink() != 0 && ticks < 100) {
+    rig.Tick();
+    ++ticks;
+  }
+  CHECK(rig.receiver->ActiveLink() == 0);
+  // Three frames span two intervals; the first can land in the next tick.
+  CHECK(rig.time.now_us - restored_us >= 2 * 2000);
+  CHECK(rig.time.now_us - restored_us <= 3 * 2000 + 1000);
+}
+
+TEST_CASE("All links down yields failsafe until a link returns") {
+  Rig rig;
+  REQUIRE(rig.receiver->Initialize());
+  for (int i = 0; i < 20; ++i) {
+    rig.Tick();
+  }
+  rig.tether.up = false;
+  rig.radio.up = false;
+  bool failsafe = false;
+  for (int i = 0; i < 50 && !failsafe; ++i) {
+    auto frame = rig.Tick();
+    failsafe = frame && frame->failsafe;
+  }
+  CHECK(failsafe);
+  CHECK(rig.receiver->ActiveLink() == -1);
+
+  rig.radio.up = true;
+  const auto frame = rig.RunUntilRadio();
+  CHECK(frame.channels[3] == 2.0f);
+}
+
+TEST_CASE("Links reporting failsafe are passed over") {
+  Rig rig;
+  REQUIRE(rig.receiver->Initialize());
+  for (int i = 0; i < 20; ++i) {
+    rig.Tick();
+  }
+  // The radio is fresh but its receiver reports failsafe.
+  rig.radio.failsafe = true;
+  rig.tether.up = false;
+  bool failsafe = false;
+  for (int i = 0; i < 20 && !failsafe; ++i) {
+    auto frame = rig.Tick();
+    failsafe = frame && frame->failsafe;
+  }
+  CHECK(failsafe);
+  CHECK(rig.receiver->ActiveLink() == -1);
+}
+
+TEST_CASE("A fresh but lossy link loses to a clean one") {
+  Rig rig(3.0f, 0.7f);
+  REQUIRE(rig.receiver->Initialize());
+  // Every other tether frame is lost: still fresh (4 ms < 3 x 2 ms), but
+  // the sequence gaps pull its quality towards 0.5.
+  rig.tether.keep_every = 2;
+  for (int i = 0; i < 200; ++i) {
+    rig.Tick();
+  }
+  CHECK(rig.receiver->Status(0).fresh);
+  CHECK(rig.receiver->Status(0).quality < 0.7f);
+  CHECK(rig.receiver->Status(0).lost >= 49);
+  CHECK(rig.receiver->ActiveLink() == 1);
+
+  rig.radio.up = false;
+  for (int i = 0; i < 20; ++i) {
+    rig.Tick();
+  }
+  // With nothing better fresh, the lossy link is still used.
+  CHECK(rig.receiver->ActiveLink() == 0);
+}
+
+namespace {
+
+class QueueReceiver final : public rx::ICommandReceiver {
+ public:
+  bool Initialize() override { return true; }
+  std::optional<rx::CommandFrame> Read() override {
+    if (pending.empty()) {
+      return std::nullopt;
+    }
+    auto frame = pending.front();
+    pending.pop_front();
+    return frame;
+  }
+  std::deque<rx::CommandFrame> pending;
+};
+
+}  // namespace
+
+TEST_CASE("Vehicle holds a neutral setpoint on a failsafe frame") {
+  QueueReceiver receiver;
+  flight::test::NullEstimator estimator;
+  flight::controllers::RovController controller({});
+  flight::test::NullOutput output;
+  flight::test::CapturingSink sink;
+  flight::vehicle::VehicleDependencies deps;
+  deps.estimator = &estimator;
+  deps.controller = &controller;
+  deps.actuators = &output;
+  deps.receiver = &receiver;
+  deps.telemetry_sink = &sink;
+  flight::vehicle::Rov4Vehicle vehicle(deps);
+  REQUIRE(vehicle.Initialize());
+
+  rx::CommandFrame command{};
+  command.channel_count = 3;
+  command.channels[0] = 0.5f;
+  rx::CommandFrame failsafe{};
+  failsafe.failsafe = true;
+
+  receiver.pending = {command};
+  vehicle.Update(0.01f);
+  CHECK(sink.last.setpoint.velocity_mps.x == doctest::Approx(0.5f));
+
+  // The older valid command in the same batch must not be used either.
+  receiver.pending = {command, failsafe};
+  vehicle.Update(0.01f);
+  CHECK(sink.last.setpoint.velocity_mps.x == 0.0f);
+}
@@ -0,0 +1,108 @@
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "flight/core/spsc_ring.h"
+#include "flight/telemetry/async_telemetry.h"
+#include "test_fakes.h"
+
+namespace {
+
+struct Pair {
+  uint64_t a = 0;
+  uint64_t b = 0;
+};
+
+flight::telemetry::TelemetrySnapshot Snapshot(uint32_t sequence) {
+  flight::telemetry::TelemetrySnapshot snapshot;
+  snapshot.command_sequence = sequence;
+  return snapshot;
+}
+
+}  // namespace
+
+TEST_CASE("SPSC ring with kDropOldest overwrites the oldest items when full") {
+  flight::core::SpscRing<Pair, 4> ring(flight::core::DropPolicy::kDropOldest);
+  Pair out{};
+  CHECK_FALSE(ring.Pop(out));
+  for (uint64_t i = 1; i <= 6; ++i) {
+    CHECK(ring.Push({i, i}));
+  }
+  for (uint64_t expected = 3; expected <= 6; ++expected) {
+    REQUIRE(ring.Pop(out));
+    CHECK(out.a == expected);
+  }
+  CHECK_FALSE(ring.Pop(out));
+  CHECK(ring.Dropped() == 2);
+  CHECK(ring.Pushed() == 6);
+}
+
+TEST_CASE("Overwriting SPSC ring never returns a torn or reordered item") {
+  flight::core::SpscRing<Pair, 8> ring(flight::core::DropPolicy::kDropOldest);
+  constexpr uint64_t kItems = 200000;
+  std::thread producer([&] {
+    for (uint64_t i = 1; i <= kItems; ++i) {
+      ring.Push({i, ~i});
+    }
+  });
+
+  uint64_t received = 0;
+  uint64_t last = 0;
+  bool intact = true;
+  Pair out{};
+  while (last != kItems) {
+    if (!ring.Pop(out)) {
+      std::this_thread::yield();
+      continue;
+    }
+    intact = intact && out.b == ~out.a && out.a > last;
+    last = out.a;
+    ++received;
+  }
+  producer.join();
+  CHECK(intact);
+  CHECK(received + ring.Dropped() == kItems);
+}
+
+TEST_CASE("Async telemetry sink forwards snapshots on its own thread") {
+  flight::test::CountingSink sink;
+  flight::telemetry::AsyncTelemetrySink async(sink, {200, -1});
+  REQUIRE(async.Initialize());
+  REQUIRE(async.Start());
+  for (uint32_t i = 1; i <= 10; ++i) {
+    async.Publish(Snapshot(i));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  async.Stop();
+  CHECK(sink.count.load() + static_cast<int>(async.Dropped()) == 10);
+  CHECK(async.Forwarded() == static_cast<uint64_t>(sink.count.load()));
+  CHECK(sink.last_sequence == 10);
+  CHECK(sink.thread != std::this_thread::get_id());
+}
+
+TEST_CASE("Async telemetry sink can keep the oldest snapshots instead") {
+  flight::test::CountingSink sink;
+  flight::telemetry::AsyncTelemetrySink async(sink, {200, -1, flight::core::DropPolicy::kDropNewest});
+  const uint32_t total = flight::telemetry::AsyncTelemetrySink::kQueueDepth + 5;
+  for (uint32_t i = 1; i <= total; ++i) {
+    async.Publish(Snapshot(i));
+  }
+  CHECK(async.Drain() == flight::telemetry::AsyncTelemetrySink::kQueueDepth);
+  CHECK(async.Dropped() == 5);
+  CHECK(sink.last_sequence == flight::telemetry::AsyncTelemetrySink::kQueueDepth);
+}
+
+TEST_CASE("Async telemetry sink keeps the newest snapshots without a consumer") {
+  flight::test::CountingSink sink;
+  flight::telemetry::AsyncTelemetrySink async(sink);
+  const uint32_t total = flight::telemetry::AsyncTelemetrySink::kQueueDepth + 5;
+  for (uint32_t i = 1; i <= total; ++i) {
+    async.Publish(Snapshot(i));
+  }
+  CHECK(async.Drain() == flight::telemetry::AsyncTelemetrySink::kQueueDepth);
+  CHECK(async.Dropped() == 5);
+  CHECK(sink.last_sequence == total);
+  CHECK(async.Drain() == 0);
+}
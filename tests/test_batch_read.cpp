@@ -0,0 +1,70 @@
+#include <doctest/doctest.h>
+
+#include <deque>
+
+#include "flight/actuators/telemetry.h"
+#include "flight/receiver/null_receiver.h"
+#include "flight/sensors/sensors.h"
+
+namespace {
+
+class QueueImu final : public flight::sensors::IImu {
+ public:
+  bool Initialize() override { return true; }
+  std::optional<flight::sensors::ImuSample> Read() override {
+    if (pending.empty()) {
+      return std::nullopt;
+    }
+    auto sample = pending.front();
+    pending.pop_front();
+    return sample;
+  }
+
+  std::deque<flight::sensors::ImuSample> pending;
+};
+
+class QueueTelemetry final : public flight::actuators::ITelemetryReceiver {
+ public:
+  bool Initialize() override { return true; }
+  std::optional<flight::actuators::DshotTelemetryFrame> Read() override {
+    if (remaining == 0) {
+      return std::nullopt;
+    }
+    flight::actuators::DshotTelemetryFrame frame{};
+    frame.channel = static_cast<uint8_t>(4 - remaining);
+    --remaining;
+    return frame;
+  }
+
+  int remaining = 4;
+};
+
+}  // namespace
+
+TEST_CASE("Default ReadBatch drains single-item drivers in order") {
+  QueueImu imu;
+  for (int i = 0; i < 5; ++i) {
+    flight::sensors::ImuSample sample{};
+    sample.timestamp_us = static_cast<uint64_t>(i);
+    imu.pending.push_back(sample);
+  }
+
+  flight::sensors::ImuSample out[3];
+  REQUIRE(imu.ReadBatch(out, 3) == 3);
+  CHECK(out[0].timestamp_us == 0);
+  CHECK(out[2].timestamp_us == 2);
+  CHECK(imu.ReadBatch(out, 3) == 2);
+  CHECK(out[1].timestamp_us == 4);
+  CHECK(imu.ReadBatch(out, 3) == 0);
+}
+
+TEST_CASE("Default ReadBatch covers receivers and ESC telemetry") {
+  QueueTelemetry telemetry;
+  flight::actuators::DshotTelemetryFrame frames[8];
+  REQUIRE(telemetry.ReadBatch(frames, 8) == 4);
+  CHECK(frames[3].channel == 3);
+
+  flight::receiver::NullReceiver receiver;
+  flight::receiver::CommandFrame commands[2];
+  CHECK(receiver.ReadBatch(commands, 2) == 0);
+}
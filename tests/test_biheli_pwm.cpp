@@ -1,5 +1,6 @@
 #include <doctest/doctest.h>
 
+#include "fake_pwm.h"
 #include "flight/actuators/biheli_pwm_output.h"
 
 TEST_CASE("Biheli PWM maps normalized values") {
@@ -15,3 +16,52 @@ TEST_CASE("Biheli PWM maps normalized values") {
   CHECK(output.PulseUs(1) == doctest::Approx(1500.0f));
   CHECK(output.PulseUs(2) == doctest::Approx(1900.0f));
 }
+
+TEST_CASE("Biheli PWM drives hardware slices with latched levels") {
+  flight::test::FakePwm pwm;
+  flight::actuators::BiheliPwmOutput::Config config{};
+  config.update_rate_hz = 490.0f;
+  config.channel_count = 4;
+  const uint32_t pins[4] = {2, 3, 6, 7};
+  for (uint8_t i = 0; i < 4; ++i) {
+    config.pins[i] = pins[i];
+  }
+  flight::actuators::BiheliPwmOutput output(config, &pwm);
+  REQUIRE(output.Initialize());
+
+  // Two slices, configured once each, started with a single enable.
+  CHECK(pwm.configure_calls == 2);
+  CHECK(pwm.enable_calls == 1);
+  CHECK(pwm.enable_masks[0] == 0b1010);
+  CHECK(pwm.pin_mask == 0b11001100);
+  CHECK(pwm.slices[1].divider == 5);
+  CHECK(pwm.slices[1].top == pwm.slices[3].top);
+
+  const auto& timing = output.Timing();
+  const uint16_t neutral = flight::actuators::PulseToLevel(1500.0f, timing);
+  CHECK(pwm.slices[1].pending[0] == neutral);
+
+  flight::actuators::ActuatorCommand commands[4];
+  commands[0].value = 1.0f;
+  commands[1].value = -1.0f;
+  commands[2].value = 0.5f;
+  commands[3].value = 0.0f;
+  REQUIRE(output.Write(commands, 4));
+  // Nothing changes on the pins until the frame ends.
+  CHECK(pwm.slices[1].active[0] == 0);
+  pwm.Wrap();
+  CHECK(pwm.slices[1].active[0] == flight::actuators::PulseToLevel(1900.0f, timing));
+  CHECK(pwm.slices[1].active[1] == flight::actuators::PulseToLevel(1100.0f, timing));
+  CHECK(pwm.slices[3].active[0] == flight::actuators::PulseToLevel(1700.0f, timing));
+  CHECK(pwm.slices[3].active[1] == neutral);
+}
+
+TEST_CASE("Biheli PWM rejects rates whose period is shorter than the pulse") {
+  flight::test::FakePwm pwm;
+  flight::actuators::BiheliPwmOutput::Config config{};
+  config.update_rate_hz = 600.0f;
+  config.channel_count = 1;
+  config.pins[0] = 2;
+  flight::actuators::BiheliPwmOutput output(config, &pwm);
+  CHECK_FALSE(output.Initialize());
+}
@@ -0,0 +1,68 @@
+#include <doctest/doctest.h>
+
+#include <cmath>
+
+#include "flight/controllers/cascaded_controller.h"
+
+using flight::controllers::CascadedController;
+namespace ctl = flight::controllers;
+
+TEST_CASE("Cascaded controller runs each level at its own rate") {
+  CascadedController controller;
+  REQUIRE(controller.Initialize());
+  for (int i = 0; i < 1000; ++i) {
+    controller.Update({}, {}, 0.001f);
+  }
+  CHECK(controller.StepCount(CascadedController::kRateLevel) == 1000);
+  CHECK(controller.StepCount(CascadedController::kAttitudeLevel) == 250);
+  CHECK(controller.StepCount(CascadedController::kVelocityLevel) == 50);
+}
+
+TEST_CASE("Cascaded controller closes the yaw rate loop") {
+  CascadedController controller;
+  controller.Initialize();
+  ctl::ControlSetpoint setpoint{};
+  setpoint.body_rates_rps.z = 0.5f;
+
+  flight::core::Pose pose{};
+  auto output = controller.Update(pose, setpoint, 0.001f);
+  const float yaw_from_rest = controller.Demand().axis[ctl::kYaw];
+  CHECK(yaw_from_rest > 0.0f);
+  CHECK(output.motor_count == 4);
+  CHECK(output.motors[0] > output.motors[1]);
+
+  // Once the vehicle turns at the commanded rate only feed-forward and
+  // integral remain.
+  pose.angular_velocity_rps.z = 0.5f;
+  controller.Update(pose, setpoint, 0.001f);
+  CHECK(controller.Demand().axis[ctl::kYaw] < yaw_from_rest);
+}
+
+TEST_CASE("Cascaded controller levels a rolled vehicle") {
+  CascadedController controller;
+  controller.Initialize();
+  flight::core::Pose pose{};
+  const float half = 0.1f;  // 0.2 rad roll
+  pose.orientation = {std::cos(half), std::sin(half), 0.0f, 0.0f};
+  controller.Update(pose, {}, 0.004f);
+  CHECK(controller.Demand().axis[ctl::kRoll] < 0.0f);
+}
+
+TEST_CASE("Cascaded controller holds depth and tracks surge velocity") {
+  CascadedController controller;
+  controller.Initialize();
+  flight::core::Pose pose{};
+  pose.position_m.z = -2.0f;
+  ctl::ControlSetpoint setpoint{};
+  setpoint.velocity_mps.x = 0.3f;
+
+  controller.Update(pose, setpoint, 0.02f);
+  CHECK(controller.DepthTarget() == doctest::Approx(-2.0f));
+  CHECK(controller.Demand().axis[ctl::kHeave] == doctest::Approx(0.0f));
+  CHECK(controller.Demand().axis[ctl::kSurge] > 0.3f);
+
+  // Sinking below the held depth commands upward heave.
+  pose.position_m.z = -2.5f;
+  controller.Update(pose, setpoint, 0.02f);
+  CHECK(controller.Demand().axis[ctl::kHeave] > 0.0f);
+}
@@ -0,0 +1,350 @@
+#include <doctest/doctest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <thread>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include "flight/controllers/rov_controller.h"
+#include "flight/receiver/command_protocol.h"
+#include "flight/receiver/udp_receiver.h"
+#include "flight/telemetry/latency_histogram.h"
+#include "flight/vehicle/rov4_vehicle.h"
+#include "test_fakes.h"
+
+namespace rx = flight::receiver;
+using flight::test::ManualTime;
+
+TEST_CASE("Command protocol decodes v1 and v2 packets") {
+  rx::CommandPacketV1 v1{};
+  v1.channel_count = 2;
+  v1.channels[1] = -0.5f;
+  rx::CommandFrame frame{};
+  REQUIRE(rx::DecodeCommandPacket(&v1, sizeof(v1), frame));
+  CHECK(frame.channel_count == 2);
+  CHECK(frame.channels[1] == doctest::Approx(-0.5f));
+  CHECK(frame.sequence == 0);
+  CHECK(frame.sent_us == 0);
+
+  rx::CommandFrame source{};
+  source.channel_count = 3;
+  source.channels[2] = 0.25f;
+  source.sequence = 77;
+  source.sent_us = 123456789;
+  const rx::CommandPacketV2 v2 = rx::EncodeCommandPacket(source);
+  REQUIRE(rx::DecodeCommandPacket(&v2, sizeof(v2), frame));
+  CHECK(frame.sequence == 77);
+  CHECK(frame.sent_us == 123456789);
+  CHECK(frame.channels[2] == doctest::Approx(0.25f));
+
+  rx::CommandPacketV2 bad = v2;
+  bad.version = 9;
+  CHECK_FALSE(rx::DecodeCommandPacket(&bad, sizeof(bad), frame));
+  CHECK_FALSE(rx::DecodeCommandPacket(&v2, 4, frame));
+}
+
+TEST_CASE("Compact packets send only non-zero channels as int16") {
+  CHECK(rx::Crc16Ccitt("123456789", 9) == 0x29B1);
+  CHECK(rx::QuantizeChannel(1.5f) == 32767);
+  CHECK(rx::QuantizeChannel(-1.0f) == -32767);
+  CHECK(rx::QuantizeChannel(NAN) == 0);
+
+  rx::CommandFrame source{};
+  source.channel_count = 6;
+  source.channels[0] = 0.2f;
+  source.channels[2] = -0.75f;
+  source.channels[5] = 1.0f;
+  source.sequence = 9;
+  source.sent_us = 5555;
+  uint8_t buffer[rx::kMaxCompactCommandPacket];
+  const size_t length = rx::EncodeCompactCommandPacket(source, buffer, sizeof(buffer));
+  CHECK(length == rx::kCompactHeaderBytes + 3 * 2 + 2);
+  CHECK(rx::EncodeCompactCommandPacket(source, buffer, length - 1) == 0);
+
+  rx::CommandFrame frame{};
+  REQUIRE(rx::DecodeCommandPacket(buffer, length, frame));
+  CHECK(frame.channel_count == 6);
+  CHECK(frame.sequence == 9);
+  CHECK(frame.sent_us == 5555);
+  for (uint8_t i = 0; i < 16; ++i) {
+    CHECK(frame.channels[i] == doctest::Approx(source.channels[i]).epsilon(2e-5));
+  }
+
+  buffer[rx::kCompactHeaderBytes] ^= 0x01;
+  CHECK_FALSE(rx::DecodeCommandPacket(buffer, length, frame));
+}
+
+TEST_CASE("Compact decoder rejects malformed packets") {
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int> byte(0, 255);
+  uint8_t valid[rx::kMaxCompactCommandPacket];
+  uint8_t packet[rx::kMaxCommandDatagram];
+  uint32_t accepted = 0;
+
+  for (int round = 0; round < 20000; ++round) {
+    rx::CommandFrame source{};
+    source.channel_count = static_cast<uint8_t>(byte(rng) % 17);
+    for (uint8_t i = 0; i < source.channel_count; ++i) {
+      source.channels[i] = (byte(rng) % 3 == 0) ? 0.0f : (byte(rng) - 128) / 128.0f;
+    }
+    const size_t length = rx::EncodeCompactCommandPacket(source, valid, sizeof(valid));
+    REQUIRE(length > 0);
+    std::memcpy(packet, valid, length);
+
+    // Flip bytes, truncate, extend or replace the body with noise.
+    size_t mutated = length;
+    switch (round % 4) {
+      case 0:
+        packet[byte(rng) % length] ^= static_cast<uint8_t>(1 + byte(rng) % 255);
+        break;
+      case 1:
+        mutated = static_cast<size_t>(byte(rng)) % length;
+        break;
+      case 2:
+        mutated = length + 1 + static_cast<size_t>(byte(rng)) % (sizeof(packet) - length);
+        for (size_t i = length; i < mutated; ++i) {
+          packet[i] = static_cast<uint8_t>(byte(rng));
+        }
+        break;
+      default:
+        for (size_t i = 5; i < length; ++i) {
+          packet[i] = static_cast<uint8_t>(byte(rng));
+        }
+        break;
+    }
+
+    rx::CommandFrame frame{};
+    if (rx::DecodeCommandPacket(packet, mutated, frame)) {
+      ++accepted;
+      CHECK(frame.channel_count <= 16);
+      for (float value : frame.channels) {
+        CHECK(std::fabs(value) <= 1.0001f);
+      }
+    }
+  }
+  // Only a CRC collision on the random-body rounds can get through.
+  CHECK(accepted < 10);
+}
+
+TEST_CASE("Sequence comparison survives wrap") {
+  CHECK(rx::IsNewerSequence(5, 4));
+  CHECK_FALSE(rx::IsNewerSequence(4, 4));
+  CHECK(rx::IsNewerSequence(2, 0xFFFFFFF0u));
+  CHECK_FALSE(rx::IsNewerSequence(0xFFFFFFF0u, 2));
+}
+
+TEST_CASE("Clock offset estimate from one exchange") {
+  // Vehicle clock is 5000 us ahead; 300 us each way; 40 us turnaround.
+  rx::TimeSyncPacket request{};
+  request.t0_us = 10000;
+  const rx::TimeSyncPacket reply = rx::MakeTimeSyncReply(request, 15300, 15340);
+  CHECK(reply.kind == rx::TimeSyncPacket::kReply);
+  const auto sample = rx::EstimateClockOffset(reply, 10640);
+  CHECK(sample.offset_us == 5000);
+  CHECK(sample.round_trip_us == 600);
+}
+
+TEST_CASE("Latency histogram buckets by powers of two") {
+  flight::telemetry::LatencyHistogram histogram;
+  histogram.Add(0);
+  histogram.Add(3);
+  histogram.Add(700);
+  histogram.Add(900);
+  CHECK(histogram.Bucket(0) == 1);
+  CHECK(histogram.Bucket(2) == 1);
+  CHECK(histogram.Bucket(10) == 2);
+  CHECK(flight::telemetry::LatencyHistogram::BucketLowerUs(10) == 512);
+  CHECK(histogram.Count() == 4);
+  CHECK(histogram.MaxUs() == 900);
+  CHECK(histogram.PercentileUs(0.5f) == 4);
+  CHECK(histogram.PercentileUs(1.0f) == 1024);
+}
+
+TEST_CASE("UDP receiver answers time sync and orders v2 frames by sequence") {
+#if defined(__linux__)
+  ManualTime time(1000000);
+  rx::UdpReceiver receiver({14554, &time});
+  REQUIRE(receiver.Initialize());
+
+  int sock = ::socket(AF_INET, SOCK_DGRAM, 0);
+  REQUIRE(sock >= 0);
+  timeval timeout{0, 200000};
+  setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(14554);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  auto send = [&](const void* data, size_t size) {
+    ::sendto(sock, data, size, 0, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+  };
+
+  rx::TimeSyncPacket request{};
+  request.id = 7;
+  request.t0_us = 42;
+  send(&request, sizeof(request));
+
+  rx::CommandFrame frame{};
+  frame.channel_count = 3;
+  for (uint32_t seq : {10u, 12u, 11u}) {
+    frame.sequence = seq;
+    frame.sent_us = time.now_us - 250;
+    frame.channels[0] = static_cast<float>(seq);
+    const auto packet = rx::EncodeCommandPacket(frame);
+    send(&packet, sizeof(packet));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  const auto latest = receiver.Read();
+  REQUIRE(latest.has_value());
+  CHECK(latest->sequence == 12);
+  CHECK(latest->sent_us == time.now_us - 250);
+  CHECK(latest->received_us <= time.now_us);
+  CHECK(receiver.LastDrain().time_sync == 1);
+  CHECK(receiver.LastDrain().out_of_order == 1);
+  CHECK(receiver.LastDrain().dropped == 1);
+
+  rx::TimeSyncPacket reply{};
+  REQUIRE(::recv(sock, &reply, sizeof(reply), 0) == sizeof(reply));
+  CHECK(reply.kind == rx::TimeSyncPacket::kReply);
+  CHECK(reply.id == 7);
+  CHECK(reply.t0_us == 42);
+  CHECK(reply.t2_us == time.now_us);
+  CHECK(reply.t1_us <= reply.t2_us);
+
+  ::close(sock);
+#else
+  CHECK(true);
+#endif
+}
+
+TEST_CASE("UDP receiver resyncs after a ground-station restart") {
+#if defined(__linux__)
+  ManualTime time(1000000);
+  rx::UdpReceiver receiver({14557, &time});
+  REQUIRE(receiver.Initialize());
+
+  int sock = ::socket(AF_INET, SOCK_DGRAM, 0);
+  REQUIRE(sock >= 0);
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(14557);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  auto send = [&](uint32_t sequence) {
+    rx::CommandFrame frame{};
+    frame.channel_count = 3;
+    frame.sequence = sequence;
+    const auto packet = rx::EncodeCommandPacket(frame);
+    ::sendto(sock, &packet, sizeof(packet), 0, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  };
+
+  send(5000);
+  REQUIRE(receiver.Read().has_value());
+
+  // Small step back: reordering, still dropped.
+  send(4990);
+  CHECK_FALSE(receiver.Read().has_value());
+  CHECK(receiver.LastDrain().out_of_order == 1);
+
+  // Sender restarted from zero: far behind, accepted immediately.
+  send(0);
+  auto frame = receiver.Read();
+  REQUIRE(frame.has_value());
+  CHECK(frame->sequence == 0);
+  CHECK(receiver.LastDrain().resyncs == 1);
+  send(1);
+  REQUIRE(receiver.Read().has_value());
+
+  // A small step back is accepted once the link has been silent past the timeout.
+  send(50);
+  REQUIRE(receiver.Read().has_value());
+  time.now_us += 200000;
+  send(40);
+  frame = receiver.Read();
+  REQUIRE(frame.has_value());
+  CHECK(frame->sequence == 40);
+  CHECK(receiver.LastDrain().resyncs == 1);
+
+  ::close(sock);
+#else
+  CHECK(true);
+#endif
+}
+
+namespace {
+
+class OneFrameReceiver final : public rx::ICommandReceiver {
+ public:
+  bool Initialize() override { return true; }
+  std::optional<rx::CommandFrame> Read() override {
+    if (!pending) {
+      return std::nullopt;
+    }
+    pending = false;
+    return frame;
+  }
+  rx::CommandFrame frame{};
+  bool pending = false;
+};
+
+/** @brief Actuator whose write takes 150 us of the manual clock. */
+class SlowOutput final : public flight::actuators::IActuatorOutput {
+ public:
+  explicit SlowOutput(ManualTime& time) : time_(time) {}
+  bool Initialize() override { return true; }
+  bool Write(const flight::actuators::ActuatorCommand*, uint8_t) override {
+    time_.SleepUs(150);
+    return true;
+  }
+
+ private:
+  ManualTime& time_;
+};
+
+}  // namespace
+
+TEST_CASE("Vehicle echoes the applied command and records its latency") {
+  ManualTime time(1000000);
+  OneFrameReceiver receiver;
+  flight::test::NullEstimator estimator;
+  flight::controllers::RovController controller({});
+  SlowOutput output(time);
+  flight::test::CapturingSink sink;
+
+  flight::vehicle::VehicleDependencies deps;
+  deps.estimator = &estimator;
+  deps.controller = &controller;
+  deps.actuators = &output;
+  deps.receiver = &receiver;
+  deps.telemetry_sink = &sink;
+  deps.time = &time;
+  flight::vehicle::Rov4Vehicle vehicle(deps);
+  REQUIRE(vehicle.Initialize());
+
+  receiver.frame.channel_count = 3;
+  receiver.frame.sequence = 5;
+  receiver.frame.sent_us = time.now_us - 800;
+  receiver.frame.received_us = time.now_us - 100;
+  receiver.pending = true;
+  vehicle.Update(0.002f);
+
+  CHECK(sink.last.command_sequence == 5);
+  CHECK(sink.last.command_sent_us == receiver.frame.sent_us);
+  CHECK(sink.last.actuator_write_us == time.now_us);
+  CHECK(vehicle.UplinkLatency().Count() == 1);
+  CHECK(vehicle.UplinkLatency().MaxUs() == 700);
+  CHECK(vehicle.PipelineLatency().MaxUs() == 250);
+
+  // The same frame again (no new command) is not counted twice.
+  receiver.pending = true;
+  vehicle.Update(0.002f);
+  CHECK(vehicle.PipelineLatency().Count() == 1);
+}
@@ -0,0 +1,117 @@
+#include <doctest/doctest.h>
+
+#include <cmath>
+
+#include "flight/controllers/control_allocator.h"
+
+using flight::controllers::ControlAllocator;
+using flight::controllers::Wrench;
+namespace ctl = flight::controllers;
+
+namespace {
+
+/** @brief Vectored 4 horizontal + 4 vertical frame (all six axes actuated). */
+ControlAllocator::Config HeavyFrame() {
+  ControlAllocator::Config config{};
+  constexpr float kS = 0.70710678f;
+  ControlAllocator::SetThruster(config, 0, {0.15f, 0.10f, 0.0f}, {kS, -kS, 0.0f});
+  ControlAllocator::SetThruster(config, 1, {0.15f, -0.10f, 0.0f}, {kS, kS, 0.0f});
+  ControlAllocator::SetThruster(config, 2, {-0.15f, 0.10f, 0.0f}, {kS, kS, 0.0f});
+  ControlAllocator::SetThruster(config, 3, {-0.15f, -0.10f, 0.0f}, {kS, -kS, 0.0f});
+  ControlAllocator::SetThruster(config, 4, {0.12f, 0.20f, 0.0f}, {0.0f, 0.0f, 1.0f});
+  ControlAllocator::SetThruster(config, 5, {0.12f, -0.20f, 0.0f}, {0.0f, 0.0f, 1.0f});
+  ControlAllocator::SetThruster(config, 6, {-0.12f, 0.20f, 0.0f}, {0.0f, 0.0f, 1.0f});
+  ControlAllocator::SetThruster(config, 7, {-0.12f, -0.20f, 0.0f}, {0.0f, 0.0f, 1.0f});
+  return config;
+}
+
+}  // namespace
+
+TEST_CASE("Control allocator default geometry is the classic ROV mix") {
+  ControlAllocator allocator;
+  REQUIRE(allocator.Valid());
+  CHECK(allocator.Inverse(0, ctl::kSurge) == doctest::Approx(1.0f).epsilon(1e-4));
+  CHECK(allocator.Inverse(1, ctl::kYaw) == doctest::Approx(-1.0f).epsilon(1e-4));
+  CHECK(allocator.Inverse(2, ctl::kHeave) == doctest::Approx(1.0f).epsilon(1e-4));
+  CHECK(allocator.Inverse(2, ctl::kSurge) == doctest::Approx(0.0f));
+}
+
+TEST_CASE("Control allocator keeps yaw when surge saturates") {
+  ControlAllocator allocator;
+  Wrench wrench{};
+  wrench.axis[ctl::kSurge] = 1.0f;
+  wrench.axis[ctl::kYaw] = 0.5f;
+  float commands[ControlAllocator::kMaxThrusters] = {};
+  REQUIRE(allocator.Allocate(wrench, commands) == 4);
+
+  // Clamping each motor would give 1.0 / 0.5 and only half the yaw.
+  CHECK(commands[0] == doctest::Approx(1.0f));
+  CHECK(commands[1] == doctest::Approx(0.0f));
+  CHECK(allocator.Achieved().axis[ctl::kYaw] == doctest::Approx(0.5f));
+  CHECK(allocator.Achieved().axis[ctl::kSurge] == doctest::Approx(0.5f));
+}
+
+TEST_CASE("Control allocator reproduces an unsaturated wrench on eight thrusters") {
+  ControlAllocator allocator(HeavyFrame());
+  REQUIRE(allocator.Valid());
+  Wrench wrench{};
+  wrench.axis[ctl::kSurge] = 0.8f;
+  wrench.axis[ctl::kSway] = -0.3f;
+  wrench.axis[ctl::kHeave] = 1.2f;
+  wrench.axis[ctl::kRoll] = 0.05f;
+  wrench.axis[ctl::kPitch] = -0.04f;
+  wrench.axis[ctl::kYaw] = 0.06f;
+  float commands[ControlAllocator::kMaxThrusters] = {};
+  REQUIRE(allocator.Allocate(wrench, commands) == 8);
+
+  for (uint8_t a = 0; a < ctl::kWrenchAxes; ++a) {
+    CHECK(allocator.Achieved().axis[a] == doctest::Approx(wrench.axis[a]).epsilon(1e-3));
+  }
+  for (uint8_t t = 0; t < 8; ++t) {
+    CHECK(std::fabs(commands[t]) <= 1.0f);
+  }
+}
+
+TEST_CASE("Control allocator preserves heave and scales surge under saturation") {
+  ControlAllocator allocator(HeavyFrame());
+  Wrench wrench{};
+  wrench.axis[ctl::kSurge] = 5.0f;
+  wrench.axis[ctl::kHeave] = 3.0f;
+  wrench.axis[ctl::kYaw] = 0.1f;
+  float commands[ControlAllocator::kMaxThrusters] = {};
+  allocator.Allocate(wrench, commands);
+
+  for (uint8_t t = 0; t < 8; ++t) {
+    CHECK(std::fabs(commands[t]) <= doctest::Approx(1.0f));
+  }
+  const Wrench& achieved = allocator.Achieved();
+  CHECK(achieved.axis[ctl::kHeave] == doctest::Approx(3.0f).epsilon(1e-3));
+  CHECK(achieved.axis[ctl::kYaw] == doctest::Approx(0.1f).epsilon(1e-3));
+  CHECK(achieved.axis[ctl::kSurge] > 1.0f);
+  CHECK(achieved.axis[ctl::kSurge] < 5.0f);
+  CHECK(achieved.axis[ctl::kSway] == doctest::Approx(0.0f).epsilon(1e-3));
+}
+
+TEST_CASE("Control allocator redistributes onto unsaturated thrusters") {
+  ControlAllocator::Config config{};
+  config.thruster_count = 3;
+  config.geometry[ctl::kHeave][0] = 1.0f;
+  config.geometry[ctl::kHeave][1] = 1.0f;
+  config.geometry[ctl::kHeave][2] = 0.5f;
+  ControlAllocator allocator(config);
+  Wrench wrench{};
+  wrench.axis[ctl::kHeave] = 2.4f;
+  float commands[3] = {};
+  allocator.Allocate(wrench, commands);
+
+  // Scaling the pseudo-inverse alone stops at 2.25 with thruster 2 at 0.5.
+  CHECK(commands[0] == doctest::Approx(1.0f));
+  CHECK(commands[1] == doctest::Approx(1.0f));
+  CHECK(commands[2] == doctest::Approx(0.8f));
+  CHECK(allocator.Achieved().axis[ctl::kHeave] == doctest::Approx(2.4f));
+}
+
+TEST_CASE("Control allocator rejects empty geometry") {
+  ControlAllocator allocator(ControlAllocator::Config{});
+  CHECK_FALSE(allocator.Valid());
+}
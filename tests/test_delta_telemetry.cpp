@@ -0,0 +1,201 @@
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <vector>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include "flight/telemetry/delta_telemetry.h"
+#include "flight/telemetry/udp_telemetry.h"
+
+namespace tl = flight::telemetry;
+
+namespace {
+
+tl::TelemetrySnapshot Sample(uint32_t n) {
+  tl::TelemetrySnapshot s;
+  const float t = static_cast<float>(n) * 0.001f;
+  s.timestamp_us = 5000000 + n * 1000ull;
+  s.pose.orientation = {std::cos(t), 0.0f, 0.0f, std::sin(t)};
+  s.pose.angular_velocity_rps = {0.01f * std::sin(40 * t), -0.02f, 2.0f};
+  s.pose.position_m = {1.5f + t, -3.25f, -12.0f};
+  s.pose.velocity_mps = {1.0f, 0.0f, 0.0f};
+  s.setpoint.velocity_mps = {1.0f, 0.0f, 0.1f};
+  s.setpoint.body_rates_rps.z = 0.5f;
+  s.setpoint.thrust = 0.25f;
+  s.output.motor_count = 4;
+  for (int i = 0; i < 4; ++i) {
+    s.output.motors[i] = 0.3f + 0.1f * i + 0.05f * std::sin(10 * t);
+  }
+  if (n % 4 == 0) {
+    s.esc_telemetry = flight::actuators::DshotTelemetryFrame{static_cast<uint8_t>(n % 4), 1234,
+                                                             0xABC, true};
+  }
+  s.armed = true;
+  s.gyro_peak_hz = {123.4f, 0.0f, 56.7f};
+  s.command_sequence = 1000 + n / 20;
+  s.command_sent_us = 4999000 + (n / 20) * 20000ull;
+  s.command_received_us = s.command_sent_us + 800;
+  s.actuator_write_us = s.timestamp_us + 150;
+  return s;
+}
+
+void CheckClose(const tl::TelemetrySnapshot& a, const tl::TelemetrySnapshot& b) {
+  CHECK(a.timestamp_us == b.timestamp_us);
+  CHECK(a.pose.orientation.w == doctest::Approx(b.pose.orientation.w).epsilon(1e-4));
+  CHECK(a.pose.orientation.z == doctest::Approx(b.pose.orientation.z).epsilon(1e-4));
+  CHECK(std::fabs(a.pose.angular_velocity_rps.x - b.pose.angular_velocity_rps.x) <= 6e-4f);
+  CHECK(std::fabs(a.pose.position_m.x - b.pose.position_m.x) <= 6e-4f);
+  CHECK(a.pose.position_m.z == doctest::Approx(b.pose.position_m.z));
+  CHECK(a.setpoint.thrust == doctest::Approx(b.setpoint.thrust));
+  CHECK(a.output.motor_count == b.output.motor_count);
+  CHECK(std::fabs(a.output.motors[3] - b.output.motors[3]) <= 6e-4f);
+  CHECK(a.esc_telemetry.has_value() == b.esc_telemetry.has_value());
+  if (a.esc_telemetry && b.esc_telemetry) {
+    CHECK(a.esc_telemetry->raw == b.esc_telemetry->raw);
+    CHECK(a.esc_telemetry->crc_ok == b.esc_telemetry->crc_ok);
+  }
+  CHECK(a.armed == b.armed);
+  CHECK(a.gyro_peak_hz.x == doctest::Approx(b.gyro_peak_hz.x).epsilon(1e-3));
+  CHECK(a.command_sequence == b.command_sequence);
+  CHECK(a.command_sent_us == b.command_sent_us);
+  CHECK(a.actuator_write_us == b.actuator_write_us);
+}
+
+}  // namespace
+
+TEST_CASE("Delta telemetry round-trips a batch within quantization error") {
+  tl::DeltaTelemetryEncoder encoder;
+  std::vector<tl::TelemetrySnapshot> sent;
+  for (uint32_t n = 0; n < 20; ++n) {
+    sent.push_back(Sample(n));
+    REQUIRE(encoder.Append(sent.back()));
+  }
+  CHECK(encoder.FrameCount() == 20);
+  // 20 full v3 packets would be about 3 KB.
+  MESSAGE("20 frames in " << encoder.Size() << " bytes");
+  CHECK(encoder.Size() < 20 * 40);
+
+  tl::TelemetrySnapshot decoded[32];
+  REQUIRE(tl::DecodeDeltaTelemetry(encoder.Data(), encoder.Size(), decoded, 32) == 20);
+  for (size_t i = 0; i < sent.size(); ++i) {
+    CheckClose(decoded[i], sent[i]);
+  }
+
+  CHECK(tl::DecodeDeltaTelemetry(encoder.Data(), encoder.Size() - 1, decoded, 32) == 0);
+  std::vector<uint8_t> extended(encoder.Data(), encoder.Data() + encoder.Size());
+  extended.push_back(0);
+  CHECK(tl::DecodeDeltaTelemetry(extended.data(), extended.size(), decoded, 32) == 0);
+  extended[0] ^= 1;
+  CHECK(tl::DecodeDeltaTelemetry(extended.data(), encoder.Size(), decoded, 32) == 0);
+}
+
+TEST_CASE("Delta encoder refuses a frame that does not fit") {
+  tl::DeltaTelemetryEncoder encoder;
+  uint32_t n = 0;
+  tl::TelemetrySnapshot s = Sample(0);
+  // Large random-looking jumps make every delta frame expensive.
+  while (encoder.Append(s)) {
+    ++n;
+    s.timestamp_us += 1234567ull * n;
+    s.pose.position_m.x = static_cast<float>((n * 7919) % 100000);
+  }
+  CHECK(encoder.Size() <= tl::DeltaTelemetryEncoder::kMaxDatagram);
+  tl::TelemetrySnapshot decoded[256];
+  CHECK(tl::DecodeDeltaTelemetry(encoder.Data(), encoder.Size(), decoded, 256) == n);
+}
+
+TEST_CASE("Batched sender flushes several datagrams per sendmmsg") {
+#if defined(__linux__)
+  int rx = ::socket(AF_INET, SOCK_DGRAM, 0);
+  REQUIRE(rx >= 0);
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(14562);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  REQUIRE(::bind(rx, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0);
+  timeval timeout{0, 200000};
+  setsockopt(rx, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  tl::UdpTelemetrySender::Config config;
+  config.port = 14562;
+  config.rate_hz = 0;
+  config.batch_frames = 10;
+  config.flush_datagrams = 2;
+  tl::UdpTelemetrySender sender(config);
+  REQUIRE(sender.Initialize());
+  for (uint32_t n = 0; n < 45; ++n) {
+    sender.Publish(Sample(n));
+  }
+  CHECK(sender.Syscalls() == 2);
+  sender.Flush();
+  CHECK(sender.Syscalls() == 3);
+
+  uint32_t received = 0;
+  uint8_t buffer[2048];
+  tl::TelemetrySnapshot decoded[16];
+  for (int datagram = 0; datagram < 5; ++datagram) {
+    const ssize_t length = ::recv(rx, buffer, sizeof(buffer), 0);
+    REQUIRE(length > 0);
+    const size_t count = tl::DecodeDeltaTelemetry(buffer, static_cast<size_t>(length), decoded, 16);
+    REQUIRE(count > 0);
+    for (size_t i = 0; i < count; ++i) {
+      CHECK(decoded[i].timestamp_us == Sample(received).timestamp_us);
+      ++received;
+    }
+  }
+  CHECK(received == 45);
+  ::close(rx);
+#else
+  CHECK(true);
+#endif
+}
+
+TEST_CASE("Batched sender flushes stale samples and its queue on destruction") {
+#if defined(__linux__)
+  int rx = ::socket(AF_INET, SOCK_DGRAM, 0);
+  REQUIRE(rx >= 0);
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(14563);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  REQUIRE(::bind(rx, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0);
+  timeval timeout{0, 200000};
+  setsockopt(rx, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  uint8_t buffer[2048];
+  tl::TelemetrySnapshot decoded[32];
+  {
+    // 100 Hz into 20-frame datagrams, 8 per flush: a full flush would take 1.6 s.
+    tl::UdpTelemetrySender::Config config;
+    config.port = 14563;
+    config.batch_frames = 20;
+    config.flush_datagrams = 8;
+    tl::UdpTelemetrySender sender(config);
+    REQUIRE(sender.Initialize());
+    for (uint32_t n = 0; n <= 50; n += 10) {
+      sender.Publish(Sample(n));
+    }
+    CHECK(sender.Syscalls() == 1);
+    ssize_t length = ::recv(rx, buffer, sizeof(buffer), 0);
+    REQUIRE(length > 0);
+    CHECK(tl::DecodeDeltaTelemetry(buffer, static_cast<size_t>(length), decoded, 32) == 6);
+
+    sender.Publish(Sample(60));
+    sender.Publish(Sample(70));
+    CHECK(sender.Syscalls() == 1);
+  }
+  const ssize_t length = ::recv(rx, buffer, sizeof(buffer), 0);
+  REQUIRE(length > 0);
+  REQUIRE(tl::DecodeDeltaTelemetry(buffer, static_cast<size_t>(length), decoded, 32) == 2);
+  CHECK(decoded[1].timestamp_us == Sample(70).timestamp_us);
+  ::close(rx);
+#else
+  CHECK(true);
+#endif
+}
@@ -0,0 +1,140 @@
+#include <doctest/doctest.h>
+
+#include <vector>
+
+#include "flight/actuators/dshot_bidir_decoder.h"
+
+namespace {
+
+using flight::actuators::DshotBidirDecoder;
+using flight::actuators::DshotTelemetryFrame;
+using flight::actuators::kDshotResponseBits;
+namespace detail = flight::actuators::dshot_detail;
+
+/** @brief ESC-side encoding of a period code into the 21 response line bits. */
+uint32_t EncodeLineBits(uint16_t period_code, bool corrupt_crc = false) {
+  const uint16_t data = period_code & 0x0FFF;
+  uint16_t crc = static_cast<uint16_t>(~(data ^ (data >> 4) ^ (data >> 8)) & 0xF);
+  if (corrupt_crc) {
+    crc ^= 0x1;
+  }
+  const uint16_t value = static_cast<uint16_t>((data << 4) | crc);
+  uint32_t gcr = 0;
+  for (int shift = 12; shift >= 0; shift -= 4) {
+    gcr = (gcr << 5) | detail::kGcrEncode[(value >> shift) & 0xF];
+  }
+  // Low start bit, then toggle the line on every GCR one.
+  uint32_t line = 0;
+  bool level = false;
+  for (int bit = 19; bit >= 0; --bit) {
+    if ((gcr >> bit) & 0x1) {
+      level = !level;
+    }
+    line = (line << 1) | (level ? 1u : 0u);
+  }
+  return line;
+}
+
+/** @brief Oversample line bits into PIO sample words, with idle high around the frame. */
+std::vector<uint32_t> Capture(uint32_t line_bits,
+                              uint16_t lead_samples,
+                              const std::vector<uint8_t>& bit_samples,
+                              uint16_t& sample_count) {
+  std::vector<uint32_t> words(8, 0);
+  uint16_t index = 0;
+  auto push = [&](bool level) {
+    if (level) {
+      words[index / 32] |= 1u << (index % 32);
+    }
+    ++index;
+  };
+  for (uint16_t i = 0; i < lead_samples; ++i) {
+    push(true);
+  }
+  for (int bit = kDshotResponseBits - 1; bit >= 0; --bit) {
+    const uint8_t count = bit_samples[static_cast<size_t>(bit) % bit_samples.size()];
+    for (uint8_t s = 0; s < count; ++s) {
+      push((line_bits >> bit) & 0x1);
+    }
+  }
+  while (index < words.size() * 32) {
+    push(true);
+  }
+  sample_count = index;
+  return words;
+}
+
+}  // namespace
+
+TEST_CASE("GCR tables are inverse and reject invalid quintets") {
+  int valid = 0;
+  for (uint8_t q = 0; q < 32; ++q) {
+    if (detail::kGcrDecode[q] != 0xFF) {
+      CHECK(detail::kGcrEncode[detail::kGcrDecode[q]] == q);
+      ++valid;
+    }
+  }
+  CHECK(valid == 16);
+}
+
+TEST_CASE("Bidirectional line bits decode for every period code") {
+  for (uint16_t code = 0; code < 4096; ++code) {
+    const auto value = DshotBidirDecoder::DecodeLineBits(EncodeLineBits(code));
+    REQUIRE(value.has_value());
+    CHECK((*value >> 4) == code);
+    CHECK(DshotBidirDecoder::ChecksumOk(*value));
+  }
+  const auto corrupt = DshotBidirDecoder::DecodeLineBits(EncodeLineBits(0x123, true));
+  REQUIRE(corrupt.has_value());
+  CHECK_FALSE(DshotBidirDecoder::ChecksumOk(*corrupt));
+}
+
+TEST_CASE("Run-length extraction recovers line bits with sampling jitter") {
+  // 10 samples per command bit gives 8 per response bit; vary 7..9.
+  const std::vector<uint8_t> jitter = {8, 7, 9, 8, 8, 9, 7};
+  for (uint16_t code : {0x000, 0x0FF, 0x2A5, 0x7FF, 0xFFF}) {
+    for (uint16_t lead : {0, 5, 31, 40}) {
+      const uint32_t line = EncodeLineBits(code);
+      uint16_t count = 0;
+      const auto words = Capture(line, lead, jitter, count);
+      const auto extracted = DshotBidirDecoder::ExtractLineBits(words.data(), count, 10);
+      REQUIRE(extracted.has_value());
+      CHECK(*extracted == line);
+    }
+  }
+}
+
+TEST_CASE("Extraction fails on idle or truncated captures") {
+  uint32_t idle[4] = {0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu};
+  CHECK_FALSE(DshotBidirDecoder::ExtractLineBits(idle, 128, 10).has_value());
+  uint32_t stuck_low[2] = {0xFFFF0000u, 0x00000000u};
+  CHECK_FALSE(DshotBidirDecoder::ExtractLineBits(stuck_low, 64, 10).has_value());
+}
+
+TEST_CASE("Decoder converts the period to RPM and keeps per-channel state") {
+  DshotBidirDecoder decoder({10, 14});
+  // 1000 us period: m = 250, e = 2 -> 60000 eRPM -> 8571 RPM on 7 pole pairs.
+  const uint16_t code = static_cast<uint16_t>((2 << 9) | 250);
+  for (uint8_t channel = 0; channel < 4; ++channel) {
+    uint16_t count = 0;
+    const auto words = Capture(EncodeLineBits(channel == 2 ? 0xFFF : code), 12, {8}, count);
+    DshotTelemetryFrame frame{};
+    REQUIRE(decoder.Decode(channel, words.data(), count, frame));
+    CHECK(frame.channel == channel);
+    CHECK(frame.crc_ok);
+  }
+  CHECK(decoder.State(0).erpm == 60000);
+  CHECK(decoder.Rpm(0) == 8571);
+  CHECK(decoder.Rpm(3) == 8571);
+  CHECK(decoder.Rpm(2) == 0);
+  CHECK(decoder.State(2).valid);
+  CHECK(decoder.State(5).frames == 0);
+
+  uint16_t count = 0;
+  const auto bad = Capture(EncodeLineBits(code, true), 12, {8}, count);
+  DshotTelemetryFrame frame{};
+  CHECK(decoder.Decode(1, bad.data(), count, frame));
+  CHECK_FALSE(frame.crc_ok);
+  CHECK(decoder.State(1).errors == 1);
+  CHECK(decoder.Rpm(1) == 8571);
+}
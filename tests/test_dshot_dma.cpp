@@ -0,0 +1,97 @@
+#include <doctest/doctest.h>
+
+#include "flight/actuators/dshot_dma.h"
+#include "flight/actuators/dshot_output.h"
+
+using flight::actuators::ActuatorCommand;
+using flight::actuators::DshotCommand;
+using flight::actuators::DshotCommandQueue;
+using flight::actuators::DshotDmaFrame;
+using flight::actuators::DshotEncoder;
+using flight::actuators::DshotOutput;
+using flight::actuators::kDshotParallelWords;
+using flight::actuators::kDshotSerialWords;
+
+TEST_CASE("DShot command queue replaces only masked channels") {
+  DshotCommandQueue queue;
+  REQUIRE(queue.Push(0b0010, DshotCommand::kBeep1));
+  REQUIRE(queue.Push(0b0101, DshotCommand::kSpinDirectionReversed));
+
+  const uint16_t throttle = DshotEncoder::PackFrame(1000, false);
+  uint16_t packets[4] = {throttle, throttle, throttle, throttle};
+  queue.Apply(packets, 4, false);
+  CHECK(packets[0] == throttle);
+  CHECK(packets[1] == DshotEncoder::PackFrame(1, true));
+  CHECK(packets[2] == throttle);
+  CHECK(queue.Size() == 1);
+
+  // Settings commands are repeated so the ESC accepts them.
+  const uint16_t reversed = DshotEncoder::PackFrame(21, true);
+  for (uint8_t frame = 0; frame < 6; ++frame) {
+    uint16_t next[4] = {throttle, throttle, throttle, throttle};
+    queue.Apply(next, 4, false);
+    CHECK(next[0] == reversed);
+    CHECK(next[1] == throttle);
+    CHECK(next[2] == reversed);
+    CHECK(next[3] == throttle);
+  }
+  CHECK(queue.Empty());
+}
+
+TEST_CASE("DShot command queue rejects overflow and empty masks") {
+  DshotCommandQueue queue;
+  CHECK_FALSE(queue.Push(0, DshotCommand::kBeep1));
+  for (uint8_t i = 0; i < DshotCommandQueue::kCapacity; ++i) {
+    CHECK(queue.Push(1, DshotCommand::kBeep2));
+  }
+  CHECK_FALSE(queue.Push(1, DshotCommand::kBeep2));
+}
+
+TEST_CASE("DShot DMA serial frame has one transfer per state machine") {
+  const uint16_t packets[3] = {DshotEncoder::PackFrame(48, false),
+                               DshotEncoder::PackFrame(1024, false),
+                               DshotEncoder::PackFrame(2047, true)};
+  const uint8_t sms[3] = {1, 2, 3};
+  DshotDmaFrame frame;
+  REQUIRE(frame.BuildSerial(packets, 3, sms));
+  REQUIRE(frame.transfer_count == 3);
+  for (uint8_t i = 0; i < 3; ++i) {
+    uint32_t expected[kDshotSerialWords];
+    DshotEncoder::EncodeSerial(packets[i], expected);
+    const auto& transfer = frame.transfers[i];
+    CHECK(transfer.state_machine == sms[i]);
+    CHECK(transfer.word_count == kDshotSerialWords);
+    CHECK(frame.words[transfer.word_offset] == expected[0]);
+    CHECK(frame.words[transfer.word_offset + 1] == expected[1]);
+  }
+  CHECK_FALSE(frame.BuildSerial(packets, 5, sms));
+}
+
+TEST_CASE("DShot DMA parallel frame is a single transfer") {
+  uint16_t packets[8];
+  for (uint16_t i = 0; i < 8; ++i) {
+    packets[i] = DshotEncoder::PackFrame(static_cast<uint16_t>(100 + i * 200), false);
+  }
+  DshotDmaFrame frame;
+  REQUIRE(frame.BuildParallel(packets, 8, 0));
+  REQUIRE(frame.transfer_count == 1);
+  CHECK(frame.transfers[0].word_offset == 0);
+  CHECK(frame.transfers[0].word_count == kDshotParallelWords);
+
+  uint32_t expected[kDshotParallelWords];
+  DshotEncoder::EncodeParallel(packets, 8, expected);
+  for (uint8_t w = 0; w < kDshotParallelWords; ++w) {
+    CHECK(frame.words[w] == expected[w]);
+  }
+}
+
+TEST_CASE("DShot output interleaves queued commands with throttle") {
+  DshotOutput output;
+  ActuatorCommand commands[2] = {{0.5f}, {0.5f}};
+  REQUIRE(output.QueueCommand(0b01, DshotCommand::kBeep3));
+  output.Write(commands, 2);
+  CHECK(output.Packet(0) == DshotEncoder::PackFrame(3, true));
+  const uint16_t throttle = output.Packet(1);
+  output.Write(commands, 2);
+  CHECK(output.Packet(0) == throttle);
+}
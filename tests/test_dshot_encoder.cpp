@@ -0,0 +1,109 @@
+#include <doctest/doctest.h>
+
+#include "flight/actuators/dshot_encoder.h"
+
+namespace {
+
+using flight::actuators::DshotEncoder;
+using flight::actuators::kDshotParallelWords;
+using flight::actuators::kDshotSerialWords;
+
+/** @brief Reference bit-by-bit waveform (tick n at bit n, LSB first). */
+void ReferenceSerial(uint16_t packet, uint32_t (&words)[kDshotSerialWords]) {
+  words[0] = 0;
+  words[1] = 0;
+  uint16_t tick = 0;
+  for (int bit = 15; bit >= 0; --bit) {
+    const uint8_t symbol = ((packet >> bit) & 0x1) ? 0b110 : 0b100;
+    for (uint8_t s = 0; s < 3; ++s) {
+      if ((symbol >> (2 - s)) & 0x1) {
+        words[tick / 32] |= 1u << (tick % 32);
+      }
+      ++tick;
+    }
+  }
+}
+
+uint16_t ReferenceChecksum(uint16_t data) {
+  return static_cast<uint16_t>((data ^ (data >> 4) ^ (data >> 8)) & 0xF);
+}
+
+}  // namespace
+
+TEST_CASE("DShot encoder checksum table matches the XOR definition") {
+  bool all_match = true;
+  for (uint16_t data = 0; data < 4096; ++data) {
+    all_match = all_match && DshotEncoder::Checksum(data) == ReferenceChecksum(data);
+    all_match = all_match &&
+                DshotEncoder::Checksum(data, true) == (~ReferenceChecksum(data) & 0xF);
+  }
+  CHECK(all_match);
+  static_assert(DshotEncoder::PackFrame(0, false) == 0, "zero frame");
+}
+
+TEST_CASE("DShot serial waveform matches the bitwise reference for all frames") {
+  bool all_match = true;
+  for (uint32_t packet = 0; packet < 65536; ++packet) {
+    uint32_t expected[kDshotSerialWords];
+    uint32_t actual[kDshotSerialWords];
+    ReferenceSerial(static_cast<uint16_t>(packet), expected);
+    DshotEncoder::EncodeSerial(static_cast<uint16_t>(packet), actual);
+    all_match = all_match && expected[0] == actual[0] && expected[1] == actual[1];
+  }
+  CHECK(all_match);
+
+  // Throttle 1000, no telemetry: first bit is 0 -> ticks 1,0,0.
+  uint32_t words[kDshotSerialWords];
+  DshotEncoder::EncodeSerial(DshotEncoder::PackFrame(1000, false), words);
+  CHECK((words[0] & 0x7) == 0x1);
+  CHECK((words[1] >> 16) == 0);
+}
+
+TEST_CASE("DShot parallel waveform carries each lane's serial waveform") {
+  const uint16_t packets[8] = {
+      DshotEncoder::PackFrame(48, false),   DshotEncoder::PackFrame(2047, true),
+      DshotEncoder::PackFrame(1000, false), DshotEncoder::PackFrame(1, true),
+      0xA5C3,                               0x0000,
+      0xFFFF,                               DshotEncoder::PackFrame(1500, false, true)};
+
+  for (uint8_t lanes = 1; lanes <= 8; ++lanes) {
+    uint32_t parallel[kDshotParallelWords];
+    DshotEncoder::EncodeParallel(packets, lanes, parallel);
+
+    for (uint8_t lane = 0; lane < 8; ++lane) {
+      uint32_t serial[kDshotSerialWords] = {0, 0};
+      if (lane < lanes) {
+        DshotEncoder::EncodeSerial(packets[lane], serial);
+      }
+      bool lane_ok = true;
+      for (uint16_t tick = 0; tick < kDshotParallelWords * 4; ++tick) {
+        const uint8_t byte = static_cast<uint8_t>(parallel[tick / 4] >> (8 * (tick % 4)));
+        const bool level = (byte >> lane) & 0x1;
+        const bool expected = tick < 64 && ((serial[tick / 32] >> (tick % 32)) & 0x1);
+        lane_ok = lane_ok && level == expected;
+      }
+      CHECK(lane_ok);
+    }
+  }
+}
+
+TEST_CASE("DShot throttle mapping and clock dividers cover DShot150 to DShot1200") {
+  CHECK(DshotEncoder::ValueToThrottle(-1.0f, 48, 2047) == 48);
+  CHECK(DshotEncoder::ValueToThrottle(1.0f, 48, 2047) == 2047);
+  CHECK(DshotEncoder::ValueToThrottle(5.0f, 48, 2047) == 2047);
+
+  using flight::actuators::DshotSpeed;
+  CHECK(DshotEncoder::ClockDivider(150000000, DshotSpeed::k150) == doctest::Approx(333.333f));
+  CHECK(DshotEncoder::ClockDivider(150000000, DshotSpeed::k300) == doctest::Approx(166.667f));
+  CHECK(DshotEncoder::ClockDivider(150000000, DshotSpeed::k600) == doctest::Approx(83.333f));
+  CHECK(DshotEncoder::ClockDivider(150000000, DshotSpeed::k1200) == doctest::Approx(41.667f));
+
+  DshotEncoder encoder({DshotSpeed::k600, 48, 2047, true, false});
+  flight::actuators::ActuatorCommand commands[2];
+  commands[0].value = -1.0f;
+  commands[1].value = 1.0f;
+  uint16_t packets[2];
+  encoder.PackAll(commands, 2, packets);
+  CHECK(packets[0] == DshotEncoder::PackFrame(48, true));
+  CHECK(packets[1] == DshotEncoder::PackFrame(2047, true));
+}
@@ -0,0 +1,185 @@
+#include <doctest/doctest.h>
+
+#include <vector>
+
+#include "flight/actuators/dshot_sliced_decoder.h"
+
+namespace {
+
+using flight::actuators::DshotSlicedDecoder;
+using flight::actuators::DshotTelemetryTable;
+using flight::actuators::kDshotResponseBits;
+namespace detail = flight::actuators::dshot_detail;
+
+constexpr uint8_t kResponseSamples = 8;  // 10 samples per command bit
+
+/** @brief ESC-side encoding of a period code into the 21 response line bits. */
+uint32_t EncodeLineBits(uint16_t period_code) {
+  const uint16_t data = period_code & 0x0FFF;
+  const uint16_t crc = static_cast<uint16_t>(~(data ^ (data >> 4) ^ (data >> 8)) & 0xF);
+  const uint16_t value = static_cast<uint16_t>((data << 4) | crc);
+  uint32_t gcr = 0;
+  for (int shift = 12; shift >= 0; shift -= 4) {
+    gcr = (gcr << 5) | detail::kGcrEncode[(value >> shift) & 0xF];
+  }
+  uint32_t line = 0;
+  bool level = false;
+  for (int bit = 19; bit >= 0; --bit) {
+    if ((gcr >> bit) & 0x1) {
+      level = !level;
+    }
+    line = (line << 1) | (level ? 1u : 0u);
+  }
+  return line;
+}
+
+/** @brief Write one lane's response into interleaved sample bytes (idle high). */
+void DrawLane(std::vector<uint8_t>& samples, size_t offset, uint8_t lane, uint16_t code) {
+  const uint32_t line = EncodeLineBits(code);
+  size_t index = offset;
+  for (int bit = kDshotResponseBits - 1; bit >= 0; --bit) {
+    for (uint8_t s = 0; s < kResponseSamples; ++s, ++index) {
+      if (!((line >> bit) & 0x1)) {
+        samples[index % samples.size()] &= static_cast<uint8_t>(~(1u << lane));
+      }
+    }
+  }
+}
+
+/** @brief Write the host's inverted command frame on @p lane_mask (10 samples per bit). */
+size_t DrawCommand(std::vector<uint8_t>& samples, size_t offset, uint8_t lane_mask, uint16_t frame) {
+  size_t index = offset;
+  for (int bit = 15; bit >= 0; --bit) {
+    const uint8_t low_samples = ((frame >> bit) & 0x1) ? 7 : 4;
+    for (uint8_t s = 0; s < 10; ++s, ++index) {
+      if (s < low_samples) {
+        samples[index % samples.size()] &= static_cast<uint8_t>(~lane_mask);
+      }
+    }
+  }
+  return index;
+}
+
+}  // namespace
+
+TEST_CASE("Sliced de-interleave matches per-sample extraction") {
+  uint8_t window[DshotSlicedDecoder::kWindowSamples];
+  for (uint16_t i = 0; i < DshotSlicedDecoder::kWindowSamples; ++i) {
+    window[i] = static_cast<uint8_t>(i * 37 + (i >> 3));
+  }
+  uint32_t lanes[DshotSlicedDecoder::kLanes][DshotSlicedDecoder::kWindowWords];
+  DshotSlicedDecoder::Deinterleave(window, lanes);
+  for (uint8_t lane = 0; lane < DshotSlicedDecoder::kLanes; ++lane) {
+    for (uint16_t i = 0; i < DshotSlicedDecoder::kWindowSamples; ++i) {
+      const bool expected = (window[i] >> lane) & 0x1;
+      const bool actual = (lanes[lane][i / 32] >> (i % 32)) & 0x1;
+      REQUIRE(expected == actual);
+    }
+  }
+}
+
+TEST_CASE("Sliced decoder fills the table for every channel in one window") {
+  DshotSlicedDecoder::Config config{};
+  config.channel_count = 4;
+  // Pins 2, 3, 6, 7 sampled from base pin 2.
+  config.lanes[0] = 0;
+  config.lanes[1] = 1;
+  config.lanes[2] = 4;
+  config.lanes[3] = 5;
+  config.skip_tx_frame = false;
+  DshotSlicedDecoder decoder(config);
+
+  const uint16_t codes[4] = {0x1FA, 0x2A5, 0x5F0, 0xFFF};
+  const size_t skew[4] = {0, 9, 40, 23};
+  std::vector<uint8_t> ring(1024, 0xFF);
+  // Lane 2 and 3 (pins 4, 5) carry unrelated traffic that must be ignored.
+  for (size_t i = 0; i < ring.size(); i += 3) {
+    ring[i] = static_cast<uint8_t>(ring[i] & ~0x0C);
+  }
+  const size_t start = 1000;  // wraps around the ring end
+  for (uint8_t ch = 0; ch < 4; ++ch) {
+    DrawLane(ring, start + skew[ch], config.lanes[ch], codes[ch]);
+  }
+
+  DshotTelemetryTable table{};
+  const uint16_t write_index = static_cast<uint16_t>((start + 300) % ring.size());
+  const uint16_t read = decoder.Process(ring.data(), static_cast<uint16_t>(ring.size()), 900,
+                                        write_index, table);
+  // Idle samples after the response are consumed as well.
+  CHECK(read == write_index);
+  CHECK(table.updated_mask == 0x0F);
+  for (uint8_t ch = 0; ch < 4; ++ch) {
+    CHECK(table.frames[ch].channel == ch);
+    CHECK(table.frames[ch].crc_ok);
+    CHECK(table.frames[ch].data == codes[ch]);
+  }
+  CHECK(decoder.Rpm(0) == flight::actuators::ErpmFromPeriodCode(codes[0]) / 7);
+  CHECK(decoder.Rpm(3) == 0);
+}
+
+TEST_CASE("Sliced decoder leaves incomplete responses for the next tick") {
+  DshotSlicedDecoder::Config config{};
+  config.skip_tx_frame = false;
+  DshotSlicedDecoder decoder(config);
+  std::vector<uint8_t> ring(1024, 0xFF);
+  DrawLane(ring, 100, 0, 0x123);
+
+  DshotTelemetryTable table{};
+  uint16_t read = decoder.Process(ring.data(), 1024, 0, 200, table);
+  CHECK(read == 100);
+  CHECK(table.updated_mask == 0);
+
+  read = decoder.Process(ring.data(), 1024, read, 400, table);
+  CHECK(read == 400);
+  CHECK(table.updated_mask == 0x01);
+  CHECK(table.frames[0].data == 0x123);
+  // A channel without a response in the window is not a decode error.
+  CHECK(decoder.State(1).errors == 0);
+}
+
+TEST_CASE("Sliced decoder skips the host command frame on the shared pins") {
+  DshotSlicedDecoder decoder;
+  std::vector<uint8_t> ring(2048, 0xFF);
+  // Command, ~30 us turnaround at DShot300, then the responses.
+  size_t end = DrawCommand(ring, 0, 0x0F, 0xA5C3);
+  const uint16_t codes[4] = {0x1FA, 0x2A5, 0x5F0, 0x0C4};
+  for (uint8_t ch = 0; ch < 4; ++ch) {
+    DrawLane(ring, end + 90 + ch * 5, ch, codes[ch]);
+  }
+  // A second command nobody answers.
+  end = DrawCommand(ring, 1000, 0x0F, 0x1234);
+
+  DshotTelemetryTable table{};
+  // Split mid-command to carry the gate across calls.
+  uint16_t read = decoder.Process(ring.data(), 2048, 0, 80, table);
+  CHECK(table.updated_mask == 0);
+  read = decoder.Process(ring.data(), 2048, read, 900, table);
+  CHECK(table.updated_mask == 0x0F);
+  for (uint8_t ch = 0; ch < 4; ++ch) {
+    CHECK(table.frames[ch].data == codes[ch]);
+    CHECK(decoder.State(ch).errors == 0);
+  }
+
+  table.updated_mask = 0;
+  read = decoder.Process(ring.data(), 2048, read, 2000, table);
+  CHECK(read == 2000);
+  CHECK(table.updated_mask == 0);
+  CHECK(decoder.MissedResponses() == 1);
+  for (uint8_t ch = 0; ch < 4; ++ch) {
+    CHECK(decoder.State(ch).errors == 0);
+  }
+}
+
+TEST_CASE("Popcount majority tolerates single-sample glitches") {
+  std::vector<uint8_t> samples(DshotSlicedDecoder::kWindowSamples, 0xFF);
+  DrawLane(samples, 4, 0, 0x3C3);
+  for (size_t i = 10; i < 160; i += 13) {
+    samples[i] ^= 0x01;
+  }
+  uint32_t lanes[DshotSlicedDecoder::kLanes][DshotSlicedDecoder::kWindowWords];
+  DshotSlicedDecoder::Deinterleave(samples.data(), lanes);
+  const auto line = DshotSlicedDecoder::MajorityLineBits(
+      lanes[0], DshotSlicedDecoder::kWindowSamples, 10);
+  REQUIRE(line.has_value());
+  CHECK(*line == EncodeLineBits(0x3C3));
+}
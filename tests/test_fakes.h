@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "flight/actuators/actuators.h"
+#include "flight/estimators/estimators.h"
+#include "flight/hal/hal.h"
+#include "flight/telemetry/telemetry.h"
+
+namespace flight::test {
+
+/** @brief Clock that only moves when a test (or SleepUs()) advances it. */
+class ManualTime final : public flight::hal::ITime {
+ public:
+  explicit ManualTime(uint64_t start_us = 0) : now_us(start_us) {}
+  uint64_t NowUs() const override { return now_us; }
+  void SleepUs(uint64_t duration_us) override { now_us += duration_us; }
+  uint64_t now_us = 0;
+};
+
+/** @brief Estimator that always reports the default state. */
+class NullEstimator final : public flight::estimators::IStateEstimator {
+ public:
+  bool Initialize() override { return true; }
+  flight::estimators::EstimatorOutput Update(const flight::estimators::EstimatorInput&) override {
+    return {};
+  }
+};
+
+/** @brief Actuator output that accepts and discards every command. */
+class NullOutput final : public flight::actuators::IActuatorOutput {
+ public:
+  bool Initialize() override { return true; }
+  bool Write(const flight::actuators::ActuatorCommand*, uint8_t) override { return true; }
+};
+
+/** @brief Keeps the last published snapshot (single-threaded use). */
+class CapturingSink final : public flight::telemetry::ITelemetrySink {
+ public:
+  bool Initialize() override { return true; }
+  void Publish(const flight::telemetry::TelemetrySnapshot& snapshot) override { last = snapshot; }
+  flight::telemetry::TelemetrySnapshot last{};
+};
+
+/** @brief Counts publishes and records the publishing thread, for sinks run off-thread. */
+class CountingSink final : public flight::telemetry::ITelemetrySink {
+ public:
+  bool Initialize() override { return true; }
+  void Publish(const flight::telemetry::TelemetrySnapshot& snapshot) override {
+    last_sequence = snapshot.command_sequence;
+    thread = std::this_thread::get_id();
+    count.fetch_add(1);
+  }
+  uint32_t last_sequence = 0;
+  std::thread::id thread;
+  std::atomic<int> count{0};
+};
+
+}  // namespace flight::test
@@ -0,0 +1,113 @@
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "flight/controllers/gain_schedule.h"
+#include "flight/controllers/rov_controller.h"
+
+using flight::controllers::GainSchedule;
+using flight::controllers::GainTable;
+
+namespace {
+
+/** @brief 2x2 grid over speed {0, 1} and depth {0, 10} with gain = base + speed + depth/10. */
+GainTable Grid(float base) {
+  GainTable table{};
+  table.x_count = 2;
+  table.y_count = 2;
+  table.gain_count = 3;
+  table.x[0] = 0.0f;
+  table.x[1] = 1.0f;
+  table.y[0] = 0.0f;
+  table.y[1] = 10.0f;
+  for (uint8_t ix = 0; ix < 2; ++ix) {
+    for (uint8_t iy = 0; iy < 2; ++iy) {
+      for (uint8_t g = 0; g < 3; ++g) {
+        table.gains[ix][iy][g] = base + ix + iy;
+      }
+    }
+  }
+  return table;
+}
+
+}  // namespace
+
+TEST_CASE("Gain schedule interpolates bilinearly and clamps") {
+  GainSchedule schedule(Grid(1.0f));
+  float gains[GainTable::kMaxGains] = {};
+  REQUIRE(schedule.Evaluate(0.5f, 5.0f, gains) == 3);
+  CHECK(gains[0] == doctest::Approx(2.0f));
+  schedule.Evaluate(0.25f, 0.0f, gains);
+  CHECK(gains[1] == doctest::Approx(1.25f));
+  schedule.Evaluate(-4.0f, 50.0f, gains);
+  CHECK(gains[2] == doctest::Approx(2.0f));
+  schedule.Evaluate(9.0f, 50.0f, gains);
+  CHECK(gains[2] == doctest::Approx(3.0f));
+}
+
+TEST_CASE("Gain schedule supports a single scheduling variable") {
+  GainTable table{};
+  table.x_count = 3;
+  table.gain_count = 1;
+  table.x[0] = 0.0f;
+  table.x[1] = 1.0f;
+  table.x[2] = 3.0f;
+  table.gains[0][0][0] = 1.0f;
+  table.gains[1][0][0] = 2.0f;
+  table.gains[2][0][0] = 0.0f;
+  GainSchedule schedule(table);
+  float gain = 0.0f;
+  schedule.Evaluate(2.0f, 123.0f, &gain);
+  CHECK(gain == doctest::Approx(1.0f));
+}
+
+TEST_CASE("Gain schedule swaps only after the loop picked up the last update") {
+  GainSchedule schedule(Grid(1.0f));
+  float gains[GainTable::kMaxGains] = {};
+  CHECK(schedule.Update(Grid(5.0f)));
+  CHECK_FALSE(schedule.Update(Grid(9.0f)));
+  schedule.Evaluate(0.0f, 0.0f, gains);
+  CHECK(gains[0] == doctest::Approx(5.0f));
+  CHECK(schedule.Update(Grid(9.0f)));
+  schedule.Evaluate(0.0f, 0.0f, gains);
+  CHECK(gains[0] == doctest::Approx(9.0f));
+  CHECK(schedule.Generation() == 3);
+
+  GainTable bad = Grid(1.0f);
+  bad.x[1] = -1.0f;
+  CHECK_FALSE(schedule.Update(bad));
+}
+
+TEST_CASE("Gain schedule never exposes a torn table") {
+  GainSchedule schedule(Grid(0.0f));
+  std::atomic<bool> done{false};
+  std::thread writer([&] {
+    for (int version = 1; version < 2000;) {
+      if (schedule.Update(Grid(static_cast<float>(version) * 10.0f))) {
+        ++version;
+      }
+    }
+    done = true;
+  });
+  bool consistent = true;
+  float gains[GainTable::kMaxGains] = {};
+  while (!done) {
+    schedule.Evaluate(0.0f, 0.0f, gains);
+    consistent = consistent && gains[0] == gains[1] && gains[1] == gains[2];
+  }
+  writer.join();
+  CHECK(consistent);
+}
+
+TEST_CASE("ROV controller uses scheduled gains") {
+  flight::controllers::RovController controller({});
+  GainSchedule schedule(Grid(0.5f));
+  controller.SetGainSchedule(&schedule);
+  flight::controllers::ControlSetpoint setpoint{};
+  setpoint.velocity_mps.z = 0.5f;
+  flight::core::Pose pose{};
+  pose.position_m.z = -10.0f;  // 10 m deep -> heave gain 1.5
+  auto output = controller.Update(pose, setpoint, 0.01f);
+  CHECK(output.motors[2] == doctest::Approx(0.75f));
+}
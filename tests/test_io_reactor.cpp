@@ -0,0 +1,152 @@
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include "flight/core/spsc_ring.h"
+#include "flight/core/triple_buffer.h"
+#include "flight/io/reactor_endpoints.h"
+#include "flight/receiver/command_protocol.h"
+#include "test_fakes.h"
+
+namespace {
+
+struct Pair {
+  uint64_t a = 0;
+  uint64_t b = 0;
+};
+
+/** @brief Poll @p done for up to a second. */
+template <typename Predicate>
+bool WaitFor(Predicate done) {
+  for (int i = 0; i < 1000; ++i) {
+    if (done()) {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return false;
+}
+
+}  // namespace
+
+TEST_CASE("Triple buffer hands over only whole, newest values") {
+  flight::core::TripleBuffer<Pair> buffer;
+  Pair out{};
+  CHECK_FALSE(buffer.Read(out));
+  buffer.Write({1, 1});
+  buffer.Write({2, 2});
+  REQUIRE(buffer.Read(out));
+  CHECK(out.a == 2);
+  CHECK_FALSE(buffer.Read(out));
+
+  std::atomic<bool> done{false};
+  std::thread writer([&] {
+    for (uint64_t i = 3; i < 200000; ++i) {
+      buffer.Write({i, ~i});
+    }
+    done = true;
+  });
+  uint64_t last = 2;
+  bool ok = true;
+  while (!done || buffer.Read(out)) {
+    if (buffer.Read(out)) {
+      ok = ok && out.b == ~out.a && out.a > last;
+      last = out.a;
+    }
+  }
+  writer.join();
+  CHECK(ok);
+}
+
+TEST_CASE("SPSC ring is FIFO and refuses to overwrite") {
+  flight::core::SpscRing<int, 4> ring;
+  for (int i = 0; i < 4; ++i) {
+    CHECK(ring.Push(i));
+  }
+  CHECK_FALSE(ring.Push(99));
+  CHECK(ring.Dropped() == 1);
+  int value = -1;
+  for (int i = 0; i < 4; ++i) {
+    REQUIRE(ring.Pop(value));
+    CHECK(value == i);
+  }
+  CHECK_FALSE(ring.Pop(value));
+}
+
+TEST_CASE("Reactor telemetry sink drops by its policy when the queue fills") {
+  constexpr uint32_t kDepth = flight::io::ReactorTelemetrySink::kQueueDepth;
+  for (const auto drop : {flight::core::DropPolicy::kDropOldest, flight::core::DropPolicy::kDropNewest}) {
+    flight::test::CountingSink inner;
+    flight::io::ReactorTelemetrySink sink(inner, drop);
+    for (uint32_t i = 1; i <= kDepth + 5; ++i) {
+      flight::telemetry::TelemetrySnapshot snapshot{};
+      snapshot.command_sequence = i;
+      sink.Publish(snapshot);
+    }
+    // Drain on this thread as the reactor would on its next wake-up.
+    sink.OnWake();
+    CHECK(inner.count.load() == static_cast<int>(kDepth));
+    CHECK(sink.Dropped() == 5);
+    CHECK(sink.Forwarded() == kDepth);
+    const bool keeps_newest = drop == flight::core::DropPolicy::kDropOldest;
+    CHECK(inner.last_sequence == (keeps_newest ? kDepth + 5 : kDepth));
+  }
+}
+
+TEST_CASE("Reactor receives commands and sends telemetry off the caller's thread") {
+#if defined(__linux__)
+  flight::receiver::UdpReceiver udp({14555});
+  flight::io::ReactorCommandReceiver receiver(udp);
+  flight::test::CountingSink inner;
+  flight::io::ReactorTelemetrySink sink(inner);
+  REQUIRE(receiver.Initialize());
+  REQUIRE(sink.Initialize());
+
+  flight::io::IoReactor reactor;
+  REQUIRE(reactor.Add(&receiver));
+  REQUIRE(reactor.Add(&sink));
+  REQUIRE(reactor.Start());
+  CHECK_FALSE(reactor.Add(&sink));
+
+  int sock = ::socket(AF_INET, SOCK_DGRAM, 0);
+  REQUIRE(sock >= 0);
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(14555);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  flight::receiver::CommandFrame command{};
+  command.channel_count = 3;
+  command.sequence = 41;
+  const auto packet = flight::receiver::EncodeCommandPacket(command);
+  ::sendto(sock, &packet, sizeof(packet), 0, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+
+  std::optional<flight::receiver::CommandFrame> frame;
+  CHECK(WaitFor([&] { return (frame = receiver.Read()).has_value(); }));
+  REQUIRE(frame.has_value());
+  CHECK(frame->sequence == 41);
+  CHECK_FALSE(receiver.Read().has_value());
+
+  for (uint32_t i = 1; i <= 10; ++i) {
+    flight::telemetry::TelemetrySnapshot snapshot{};
+    snapshot.command_sequence = i;
+    sink.Publish(snapshot);
+  }
+  CHECK(WaitFor([&] { return inner.count.load() == 10; }));
+  reactor.Stop();
+  CHECK(inner.last_sequence == 10);
+  CHECK(inner.thread != std::this_thread::get_id());
+  CHECK(sink.Dropped() == 0);
+  ::close(sock);
+#else
+  CHECK(true);
+#endif
+}
@@ -0,0 +1,84 @@
+#include <doctest/doctest.h>
+
+#include <cmath>
+
+#include "flight/controllers/lqr_controller.h"
+
+using flight::controllers::LqrController;
+namespace ctl = flight::controllers;
+
+TEST_CASE("LQR controller picks the region for the surge speed") {
+  LqrController controller;
+  REQUIRE(controller.Initialize());
+  CHECK(controller.Region(0.0f) == 0);
+  CHECK(controller.Region(-0.2f) == 1);
+  CHECK(controller.Region(0.7f) == 3);
+  CHECK(controller.Region(5.0f) == ctl::lqr_tables::kRegions - 1);
+}
+
+TEST_CASE("LQR controller applies u = -K x in the body frame") {
+  LqrController controller;
+  controller.Initialize();
+  flight::core::Pose pose{};
+  pose.position_m = {0.5f, 0.0f, -0.2f};
+  controller.Update(pose, {}, 0.01f);
+  const auto& k = ctl::lqr_tables::kGains[0];
+  CHECK(controller.Demand().axis[ctl::kSurge] == doctest::Approx(-k[0][0] * 0.5f));
+  CHECK(controller.Demand().axis[ctl::kHeave] == doctest::Approx(k[2][2] * 0.2f));
+
+  // Facing +y, a world +x offset is a body-frame sway error.
+  const float half = 0.25f * 3.14159265f;
+  pose.orientation = {std::cos(half), 0.0f, 0.0f, std::sin(half)};
+  ctl::ControlSetpoint setpoint{};
+  setpoint.attitude_rpy_rad.z = 0.5f * 3.14159265f;
+  controller.Update(pose, setpoint, 0.01f);
+  CHECK(controller.ErrorState()[0] == doctest::Approx(0.0f).epsilon(1e-4));
+  CHECK(controller.ErrorState()[1] == doctest::Approx(-0.5f).epsilon(1e-4));
+  CHECK(controller.ErrorState()[3] == doctest::Approx(0.0f).epsilon(1e-4));
+}
+
+TEST_CASE("LQR controller brings a surge offset back to station") {
+  // Same surge model the table generator uses.
+  constexpr float kMass = 13.5f;
+  constexpr float kMaxForce = 80.0f;
+  constexpr float kDt = 0.01f;
+  LqrController controller;
+  controller.Initialize();
+  flight::core::Pose pose{};
+  pose.position_m.x = 1.0f;
+  for (int i = 0; i < 1000; ++i) {
+    controller.Update(pose, {}, kDt);
+    const float force = controller.Demand().axis[ctl::kSurge] * kMaxForce;
+    const float u = pose.velocity_mps.x;
+    const float drag = (4.0f + 18.0f * std::fabs(u)) * u;
+    pose.velocity_mps.x += (force - drag) / kMass * kDt;
+    pose.position_m.x += pose.velocity_mps.x * kDt;
+  }
+  CHECK(std::fabs(pose.position_m.x) < 0.02f);
+  CHECK(std::fabs(pose.velocity_mps.x) < 0.02f);
+}
+
+TEST_CASE("LQR controller accepts a custom table") {
+  static constexpr float kSpeed[1] = {1.0f};
+  static constexpr float kGains[1][4][8] = {{{2.0f}, {}, {}, {}}};
+  LqrController::Config config{};
+  config.table = {1, kSpeed, kGains};
+  LqrController controller(config);
+  REQUIRE(controller.Initialize());
+  flight::core::Pose pose{};
+  pose.position_m.x = 0.25f;
+  controller.Update(pose, {}, 0.01f);
+  CHECK(controller.Demand().axis[ctl::kSurge] == doctest::Approx(-0.5f));
+  CHECK(controller.Region(10.0f) == 0);
+}
+
+TEST_CASE("LQR controller flags ticks off the table's sample time") {
+  LqrController controller;
+  REQUIRE(controller.Initialize());
+  controller.Update({}, {}, flight::controllers::lqr_tables::kSampleTimeS);
+  controller.Update({}, {}, 0.0105f);
+  CHECK(controller.RateMismatches() == 0);
+  controller.Update({}, {}, 0.001f);
+  controller.Update({}, {}, 0.02f);
+  CHECK(controller.RateMismatches() == 2);
+}
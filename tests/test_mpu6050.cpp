@@ -70,3 +70,12 @@ TEST_CASE("MPU6050 reads and scales accel/gyro") {
   CHECK(sample->gyro_rps.y == doctest::Approx(0.0174533f).epsilon(0.01f));
   CHECK(sample->gyro_rps.z == doctest::Approx(0.0174533f).epsilon(0.01f));
 }
+
+TEST_CASE("MPU6050 batch read returns the current sample only") {
+  FakeI2c i2c;
+  flight::sensors::Mpu6050Imu imu(&i2c, {});
+
+  flight::sensors::ImuSample samples[4];
+  CHECK(imu.ReadBatch(samples, 4) == 1);
+  CHECK(imu.ReadBatch(samples, 0) == 0);
+}
@@ -0,0 +1,79 @@
+#include <doctest/doctest.h>
+
+#include "fake_pwm.h"
+#include "flight/actuators/oneshot_output.h"
+
+using flight::actuators::ActuatorCommand;
+using flight::actuators::OneShotOutput;
+using flight::actuators::OneShotProtocol;
+using flight::actuators::PulseToLevel;
+
+TEST_CASE("OneShot protocols map commands onto their pulse ranges") {
+  struct Expected {
+    OneShotProtocol protocol;
+    float min_us;
+    float neutral_us;
+    float max_us;
+  };
+  const Expected cases[] = {{OneShotProtocol::kOneShot125, 125.0f, 187.5f, 250.0f},
+                            {OneShotProtocol::kOneShot42, 42.0f, 63.0f, 84.0f},
+                            {OneShotProtocol::kMultiShot, 5.0f, 15.0f, 25.0f}};
+  for (const auto& expected : cases) {
+    OneShotOutput::Config config{};
+    config.protocol = expected.protocol;
+    OneShotOutput output(config);
+    ActuatorCommand commands[4] = {{-1.0f}, {0.0f}, {1.0f}, {3.0f}};
+    REQUIRE(output.Initialize());
+    REQUIRE(output.Write(commands, 4));
+    CHECK(output.PulseUs(0) == doctest::Approx(expected.min_us));
+    CHECK(output.PulseUs(1) == doctest::Approx(expected.neutral_us));
+    CHECK(output.PulseUs(2) == doctest::Approx(expected.max_us));
+    CHECK(output.PulseUs(3) == doctest::Approx(expected.max_us));
+  }
+}
+
+TEST_CASE("MultiShot runs fast slices with fine pulse resolution") {
+  flight::test::FakePwm pwm;
+  OneShotOutput::Config config{};
+  config.protocol = OneShotProtocol::kMultiShot;
+  config.update_rate_hz = 32000.0f;
+  config.channel_count = 2;
+  config.pins[0] = 8;
+  config.pins[1] = 9;
+  OneShotOutput output(config, &pwm);
+  REQUIRE(output.Initialize());
+  CHECK(output.Timing().divider == 1);
+  CHECK(output.Timing().tick_us < 0.01f);
+  CHECK(pwm.enable_masks[0] == 0b10000);
+
+  ActuatorCommand commands[2] = {{0.5f}, {-0.5f}};
+  output.Write(commands, 2);
+  pwm.Wrap();
+  CHECK(pwm.slices[4].active[0] == PulseToLevel(20.0f, output.Timing()));
+  CHECK(pwm.slices[4].active[1] == PulseToLevel(10.0f, output.Timing()));
+}
+
+TEST_CASE("OneShot125 rejects a frame rate shorter than its longest pulse") {
+  flight::test::FakePwm pwm;
+  OneShotOutput::Config config{};
+  config.update_rate_hz = 4500.0f;
+  config.channel_count = 1;
+  config.pins[0] = 2;
+  OneShotOutput output(config, &pwm);
+  CHECK_FALSE(output.Initialize());
+}
+
+TEST_CASE("OneShot neutral comes from the ESC configuration") {
+  flight::test::FakePwm pwm;
+  OneShotOutput::Config config{};
+  config.channel_count = 1;
+  config.pins[0] = 2;
+  config.neutral_pulse_us = 125.0f;  // forward-only ESC
+  OneShotOutput output(config, &pwm);
+  REQUIRE(output.Initialize());
+  CHECK(output.PulseUs(0) == doctest::Approx(125.0f));
+
+  ActuatorCommand command{0.5f};
+  output.Write(&command, 1);
+  CHECK(output.PulseUs(0) == doctest::Approx(187.5f));
+}
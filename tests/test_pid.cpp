@@ -0,0 +1,60 @@
+#include <doctest/doctest.h>
+
+#include "flight/controllers/pid.h"
+
+using flight::controllers::Pid;
+
+TEST_CASE("PID proportional and feed-forward terms") {
+  Pid::Config config{};
+  config.kp = 2.0f;
+  config.kff = 0.5f;
+  config.output_limit = 10.0f;
+  Pid pid(config);
+  CHECK(pid.Update(1.0f, 0.25f, 0.01f, 2.0f) == doctest::Approx(2.5f));
+}
+
+TEST_CASE("PID integrator is clamped and stops winding up in saturation") {
+  Pid::Config config{};
+  config.kp = 1.0f;
+  config.ki = 10.0f;
+  config.integral_limit = 0.5f;
+  config.output_limit = 1.0f;
+  Pid pid(config);
+  for (int i = 0; i < 1000; ++i) {
+    CHECK(pid.Update(5.0f, 0.0f, 0.001f) == doctest::Approx(1.0f));
+  }
+  // Saturated from the first step, so nothing accumulated.
+  CHECK(pid.Integral() == doctest::Approx(0.0f));
+
+  Pid unsaturated(config);
+  for (int i = 0; i < 1000; ++i) {
+    unsaturated.Update(0.1f, 0.0f, 0.001f);
+  }
+  CHECK(unsaturated.Integral() == doctest::Approx(0.5f));
+}
+
+TEST_CASE("PID derivative acts on measurement and is filtered") {
+  Pid::Config config{};
+  config.kp = 0.0f;
+  config.kd = 1.0f;
+  config.d_cutoff_hz = 10.0f;
+  config.output_limit = 100.0f;
+  Pid pid(config);
+  pid.Update(0.0f, 0.0f, 0.001f);
+  // Setpoint step alone produces no derivative kick.
+  CHECK(pid.Update(1.0f, 0.0f, 0.001f) == doctest::Approx(0.0f));
+
+  // A measurement ramp of 1 unit/s settles at -1 after the filter lag.
+  float output = 0.0f;
+  float measurement = 0.0f;
+  for (int i = 0; i < 2; ++i) {
+    measurement += 0.001f;
+    output = pid.Update(1.0f, measurement, 0.001f);
+  }
+  CHECK(output > -0.2f);
+  for (int i = 0; i < 500; ++i) {
+    measurement += 0.001f;
+    output = pid.Update(1.0f, measurement, 0.001f);
+  }
+  CHECK(output == doctest::Approx(-1.0f).epsilon(0.01));
+}
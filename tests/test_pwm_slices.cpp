@@ -0,0 +1,55 @@
+#include <doctest/doctest.h>
+
+#include "flight/actuators/pwm_slices.h"
+
+using flight::actuators::ComputePwmTiming;
+using flight::actuators::PulseToLevel;
+using flight::actuators::PwmChannelForGpio;
+using flight::actuators::PwmSliceForGpio;
+using flight::actuators::PwmSlicePlan;
+
+TEST_CASE("RP2350 GPIOs map to PWM slices and channels") {
+  CHECK(PwmSliceForGpio(0) == 0);
+  CHECK(PwmChannelForGpio(0) == 0);
+  CHECK(PwmSliceForGpio(3) == 1);
+  CHECK(PwmChannelForGpio(3) == 1);
+  CHECK(PwmSliceForGpio(15) == 7);
+  CHECK(PwmSliceForGpio(16) == 0);
+  CHECK(PwmSliceForGpio(29) == 6);
+  CHECK(PwmSliceForGpio(32) == 8);
+  CHECK(PwmSliceForGpio(39) == 11);
+  CHECK(PwmSliceForGpio(40) == 8);
+  CHECK(PwmSliceForGpio(47) == 11);
+}
+
+TEST_CASE("PWM timing uses the smallest divider that fits 16 bits") {
+  const auto slow = ComputePwmTiming(150000000, 50.0f);
+  REQUIRE(slow.has_value());
+  CHECK(slow->divider == 46);
+  CHECK(slow->top == 65216);
+  CHECK(slow->period_us == doctest::Approx(20000.0f).epsilon(0.001));
+
+  const auto fast = ComputePwmTiming(150000000, 490.0f);
+  REQUIRE(fast.has_value());
+  CHECK(fast->divider == 5);
+  CHECK(fast->period_us == doctest::Approx(1e6f / 490.0f).epsilon(0.001));
+  CHECK(PulseToLevel(1500.0f, *fast) == 45000);
+  CHECK(PulseToLevel(1e6f, *fast) == fast->top + 1);
+  CHECK(PulseToLevel(-5.0f, *fast) == 0);
+
+  CHECK_FALSE(ComputePwmTiming(150000000, 5.0f).has_value());
+  CHECK_FALSE(ComputePwmTiming(150000000, 0.0f).has_value());
+}
+
+TEST_CASE("Slice plan rejects pins sharing a slice output") {
+  PwmSlicePlan plan;
+  const uint32_t pins[4] = {2, 3, 6, 7};
+  REQUIRE(plan.Build(pins, 4));
+  CHECK(plan.slice_mask == 0b1010);
+  CHECK(plan.slice[2] == 3);
+  CHECK(plan.channel[3] == 1);
+
+  // GPIO 0 and 16 are both slice 0 channel A.
+  const uint32_t clash[2] = {0, 16};
+  CHECK_FALSE(plan.Build(clash, 2));
+}
@@ -0,0 +1,115 @@
+#include <doctest/doctest.h>
+
+#include <cmath>
+
+#include "flight/filters/rpm_notch_filter.h"
+
+namespace {
+
+constexpr float kPi = 3.14159265f;
+
+/** @brief Peak amplitude of a filtered sine after settling. */
+float FilteredAmplitude(flight::filters::RpmNotchFilter& filter, float hz, float rate_hz) {
+  float peak = 0.0f;
+  for (int i = 0; i < 4000; ++i) {
+    const float x = std::sin(2.0f * kPi * hz * static_cast<float>(i) / rate_hz);
+    const auto y = filter.Apply({x, x, x});
+    if (i > 3000) {
+      peak = std::fmax(peak, std::fabs(y.x));
+    }
+  }
+  return peak;
+}
+
+}  // namespace
+
+TEST_CASE("eRPM period code converts to eRPM") {
+  // m = 300, e = 1 -> 600 us period -> 100000 eRPM.
+  const uint16_t code = static_cast<uint16_t>((1u << 9) | 300u);
+  CHECK(flight::actuators::ErpmFromPeriodCode(code) == 100000u);
+  CHECK(flight::actuators::ErpmFromPeriodCode(0x0FFF) == 0u);
+  CHECK(flight::actuators::ErpmFromPeriodCode(0) == 0u);
+}
+
+TEST_CASE("RPM notch removes motor vibration and passes other bands") {
+  flight::filters::RpmNotchFilter::Config config{};
+  config.sample_rate_hz = 1000.0f;
+  config.motor_count = 1;
+  config.harmonics = 1;
+  config.motor_pole_count = 14;
+
+  flight::filters::RpmNotchFilter filter(config);
+  REQUIRE(filter.Initialize());
+
+  // 7 pole pairs * 60 * 150 Hz = 63000 eRPM.
+  filter.SetMotorErpm(0, 63000);
+  CHECK(FilteredAmplitude(filter, 150.0f, config.sample_rate_hz) < 0.05f);
+  CHECK(filter.NotchHz(0, 0) == doctest::Approx(150.0f));
+  CHECK(FilteredAmplitude(filter, 20.0f, config.sample_rate_hz) > 0.9f);
+}
+
+TEST_CASE("RPM notch follows telemetry frames") {
+  flight::filters::RpmNotchFilter filter({});
+  REQUIRE(filter.Initialize());
+
+  flight::actuators::DshotTelemetryFrame frame{};
+  frame.channel = 2;
+  frame.data = static_cast<uint16_t>((1u << 9) | 300u);
+  frame.crc_ok = true;
+  filter.UpdateTelemetry(frame);
+  CHECK(filter.MotorHz(2) == doctest::Approx(100000.0f / (7.0f * 60.0f)));
+
+  frame.channel = 1;
+  frame.crc_ok = false;
+  filter.UpdateTelemetry(frame);
+  CHECK(filter.MotorHz(1) == doctest::Approx(0.0f));
+}
+
+TEST_CASE("RPM notch retunes within the per-tick budget") {
+  flight::filters::RpmNotchFilter::Config config{};
+  config.motor_count = 4;
+  config.harmonics = 3;
+  config.max_retunes_per_tick = 4;
+  flight::filters::RpmNotchFilter filter(config);
+  REQUIRE(filter.Initialize());
+
+  for (uint8_t m = 0; m < 4; ++m) {
+    filter.SetMotorErpm(m, 42000);  // 100 Hz fundamental
+  }
+
+  uint32_t total = 0;
+  for (int tick = 0; tick < 3; ++tick) {
+    filter.Apply({});
+    CHECK(filter.LastRetuneCount() <= 4);
+    total += filter.LastRetuneCount();
+  }
+  CHECK(total == 12);
+  CHECK(filter.NotchHz(3, 2) == doctest::Approx(300.0f));
+
+  filter.Apply({});
+  CHECK(filter.LastRetuneCount() == 0);
+}
+
+TEST_CASE("Spectrum notches skip peaks covered by an RPM harmonic") {
+  flight::filters::RpmNotchFilter::Config config{};
+  config.motor_count = 1;
+  config.harmonics = 2;
+  config.spectrum_notches = 1;
+  flight::filters::RpmNotchFilter filter(config);
+  REQUIRE(filter.Initialize());
+  filter.SetMotorErpm(0, 63000);  // 150 Hz fundamental, 300 Hz second harmonic
+
+  // Strongest peak is the motor line; the next one is a frame resonance.
+  const float peaks[3] = {152.0f, 301.0f, 87.0f};
+  filter.SetSpectrumPeaks(0, peaks, 3);
+  for (int i = 0; i < 3; ++i) {
+    filter.Apply({});
+  }
+  CHECK(filter.SpectrumNotchHz(0, 0) == doctest::Approx(87.0f));
+
+  // Without RPM data nothing is covered.
+  filter.SetMotorErpm(0, 0);
+  filter.SetSpectrumPeaks(0, peaks, 3);
+  filter.Apply({});
+  CHECK(filter.SpectrumNotchHz(0, 0) == doctest::Approx(152.0f));
+}
@@ -18,3 +18,28 @@ TEST_CASE("Scheduler runs tasks at configured rates") {
   CHECK(fast_count == 100);
   CHECK(slow_count == 10);
 }
+
+TEST_CASE("Scheduler runs a task once per slow tick with the elapsed time") {
+  flight::scheduler::Scheduler scheduler;
+
+  int count = 0;
+  float last_dt = 0.0f;
+  scheduler.AddTask({"rate", 1000, [&](float dt) {
+                       ++count;
+                       last_dt = dt;
+                     }});
+
+  for (int i = 0; i < 10; ++i) {
+    scheduler.Tick(0.01f);
+  }
+  CHECK(count == 10);
+  CHECK(last_dt == doctest::Approx(0.01f));
+
+  scheduler.Tick(0.0004f);
+  scheduler.Reset();
+  scheduler.Tick(0.0007f);
+  CHECK(count == 10);
+  scheduler.Tick(0.0004f);
+  CHECK(count == 11);
+  CHECK(last_dt == doctest::Approx(0.0011f));
+}
@@ -0,0 +1,104 @@
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "flight/sensors/sensor_history.h"
+
+TEST_CASE("IMU history exposes contiguous per-axis windows") {
+  flight::sensors::ImuHistory<8> history;
+
+  for (int i = 0; i < 5; ++i) {
+    flight::sensors::ImuSample sample{};
+    sample.gyro_rps.z = static_cast<float>(i);
+    sample.accel_mps2.x = static_cast<float>(10 * i);
+    sample.timestamp_us = static_cast<uint64_t>(i) * 1000;
+    history.Push(sample);
+  }
+
+  CHECK(history.Size() == 5);
+  const auto view = history.Latest(3);
+  REQUIRE(view.size == 3);
+  CHECK(view.first_index == 2);
+  float gz[3];
+  view.CopyChannel(flight::sensors::kImuGyroZ, gz);
+  CHECK(gz[0] == doctest::Approx(2.0f));
+  CHECK(gz[2] == doctest::Approx(4.0f));
+  CHECK(view.Value(flight::sensors::kImuAccelX, 1) == doctest::Approx(30.0f));
+  CHECK(view.Timestamp(2) == 4000);
+  CHECK(history.StillValid(view));
+}
+
+TEST_CASE("History windows stay contiguous across wrap-around") {
+  flight::sensors::SoaRingBuffer<1, 4> history;
+  for (int i = 0; i < 11; ++i) {
+    const float value[1] = {static_cast<float>(i)};
+    history.Push(value, 0);
+  }
+
+  const auto view = history.Latest(10);
+  REQUIRE(view.size == 4);
+  for (size_t i = 0; i < view.size; ++i) {
+    CHECK(view.Value(0, i) == doctest::Approx(static_cast<float>(7 + i)));
+  }
+}
+
+TEST_CASE("History views are invalidated once overwritten") {
+  flight::sensors::SoaRingBuffer<1, 4> history;
+  const float value[1] = {1.0f};
+  for (int i = 0; i < 4; ++i) {
+    history.Push(value, 0);
+  }
+  const auto view = history.Latest(4);
+  REQUIRE(view.size == 4);
+  CHECK(history.StillValid(view));
+  history.Push(value, 0);
+  CHECK_FALSE(history.StillValid(view));
+
+  const auto short_view = history.Latest(2);
+  CHECK(history.StillValid(short_view));
+  history.Push(value, 0);
+  history.Push(value, 0);
+  CHECK(history.StillValid(short_view));
+  history.Push(value, 0);
+  CHECK_FALSE(history.StillValid(short_view));
+}
+
+TEST_CASE("History readers see consistent windows while the producer runs") {
+  flight::sensors::ImuHistory<64> history;
+  std::atomic<bool> done{false};
+
+  std::thread producer([&] {
+    for (int i = 0; i < 50000; ++i) {
+      flight::sensors::ImuSample sample{};
+      sample.gyro_rps.x = static_cast<float>(i);
+      sample.gyro_rps.y = static_cast<float>(i);
+      history.Push(sample);
+    }
+    done = true;
+  });
+
+  uint32_t validated = 0;
+  uint32_t mismatches = 0;
+  while (!done) {
+    const auto view = history.Latest(16);
+    float sum_x = 0.0f;
+    float sum_y = 0.0f;
+    for (size_t i = 0; i < view.size; ++i) {
+      sum_x += view.Value(flight::sensors::kImuGyroX, i);
+      sum_y += view.Value(flight::sensors::kImuGyroY, i);
+    }
+    if (history.StillValid(view)) {
+      ++validated;
+      mismatches += sum_x == sum_y ? 0 : 1;
+    }
+  }
+  producer.join();
+
+  CHECK(mismatches == 0);
+  CHECK(history.Count() == 50000);
+  const auto final_view = history.Latest(16);
+  CHECK(history.StillValid(final_view));
+  CHECK(final_view.Value(flight::sensors::kImuGyroX, 15) == doctest::Approx(49999.0f));
+  MESSAGE("validated concurrent views: " << validated);
+}
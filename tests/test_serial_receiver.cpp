@@ -0,0 +1,169 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "flight/receiver/serial_receiver.h"
+#include "test_fakes.h"
+
+namespace rx = flight::receiver;
+
+namespace {
+
+// Channels 0..2 at 1811 / 172 / 1402, the rest centred (992).
+const uint8_t kPacked[22] = {0x13, 0x67, 0x85, 0x5E, 0xC1, 0x07, 0x3E, 0xF0, 0x81, 0x0F, 0x7C,
+                             0xE0, 0x03, 0x1F, 0xF8, 0xC0, 0x07, 0x3E, 0xF0, 0x81, 0x0F, 0x7C};
+// Synthetic CRSF frames built from kPacked (not a hardware capture): RC
+// channels, then link statistics.
+const uint8_t kCrsfChannels[26] = {0xC8, 0x18, 0x16, 0x13, 0x67, 0x85, 0x5E, 0xC1, 0x07,
+                                   0x3E, 0xF0, 0x81, 0x0F, 0x7C, 0xE0, 0x03, 0x1F, 0xF8,
+                                   0xC0, 0x07, 0x3E, 0xF0, 0x81, 0x0F, 0x7C, 0xE0};
+const uint8_t kCrsfLinkStats[14] = {0xC8, 0x0C, 0x14, 0x50, 0x00, 0x64, 0x0A,
+                                    0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0xCD};
+
+std::vector<uint8_t> SbusFrame(uint8_t flags) {
+  std::vector<uint8_t> frame(25);
+  frame[0] = rx::SbusParser::kHeader;
+  std::copy(kPacked, kPacked + 22, frame.begin() + 1);
+  frame[23] = flags;
+  frame[24] = 0x00;
+  return frame;
+}
+
+/** @brief UART whose receive buffer is filled by the test in arbitrary fragments. */
+class ReplayUart final : public flight::hal::IUart {
+ public:
+  bool Write(const uint8_t*, size_t) override { return true; }
+  bool Read(uint8_t* out, size_t length) override {
+    if (arrived - position < length) {
+      return false;
+    }
+    std::copy_n(stream.begin() + static_cast<long>(position), length, out);
+    position += length;
+    return true;
+  }
+
+  std::vector<uint8_t> stream;
+  size_t arrived = 0;
+  size_t position = 0;
+};
+
+void Append(std::vector<uint8_t>& stream, const uint8_t* data, size_t length) {
+  stream.insert(stream.end(), data, data + length);
+}
+
+}  // namespace
+
+TEST_CASE("CRSF helpers") {
+  CHECK(rx::Crc8DvbS2(reinterpret_cast<const uint8_t*>("123456789"), 9) == 0xBC);
+  uint16_t raw[16];
+  rx::UnpackRcChannels(kPacked, raw);
+  CHECK(raw[0] == 1811);
+  CHECK(raw[1] == 172);
+  CHECK(raw[2] == 1402);
+  CHECK(raw[15] == 992);
+  CHECK(rx::NormalizeRcChannel(992) == doctest::Approx(0.0f));
+  CHECK(rx::NormalizeRcChannel(1811) == doctest::Approx(1.0f).epsilon(0.001));
+  CHECK(rx::NormalizeRcChannel(172) == doctest::Approx(-1.0f).epsilon(0.001));
+}
+
+TEST_CASE("CRSF receiver survives random fragmentation and line noise") {
+  std::vector<uint8_t> stream;
+  uint32_t expected = 0;
+  std::mt19937 rng(42);
+  for (int i = 0; i < 200; ++i) {
+    Append(stream, kCrsfChannels, sizeof(kCrsfChannels));
+    ++expected;
+    if (i % 5 == 0) {
+      Append(stream, kCrsfLinkStats, sizeof(kCrsfLinkStats));
+    }
+    if (i % 17 == 0) {
+      // A corrupted channels frame followed by noise that includes a sync byte.
+      std::vector<uint8_t> bad(kCrsfChannels, kCrsfChannels + sizeof(kCrsfChannels));
+      bad[10] ^= 0x40;
+      stream.insert(stream.end(), bad.begin(), bad.end());
+      stream.push_back(0x00);
+      stream.push_back(0xC8);
+      stream.push_back(0x7F);
+    }
+  }
+
+  for (uint32_t seed = 0; seed < 20; ++seed) {
+    rng.seed(seed);
+    ReplayUart uart;
+    uart.stream = stream;
+    rx::CrsfReceiver receiver({&uart});
+    REQUIRE(receiver.Initialize());
+    std::uniform_int_distribution<size_t> fragment(1, 40);
+    uint32_t received = 0;
+    rx::CommandFrame frames[8];
+    while (uart.position < stream.size()) {
+      uart.arrived = std::min(stream.size(), uart.arrived + fragment(rng));
+      const size_t count = receiver.ReadBatch(frames, 8);
+      for (size_t i = 0; i < count; ++i) {
+        CHECK(frames[i].channel_count == 16);
+        CHECK(frames[i].channels[0] == doctest::Approx(1.0f).epsilon(0.001));
+        CHECK(frames[i].channels[1] == doctest::Approx(-1.0f).epsilon(0.001));
+        CHECK(frames[i].channels[2] == doctest::Approx(0.5f).epsilon(0.001));
+        CHECK(frames[i].sequence == received + i + 1);
+      }
+      received += static_cast<uint32_t>(count);
+    }
+    CHECK(received == expected);
+    const auto& stats = receiver.GetParser().Stats();
+    CHECK(stats.frames == expected);
+    CHECK(stats.other_frames == 40);
+    CHECK(stats.errors == 12);
+  }
+}
+
+TEST_CASE("CRSF frame time is back-dated by the bytes that followed it") {
+  ReplayUart uart;
+  Append(uart.stream, kCrsfChannels, sizeof(kCrsfChannels));
+  Append(uart.stream, kCrsfChannels, 10);
+  uart.arrived = uart.stream.size();
+  flight::test::ManualTime time(500000);
+  rx::CrsfReceiver receiver({&uart, &time});
+  REQUIRE(receiver.Initialize());
+
+  const auto frame = receiver.Read();
+  REQUIRE(frame.has_value());
+  // 10 bytes at 420 kbaud 8N1 = 238 us.
+  CHECK(frame->age_us == 238);
+  CHECK(frame->received_us == time.now_us - 238);
+  CHECK_FALSE(receiver.Read().has_value());
+}
+
+TEST_CASE("SBUS receiver decodes channels and failsafe, keeping the newest frame") {
+  std::vector<uint8_t> stream = {0x00, 0x0F, 0x12};  // tail of a frame we joined mid-way
+  for (int i = 0; i < 30; ++i) {
+    const auto frame = SbusFrame(i == 29 ? rx::SbusParser::kFlagFailsafe : 0);
+    stream.insert(stream.end(), frame.begin(), frame.end());
+  }
+  auto bad_end = SbusFrame(rx::SbusParser::kFlagFrameLost);
+  bad_end.back() = 0x55;
+  stream.insert(stream.begin() + 3, bad_end.begin(), bad_end.end());
+
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<size_t> fragment(1, 30);
+  ReplayUart uart;
+  uart.stream = stream;
+  rx::SbusReceiver receiver({&uart});
+  REQUIRE(receiver.Initialize());
+  uint32_t received = 0;
+  std::optional<rx::CommandFrame> last;
+  while (uart.position < stream.size()) {
+    uart.arrived = std::min(stream.size(), uart.arrived + fragment(rng));
+    if (auto frame = receiver.Read()) {
+      ++received;
+      last = frame;
+    }
+  }
+  REQUIRE(last.has_value());
+  CHECK(last->failsafe);
+  CHECK(last->sequence == 30);
+  CHECK(last->channels[0] == doctest::Approx(1.0f).epsilon(0.001));
+  CHECK(receiver.GetParser().Stats().frames == 30);
+  CHECK(received <= 30);
+}
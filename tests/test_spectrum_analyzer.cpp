@@ -0,0 +1,61 @@
+#include <doctest/doctest.h>
+
+#include <cmath>
+
+#include "flight/filters/rpm_notch_filter.h"
+#include "flight/filters/spectrum_analyzer.h"
+
+namespace {
+
+constexpr float kPi = 3.14159265f;
+
+}  // namespace
+
+TEST_CASE("Spectrum analyzer finds the dominant gyro tone") {
+  flight::filters::SpectrumAnalyzer analyzer({});
+  REQUIRE(analyzer.Initialize());
+
+  for (int n = 0; n < 1000; ++n) {
+    const float t = static_cast<float>(n) / 1000.0f;
+    const float x = std::sin(2.0f * kPi * 180.0f * t) + 0.4f * std::sin(2.0f * kPi * 320.0f * t);
+    analyzer.Push({x, 0.0f, -x});
+  }
+  analyzer.UpdateAllPeaks();
+
+  CHECK(analyzer.DominantHz(0) == doctest::Approx(180.0f).epsilon(0.03f));
+  CHECK(analyzer.Peaks(0)[0].magnitude == doctest::Approx(1.0f).epsilon(0.15f));
+  CHECK(analyzer.Peaks(0)[1].hz == doctest::Approx(320.0f).epsilon(0.03f));
+  CHECK(analyzer.DominantHz(2) == doctest::Approx(180.0f).epsilon(0.03f));
+  CHECK(analyzer.DominantHz(1) == doctest::Approx(0.0f));
+}
+
+TEST_CASE("Spectrum analyzer rejects an invalid band") {
+  flight::filters::SpectrumAnalyzer::Config config{};
+  config.min_hz = 300.0f;
+  config.max_hz = 100.0f;
+  flight::filters::SpectrumAnalyzer analyzer(config);
+  CHECK_FALSE(analyzer.Initialize());
+}
+
+TEST_CASE("Spectrum peaks steer per-axis notches") {
+  flight::filters::RpmNotchFilter filter({});
+  REQUIRE(filter.Initialize());
+
+  const float peaks[3] = {210.0f, 0.0f, 0.0f};
+  filter.SetSpectrumPeaks(1, peaks, 3);
+  filter.Apply({});
+
+  CHECK(filter.SpectrumNotchHz(1, 0) == doctest::Approx(210.0f));
+  CHECK(filter.SpectrumNotchHz(0, 0) == doctest::Approx(0.0f));
+
+  float peak = 0.0f;
+  for (int n = 0; n < 3000; ++n) {
+    const float x = std::sin(2.0f * kPi * 210.0f * static_cast<float>(n) / 1000.0f);
+    const auto y = filter.Apply({x, x, x});
+    if (n > 2000) {
+      peak = std::fmax(peak, std::fabs(y.y));
+      CHECK(std::fabs(y.x) <= 1.01f);
+    }
+  }
+  CHECK(peak < 0.05f);
+}
@@ -0,0 +1,220 @@
+#include <doctest/doctest.h>
+
+#include "flight/controllers/rov_controller.h"
+#include "flight/vehicle/rov4_vehicle.h"
+#include "flight/vehicle/static_rov_pipeline.h"
+#include "test_fakes.h"
+
+namespace {
+
+using flight::receiver::CommandFrame;
+
+/** @brief Arms for 1.2 s, then commands surge and yaw. */
+class ScriptedReceiver final : public flight::receiver::ICommandReceiver {
+ public:
+  bool Initialize() override { return true; }
+  std::optional<CommandFrame> Read() override {
+    if (delivered_) {
+      return std::nullopt;
+    }
+    delivered_ = true;
+    CommandFrame frame{};
+    frame.channel_count = 3;
+    // A new frame every other tick, so some ticks re-apply the last one.
+    frame.sequence = static_cast<uint32_t>(tick_ / 2);
+    frame.sent_us = 1000 + 4000ull * frame.sequence;
+    frame.received_us = frame.sent_us + 150 + static_cast<uint64_t>(tick_ % 7) * 40;
+    const bool arming = tick_ < 600;
+    frame.channels[0] = arming ? 0.0f : 0.4f;
+    frame.channels[1] = arming ? 1.0f : 0.2f;
+    frame.channels[2] = arming ? 0.0f : -0.3f;
+    return frame;
+  }
+  void NextTick() {
+    ++tick_;
+    delivered_ = false;
+  }
+
+ private:
+  int tick_ = 0;
+  bool delivered_ = false;
+};
+
+/** @brief One eRPM frame per tick, cycling through the motors. */
+class ScriptedEscTelemetry final : public flight::actuators::ITelemetryReceiver {
+ public:
+  bool Initialize() override { return true; }
+  std::optional<flight::actuators::DshotTelemetryFrame> Read() override {
+    if (delivered_) {
+      return std::nullopt;
+    }
+    delivered_ = true;
+    flight::actuators::DshotTelemetryFrame frame{};
+    frame.channel = static_cast<uint8_t>(tick_ % 4);
+    frame.data = static_cast<uint16_t>(100 + tick_);
+    frame.crc_ok = true;
+    return frame;
+  }
+  void NextTick() {
+    ++tick_;
+    delivered_ = false;
+  }
+
+ private:
+  int tick_ = 0;
+  bool delivered_ = false;
+};
+
+class RecordingOutput final : public flight::actuators::IActuatorOutput {
+ public:
+  bool Initialize() override { return true; }
+  bool Write(const flight::actuators::ActuatorCommand* commands, uint8_t count) override {
+    this->count = count;
+    for (uint8_t i = 0; i < count; ++i) {
+      values[i] = commands[i].value;
+    }
+    return true;
+  }
+  float values[8] = {};
+  uint8_t count = 0;
+};
+
+/** @brief Reports a 6-thruster output, which the 4-thruster paths must reject. */
+class SixThrusterController final : public flight::controllers::IController {
+ public:
+  bool Initialize() override { return true; }
+  flight::controllers::ControlOutput Update(const flight::core::Pose&,
+                                            const flight::controllers::ControlSetpoint&,
+                                            float) override {
+    flight::controllers::ControlOutput output{};
+    output.motor_count = 6;
+    for (uint8_t i = 0; i < output.motor_count; ++i) {
+      output.motors[i] = 0.5f;
+    }
+    return output;
+  }
+};
+
+}  // namespace
+
+TEST_CASE("RovArming arms and disarms on a one second hold") {
+  flight::vehicle::RovArming arming;
+  CommandFrame frame{};
+  frame.channel_count = 3;
+  frame.channels[1] = 1.0f;
+  for (int i = 0; i < 9; ++i) {
+    CHECK_FALSE(arming.Update(frame, 0.1f));
+  }
+  CHECK(arming.Update(frame, 0.11f));
+
+  frame.channels[1] = -1.0f;
+  arming.Update(frame, 0.5f);
+  arming.NoFrame();
+  CHECK(arming.Update(frame, 0.6f));
+  CHECK_FALSE(arming.Update(frame, 0.5f));
+}
+
+TEST_CASE("Static pipeline matches the interface-based vehicle") {
+  ScriptedReceiver rx_a, rx_b;
+  ScriptedEscTelemetry esc_a, esc_b;
+  flight::test::NullEstimator est_a, est_b;
+  flight::controllers::RovController ctl_a({}), ctl_b({});
+  RecordingOutput out_a, out_b;
+  flight::test::CapturingSink sink_a, sink_b;
+  flight::test::ManualTime time;
+
+  flight::vehicle::VehicleDependencies deps;
+  deps.estimator = &est_a;
+  deps.controller = &ctl_a;
+  deps.actuators = &out_a;
+  deps.receiver = &rx_a;
+  deps.telemetry = &esc_a;
+  deps.telemetry_sink = &sink_a;
+  deps.time = &time;
+  flight::vehicle::Rov4Vehicle vehicle(deps);
+  flight::vehicle::StaticRovPipeline pipeline(est_b, ctl_b, out_b, rx_b,
+                                              static_cast<flight::vehicle::NoImu*>(nullptr),
+                                              &sink_b, &esc_b, &time);
+  REQUIRE(vehicle.Initialize());
+  REQUIRE(pipeline.Initialize());
+
+  for (int tick = 0; tick < 700; ++tick) {
+    time.now_us = 1500 + 2000ull * static_cast<uint64_t>(tick);
+    vehicle.Update(0.002f);
+    pipeline.Update(0.002f);
+    rx_a.NextTick();
+    rx_b.NextTick();
+    esc_a.NextTick();
+    esc_b.NextTick();
+    REQUIRE(out_a.count == out_b.count);
+    for (uint8_t i = 0; i < out_a.count; ++i) {
+      CHECK(out_a.values[i] == doctest::Approx(out_b.values[i]));
+    }
+
+    const auto& a = sink_a.last;
+    const auto& b = sink_b.last;
+    CHECK(a.timestamp_us == b.timestamp_us);
+    CHECK(a.armed == b.armed);
+    CHECK(a.setpoint.velocity_mps.x == b.setpoint.velocity_mps.x);
+    CHECK(a.setpoint.body_rates_rps.z == b.setpoint.body_rates_rps.z);
+    CHECK(a.setpoint.velocity_mps.z == b.setpoint.velocity_mps.z);
+    REQUIRE(a.output.motor_count == b.output.motor_count);
+    for (uint8_t i = 0; i < a.output.motor_count; ++i) {
+      CHECK(a.output.motors[i] == doctest::Approx(b.output.motors[i]));
+    }
+    REQUIRE(a.esc_telemetry.has_value());
+    REQUIRE(b.esc_telemetry.has_value());
+    CHECK(a.esc_telemetry->channel == b.esc_telemetry->channel);
+    CHECK(a.esc_telemetry->data == b.esc_telemetry->data);
+    CHECK(a.command_sequence == b.command_sequence);
+    CHECK(a.command_sent_us == b.command_sent_us);
+    CHECK(a.command_received_us == b.command_received_us);
+    CHECK(a.actuator_write_us == b.actuator_write_us);
+  }
+  CHECK(pipeline.Armed());
+  CHECK(out_b.values[0] == doctest::Approx(0.6f));
+  CHECK(out_b.values[2] == doctest::Approx(-0.3f));
+  CHECK(sink_b.last.command_sequence == 349);
+  CHECK(pipeline.PipelineLatency().Count() == 350);
+  for (uint8_t b = 0; b < flight::telemetry::LatencyHistogram::kBuckets; ++b) {
+    CHECK(vehicle.UplinkLatency().Bucket(b) == pipeline.UplinkLatency().Bucket(b));
+    CHECK(vehicle.PipelineLatency().Bucket(b) == pipeline.PipelineLatency().Bucket(b));
+  }
+}
+
+TEST_CASE("Both ROV paths latch a fault and disarm when the controller motor count disagrees") {
+  ScriptedReceiver rx_a, rx_b;
+  flight::test::NullEstimator est_a, est_b;
+  SixThrusterController ctl_a, ctl_b;
+  RecordingOutput out_a, out_b;
+
+  flight::vehicle::VehicleDependencies deps;
+  deps.estimator = &est_a;
+  deps.controller = &ctl_a;
+  deps.actuators = &out_a;
+  deps.receiver = &rx_a;
+  flight::vehicle::Rov4Vehicle vehicle(deps);
+  flight::vehicle::StaticRovPipeline pipeline(est_b, ctl_b, out_b, rx_b);
+  REQUIRE(vehicle.Initialize());
+  REQUIRE(pipeline.Initialize());
+
+  for (int tick = 0; tick < 700; ++tick) {
+    vehicle.Update(0.002f);
+    pipeline.Update(0.002f);
+    rx_a.NextTick();
+    rx_b.NextTick();
+  }
+  CHECK(vehicle.MotorCountFault());
+  CHECK(pipeline.MotorCountFault());
+  CHECK_FALSE(pipeline.Armed());
+  CHECK(out_a.count == flight::vehicle::kRovThrusterCount);
+  CHECK(out_b.count == flight::vehicle::kRovThrusterCount);
+  for (uint8_t i = 0; i < flight::vehicle::kRovThrusterCount; ++i) {
+    CHECK(out_a.values[i] == 0.0f);
+    CHECK(out_b.values[i] == 0.0f);
+  }
+
+  // Only re-initialization clears the latched fault.
+  REQUIRE(pipeline.Initialize());
+  CHECK_FALSE(pipeline.MotorCountFault());
+}
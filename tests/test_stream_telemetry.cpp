@@ -0,0 +1,176 @@
+#include <doctest/doctest.h>
+
+#include <cstring>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include "flight/telemetry/stream_telemetry.h"
+
+namespace tl = flight::telemetry;
+
+namespace {
+
+uint16_t Bit(tl::TelemetryStream stream) {
+  return static_cast<uint16_t>(1u << static_cast<size_t>(stream));
+}
+
+tl::TelemetrySnapshot Sample() {
+  tl::TelemetrySnapshot s;
+  s.timestamp_us = 123456789;
+  s.pose.orientation = {0.5f, 0.5f, -0.5f, 0.5f};
+  s.pose.angular_velocity_rps = {0.1f, -0.2f, 0.3f};
+  s.setpoint.body_rates_rps = {0.4f, 0.5f, -0.6f};
+  s.output.motor_count = 4;
+  for (int i = 0; i < 4; ++i) {
+    s.output.motors[i] = 0.1f * static_cast<float>(i + 1);
+  }
+  s.esc_telemetry = flight::actuators::DshotTelemetryFrame{2, 0x123, 0x4567, true};
+  s.armed = true;
+  s.command_sequence = 77;
+  s.actuator_write_us = 123456900;
+  return s;
+}
+
+}  // namespace
+
+TEST_CASE("Stream payload sizes follow the schema") {
+  CHECK(tl::StreamPayloadBytes(tl::TelemetryStream::kAttitude) == 16);
+  CHECK(tl::StreamPayloadBytes(tl::TelemetryStream::kMotors) == 33);
+  CHECK(tl::StreamPayloadBytes(tl::TelemetryStream::kEsc) == 6);
+  CHECK(std::strcmp(tl::StreamName(tl::TelemetryStream::kLatency), "latency") == 0);
+  CHECK(tl::DefaultStreamRate(tl::TelemetryStream::kAttitude) == 100);
+}
+
+TEST_CASE("Stream packets carry only the requested streams") {
+  const tl::TelemetrySnapshot sample = Sample();
+  const uint16_t mask = Bit(tl::TelemetryStream::kRates) | Bit(tl::TelemetryStream::kMotors) |
+                        Bit(tl::TelemetryStream::kEsc) | Bit(tl::TelemetryStream::kStatus);
+  uint8_t packet[tl::StreamTelemetrySender::kMaxPacket];
+  const size_t length = tl::EncodeStreamPacket(sample, mask, packet, sizeof(packet));
+  CHECK(length == sizeof(tl::StreamPacketHeader) + 24 + 33 + 6 + 1);
+
+  tl::TelemetrySnapshot decoded;
+  uint16_t decoded_mask = 0;
+  REQUIRE(tl::DecodeStreamPacket(packet, length, decoded, decoded_mask));
+  CHECK(decoded_mask == mask);
+  CHECK(decoded.timestamp_us == sample.timestamp_us);
+  CHECK(decoded.pose.angular_velocity_rps.y == sample.pose.angular_velocity_rps.y);
+  CHECK(decoded.setpoint.body_rates_rps.z == sample.setpoint.body_rates_rps.z);
+  CHECK(decoded.output.motor_count == 4);
+  CHECK(decoded.output.motors[3] == sample.output.motors[3]);
+  REQUIRE(decoded.esc_telemetry.has_value());
+  CHECK(decoded.esc_telemetry->raw == 0x4567);
+  CHECK(decoded.esc_telemetry->crc_ok);
+  CHECK(decoded.armed);
+  // Streams not in the mask are left alone.
+  CHECK(decoded.pose.orientation.w == 1.0f);
+  CHECK(decoded.command_sequence == 0);
+
+  CHECK_FALSE(tl::DecodeStreamPacket(packet, length - 1, decoded, decoded_mask));
+  packet[4] = 2;
+  CHECK_FALSE(tl::DecodeStreamPacket(packet, length, decoded, decoded_mask));
+}
+
+TEST_CASE("ESC stream is omitted without an ESC frame") {
+  tl::TelemetrySnapshot sample = Sample();
+  sample.esc_telemetry.reset();
+  uint8_t packet[tl::StreamTelemetrySender::kMaxPacket];
+  const uint16_t mask = Bit(tl::TelemetryStream::kEsc) | Bit(tl::TelemetryStream::kStatus);
+  const size_t length = tl::EncodeStreamPacket(sample, mask, packet, sizeof(packet));
+  tl::TelemetrySnapshot decoded;
+  uint16_t decoded_mask = 0;
+  REQUIRE(tl::DecodeStreamPacket(packet, length, decoded, decoded_mask));
+  CHECK(decoded_mask == Bit(tl::TelemetryStream::kStatus));
+  CHECK_FALSE(decoded.esc_telemetry.has_value());
+}
+
+TEST_CASE("Subscription requests set per-stream rates") {
+  const tl::StreamRate rates[] = {
+      {static_cast<uint8_t>(tl::TelemetryStream::kMotors), 0, 1000},
+      {static_cast<uint8_t>(tl::TelemetryStream::kAttitude), 0, 0},
+  };
+  uint8_t request[64];
+  const size_t length = tl::EncodeSubscription(rates, 2, request, sizeof(request));
+  REQUIRE(length == tl::kSubscribeHeaderBytes + 8);
+
+  tl::StreamTelemetrySender sender(tl::StreamTelemetrySender::Config{});
+  CHECK(sender.Rate(tl::TelemetryStream::kAttitude) == 100);
+  REQUIRE(sender.ApplySubscription(request, length));
+  CHECK(sender.Rate(tl::TelemetryStream::kMotors) == 1000);
+  CHECK(sender.Rate(tl::TelemetryStream::kAttitude) == 0);
+  CHECK_FALSE(sender.ApplySubscription(request, length - 1));
+}
+
+TEST_CASE("Stream sender paces each stream and follows ground station subscriptions") {
+#if defined(__linux__)
+  constexpr uint16_t kGroundPort = 14563;
+  constexpr uint16_t kVehiclePort = 14564;
+  int ground = ::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+  REQUIRE(ground >= 0);
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(kGroundPort);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  REQUIRE(::bind(ground, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0);
+
+  tl::StreamTelemetrySender::Config config;
+  config.port = kGroundPort;
+  config.local_port = kVehiclePort;
+  tl::StreamTelemetrySender sender(config);
+  REQUIRE(sender.Initialize());
+
+  uint32_t counts[tl::kTelemetryStreamCount] = {0};
+  auto run_second = [&](uint64_t start_us) {
+    for (auto& count : counts) {
+      count = 0;
+    }
+    tl::TelemetrySnapshot sample = Sample();
+    uint8_t buffer[512];
+    for (uint64_t tick = 0; tick < 1000; ++tick) {
+      sample.timestamp_us = start_us + tick * 1000;
+      sender.Publish(sample);
+      ssize_t length = 0;
+      while ((length = ::recv(ground, buffer, sizeof(buffer), 0)) > 0) {
+        tl::TelemetrySnapshot decoded;
+        uint16_t mask = 0;
+        REQUIRE(tl::DecodeStreamPacket(buffer, static_cast<size_t>(length), decoded, mask));
+        for (size_t i = 0; i < tl::kTelemetryStreamCount; ++i) {
+          counts[i] += (mask >> i) & 1u;
+        }
+      }
+    }
+  };
+
+  run_second(1000000);
+  CHECK(counts[static_cast<size_t>(tl::TelemetryStream::kAttitude)] == 100);
+  CHECK(counts[static_cast<size_t>(tl::TelemetryStream::kMotors)] == 50);
+  CHECK(counts[static_cast<size_t>(tl::TelemetryStream::kStatus)] == 1);
+  CHECK(counts[static_cast<size_t>(tl::TelemetryStream::kLatency)] == 0);
+
+  const tl::StreamRate rates[] = {
+      {static_cast<uint8_t>(tl::TelemetryStream::kMotors), 0, 1000},
+      {static_cast<uint8_t>(tl::TelemetryStream::kAttitude), 0, 0},
+  };
+  uint8_t request[64];
+  const size_t length = tl::EncodeSubscription(rates, 2, request, sizeof(request));
+  sockaddr_in vehicle = addr;
+  vehicle.sin_port = htons(kVehiclePort);
+  REQUIRE(::sendto(ground, request, length, 0, reinterpret_cast<sockaddr*>(&vehicle), sizeof(vehicle)) ==
+          static_cast<ssize_t>(length));
+
+  // Requests are polled every 100 ms of snapshot time.
+  run_second(2000000);
+  run_second(3000000);
+  CHECK(counts[static_cast<size_t>(tl::TelemetryStream::kAttitude)] == 0);
+  CHECK(counts[static_cast<size_t>(tl::TelemetryStream::kMotors)] == 1000);
+  CHECK(sender.Rate(tl::TelemetryStream::kMotors) == 1000);
+  ::close(ground);
+#else
+  CHECK(true);
+#endif
+}
@@ -0,0 +1,94 @@
+#include <doctest/doctest.h>
+
+#include <cmath>
+
+#include "flight/actuators/pwm_output.h"
+#include "flight/actuators/thrust_linearizer.h"
+#include "flight/config/in_memory_config.h"
+
+using flight::actuators::ThrustLinearizer;
+
+TEST_CASE("Thrust linearizer inverts the asymmetric thruster model") {
+  ThrustLinearizer linearizer;
+  // Table interpolation bounds the thrust error by 1 / (4 * (N - 1)).
+  const float tolerance = 1.0f / (4.0f * (ThrustLinearizer::kTableSize - 1)) + 1e-4f;
+  for (int i = -100; i <= 100; ++i) {
+    const float request = static_cast<float>(i) / 100.0f;
+    const float command = linearizer.Command(request);
+    const float produced = linearizer.ModelThrust(command);
+    const float reachable = request < -0.7f ? -0.7f : request;
+    CHECK(std::fabs(produced - reachable) <= tolerance);
+  }
+}
+
+TEST_CASE("Thrust linearizer stays accurate for small requests") {
+  for (const float exponent : {2.0f, 1.5f}) {
+    ThrustLinearizer::Config config{};
+    config.forward_exponent = exponent;
+    config.reverse_exponent = exponent;
+    ThrustLinearizer linearizer(config);
+    for (float request = 0.002f; request <= 0.05f; request += 0.0005f) {
+      CHECK(linearizer.ModelThrust(linearizer.Command(request)) ==
+            doctest::Approx(request).epsilon(0.02));
+      CHECK(linearizer.ModelThrust(linearizer.Command(-request)) ==
+            doctest::Approx(-request).epsilon(0.02));
+    }
+  }
+}
+
+TEST_CASE("Thrust linearizer compensates the deadband and keeps zero neutral") {
+  ThrustLinearizer::Config config{};
+  config.deadband = 0.1f;
+  ThrustLinearizer linearizer(config);
+  CHECK(linearizer.Command(0.0f) == 0.0f);
+  CHECK(linearizer.Command(0.01f) >= 0.1f);
+  CHECK(linearizer.Command(-0.01f) <= -0.1f);
+  CHECK(linearizer.Command(1.0f) == doctest::Approx(1.0f));
+  CHECK(linearizer.Command(-1.0f) == doctest::Approx(-1.0f));
+}
+
+TEST_CASE("Thrust linearizer scales for battery voltage") {
+  ThrustLinearizer linearizer;
+  const float nominal = linearizer.Command(0.25f);
+  linearizer.SetVoltage(12.0f);
+  const float sagged = linearizer.Command(0.25f);
+  CHECK(sagged > nominal);
+  // At 12 V of 16 V nominal, the model needs (16/12)^2 times the thrust.
+  const float expected = 0.25f * (16.0f / 12.0f) * (16.0f / 12.0f);
+  CHECK(linearizer.ModelThrust(sagged) == doctest::Approx(expected).epsilon(0.03));
+}
+
+TEST_CASE("Thrust linearizer processes a full channel block") {
+  ThrustLinearizer linearizer;
+  const float thrust[8] = {-1.0f, -0.5f, -0.1f, 0.0f, 0.1f, 0.5f, 0.9f, 2.0f};
+  float command[8] = {};
+  linearizer.Apply(thrust, command, 8);
+  for (uint8_t i = 0; i < 8; ++i) {
+    CHECK(command[i] == doctest::Approx(linearizer.Command(thrust[i])));
+  }
+  CHECK(command[7] == doctest::Approx(1.0f));
+}
+
+TEST_CASE("Thrust linearizer config loads from the store") {
+  flight::config::InMemoryConfigStore store;
+  store.Set("thrust.forward_exponent", 1.5f);
+  store.Set("thrust.deadband", 0.08f);
+  store.Set("thrust.zero_threshold", 0.002f);
+  const auto config = ThrustLinearizer::LoadConfig(store);
+  CHECK(config.forward_exponent == doctest::Approx(1.5f));
+  CHECK(config.deadband == doctest::Approx(0.08f));
+  CHECK(config.zero_threshold == doctest::Approx(0.002f));
+  CHECK(config.reverse_max == doctest::Approx(ThrustLinearizer::Config{}.reverse_max));
+}
+
+TEST_CASE("Linearized output forwards converted commands") {
+  flight::actuators::PwmOutput pwm;
+  ThrustLinearizer linearizer;
+  flight::actuators::LinearizedOutput output(&pwm, &linearizer);
+  REQUIRE(output.Initialize());
+  flight::actuators::ActuatorCommand commands[2] = {{0.25f}, {0.0f}};
+  REQUIRE(output.Write(commands, 2));
+  REQUIRE(pwm.LastCount() == 2);
+  CHECK(pwm.LastCommands()[0].value == doctest::Approx(linearizer.Command(0.25f)));
+  CHECK(pwm.LastCommands()[1].value == 0.0f);
+}
@@ -10,6 +10,7 @@
 #include <unistd.h>
 #endif
 
+#include "flight/hal/linux_hal.h"
 #include "flight/receiver/udp_receiver.h"
 
 TEST_CASE("UDP receiver reads a command frame") {
@@ -57,6 +58,114 @@ TEST_CASE("UDP receiver reads a command frame") {
   CHECK(frame->channels[0] == doctest::Approx(0.1f));
   CHECK(frame->channels[1] == doctest::Approx(-0.2f));
   CHECK(frame->channels[2] == doctest::Approx(0.3f));
+  // Without a configured clock, arrival is stamped on hal::LinuxTime.
+  CHECK(frame->received_us > 0);
+  CHECK(frame->received_us <= flight::hal::LinuxTime{}.NowUs());
+
+  ::close(sock);
+#else
+  CHECK(true);
+#endif
+}
+
+TEST_CASE("UDP receiver drains queued datagrams in one batch") {
+#if defined(__linux__)
+  flight::receiver::UdpReceiver receiver({14552});
+  REQUIRE(receiver.Initialize());
+
+  int sock = ::socket(AF_INET, SOCK_DGRAM, 0);
+  REQUIRE(sock >= 0);
+
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(14552);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  struct Packet {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t channel_count;
+    float channels[16];
+  } packet{};
+  packet.magic = 0x4D465454;
+  packet.version = 1;
+  packet.channel_count = 3;
+
+  for (int i = 0; i < 5; ++i) {
+    packet.channels[0] = static_cast<float>(i);
+    ::sendto(sock, &packet, sizeof(packet), 0, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  flight::receiver::CommandFrame frames[8];
+  const size_t count = receiver.ReadBatch(frames, 8);
+  REQUIRE(count == 5);
+  CHECK(frames[0].channels[0] == doctest::Approx(0.0f));
+  CHECK(frames[4].channels[0] == doctest::Approx(4.0f));
+  CHECK(receiver.ReadBatch(frames, 8) == 0);
+
+  ::close(sock);
+#else
+  CHECK(true);
+#endif
+}
+
+TEST_CASE("UDP receiver drains a flooded socket to the newest frame") {
+#if defined(__linux__)
+  flight::receiver::UdpReceiver receiver({14553});
+  REQUIRE(receiver.Initialize());
+
+  int sock = ::socket(AF_INET, SOCK_DGRAM, 0);
+  REQUIRE(sock >= 0);
+
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(14553);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  struct Packet {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t channel_count;
+    float channels[16];
+  } packet{};
+  packet.magic = 0x4D465454;
+  packet.version = 1;
+  packet.channel_count = 3;
+
+  constexpr int kFlood = 100;
+  for (int i = 0; i < kFlood; ++i) {
+    packet.channels[0] = static_cast<float>(i);
+    ::sendto(sock, &packet, sizeof(packet), 0, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+  }
+  const uint32_t garbage = 0xDEADBEEF;
+  ::sendto(sock, &garbage, sizeof(garbage), 0, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+  const auto frame = receiver.Read();
+  REQUIRE(frame.has_value());
+  CHECK(frame->channels[0] == doctest::Approx(static_cast<float>(kFlood - 1)));
+  CHECK(frame->sequence == kFlood - 1);
+  CHECK(frame->age_us >= 10000);
+  const auto& stats = receiver.LastDrain();
+  CHECK(stats.datagrams == kFlood + 1);
+  CHECK(stats.invalid == 1);
+  CHECK(stats.dropped == kFlood - 1);
+  CHECK(stats.age_us == frame->age_us);
+  CHECK_FALSE(receiver.Read().has_value());
+
+  // A batch keeps the newest frames in order.
+  for (int i = 0; i < 20; ++i) {
+    packet.channels[0] = static_cast<float>(i);
+    ::sendto(sock, &packet, sizeof(packet), 0, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  flight::receiver::CommandFrame frames[8];
+  REQUIRE(receiver.ReadBatch(frames, 8) == 8);
+  CHECK(frames[0].channels[0] == doctest::Approx(12.0f));
+  CHECK(frames[7].channels[0] == doctest::Approx(19.0f));
+  CHECK(receiver.LastDrain().dropped == 12);
+  CHECK(receiver.TotalDropped() == kFlood - 1 + 12);
 
   ::close(sock);
 #else